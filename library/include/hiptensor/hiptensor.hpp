@@ -45,6 +45,63 @@ hiptensorStatus_t hiptensorCreate(hiptensorHandle_t** handle);
 //! @returns HIPTENSOR_STATUS_SUCCESS on success and an error code otherwise
 hiptensorStatus_t hiptensorDestroy(hiptensorHandle_t* handle);
 
+//! @brief Sets the maximum number of contraction plans cached by the handle
+//! @details @ref hiptensorInitContractionPlan caches the selected kernel per
+//! contraction descriptor, selection algorithm and workspace size, so that
+//! re-planning the same problem skips kernel selection. Least recently used
+//! entries are evicted once the capacity is reached.
+//! @param[in] handle Opaque handle holding hipTensor's library context.
+//! @param[in] numEntries Maximum number of cached plans. 0 disables the cache.
+//! @returns HIPTENSOR_STATUS_SUCCESS on success and an error code otherwise
+hiptensorStatus_t hiptensorHandleResizePlanCache(hiptensorHandle_t* handle,
+                                                 const uint32_t     numEntries);
+
+//! @brief Queries the contraction plan cache counters of the handle
+//! @param[in] handle Opaque handle holding hipTensor's library context.
+//! @param[out] stats Hit, miss and eviction counters, current size and capacity.
+//! @returns HIPTENSOR_STATUS_SUCCESS on success and an error code otherwise
+hiptensorStatus_t hiptensorHandleGetPlanCacheStats(const hiptensorHandle_t*   handle,
+                                                   hiptensorPlanCacheStats_t* stats);
+
+//! @brief Selects where the operations issued with the handle execute
+//! @details With @ref HIPTENSOR_BACKEND_HOST, hiptensorContraction,
+//! hiptensorPermutation and hiptensorReduction dispatch to the host solutions:
+//! all tensor and workspace pointers must be host pointers, the stream is
+//! ignored and the call returns once the result is written. Device checks
+//! are skipped, so the host backend works on systems without a HIP device.
+//! Contraction plans must be initialized with the same backend they run with.
+//! @param[in] handle Opaque handle holding hipTensor's library context.
+//! @param[in] backend Execution backend.
+//! @returns HIPTENSOR_STATUS_SUCCESS on success and an error code otherwise
+hiptensorStatus_t hiptensorHandleSetBackend(hiptensorHandle_t* handle, hiptensorBackend_t backend);
+
+//! @brief Queries the execution backend of the handle
+//! @param[in] handle Opaque handle holding hipTensor's library context.
+//! @param[out] backend Execution backend.
+//! @returns HIPTENSOR_STATUS_SUCCESS on success and an error code otherwise
+hiptensorStatus_t hiptensorHandleGetBackend(const hiptensorHandle_t* handle,
+                                            hiptensorBackend_t*      backend);
+
+//! @brief Replaces the allocator used for the internal allocations of the handle
+//! @details By default, the handle draws its scratch memory (e.g. the buffers
+//! used to time candidate kernels during plan initialization) from a caching
+//! pool over hipMalloc that keeps released blocks in size classes at most 25%
+//! larger than the request. Requests above the cache limit bypass the pool.
+//! Registered callbacks are used directly, without the pool, so that the
+//! library shares memory with the caller's own caching allocator.
+//! Passing nullptr for both callbacks restores the default pool.
+//! @param[in] handle Opaque handle holding hipTensor's library context.
+//! @param[in] allocFunc Device memory allocation callback.
+//! @param[in] freeFunc Device memory release callback.
+//! @param[in] userData Pointer passed back to both callbacks.
+//! @retval HIPTENSOR_STATUS_SUCCESS The operation completed successfully.
+//! @retval HIPTENSOR_STATUS_NOT_INITIALIZED if the handle is not initialized.
+//! @retval HIPTENSOR_STATUS_INVALID_VALUE if only one of the callbacks is nullptr.
+hiptensorStatus_t hiptensorSetAllocator(hiptensorHandle_t*   handle,
+                                        hiptensorAllocFunc_t allocFunc,
+                                        hiptensorFreeFunc_t  freeFunc,
+                                        void*                userData);
+
 //! @brief Initializes a tensor descriptor
 //! @param[in] handle Opaque handle holding hipTensor's library context.
 //! @param[out] desc Pointer to the allocated tensor descriptor object.
@@ -71,6 +128,8 @@ hiptensorStatus_t hiptensorInitTensorDescriptor(const hiptensorHandle_t*     han
 const char* hiptensorGetErrorString(const hiptensorStatus_t error);
 
 //! @brief Tensor permutation
+//! @details The strides of descA and descB are honored, so sub-views and tensors
+//! with padded leading dimensions are permuted without a packed copy.
 //! @param[in] handle Opaque handle holding hipTensor's library context.
 //! @param[in] alpha Scaling factor for A of the type typeScalar. Pointer to the host memory.
 //! If alpha is zero, A is not read and the corresponding unary operator is not applied.
@@ -97,6 +156,51 @@ hiptensorStatus_t hiptensorPermutation(const hiptensorHandle_t*           handle
                                        const hipDataType                  typeScalar,
                                        const hipStream_t                  stream);
 
+//! @brief Initializes a plan for the tensor permutation \f[ B = alpha * A \f]
+//! @details Validates the problem and selects its kernel once, so that
+//! @ref hiptensorPermutationExecute only patches in the data pointers and alpha.
+//! With HIPTENSOR_ALGO_DEFAULT the first kernel supporting the problem is selected.
+//! With HIPTENSOR_ALGO_DEFAULT_PATIENT the supporting kernels are timed on
+//! scratch buffers of the handle and the fastest one is selected.
+//! @param[in] handle Opaque handle holding hipTensor's library context.
+//! @param[out] plan Opaque handle holding the permutation plan.
+//! @param[in] descA A descriptor that holds information about the data type, modes, and strides of A.
+//! @param[in] modeA Array of size descA->numModes that holds the names of the modes of A.
+//! @param[in] descB A descriptor that holds information about the data type, modes, and strides of B.
+//! @param[in] modeB Array of size descB->numModes that holds the names of the modes of B
+//! @param[in] typeScalar data type of alpha
+//! @param[in] algo Kernel selection algorithm.
+//! @retval HIPTENSOR_STATUS_SUCCESS If a viable kernel has been found.
+//! @retval HIPTENSOR_STATUS_NOT_SUPPORTED if the combination of data types is not supported
+//! @retval HIPTENSOR_STATUS_INVALID_VALUE if the algorithm or data types have an illegal value
+//! @retval HIPTENSOR_STATUS_NOT_INITIALIZED if the handle, plan or a descriptor is not initialized.
+hiptensorStatus_t hiptensorInitPermutationPlan(const hiptensorHandle_t*           handle,
+                                               hiptensorPermutationPlan_t*        plan,
+                                               const hiptensorTensorDescriptor_t* descA,
+                                               const int32_t                      modeA[],
+                                               const hiptensorTensorDescriptor_t* descB,
+                                               const int32_t                      modeB[],
+                                               const hipDataType                  typeScalar,
+                                               const hiptensorAlgo_t              algo);
+
+//! @brief Computes the tensor permutation of a plan
+//! @param[in] handle Opaque handle holding hipTensor's library context.
+//! @param[in] plan Permutation plan initialized with the same backend as the handle.
+//! @param[in] alpha Scaling factor for A of the plan's typeScalar. Pointer to the host memory.
+//! @param[in] A Pointer to A's data in GPU-accessible memory.
+//! @param[out] B Pointer to B's data in GPU-accessible memory.
+//! @param[in] stream HIP stream to perform all operations.
+//! @retval HIPTENSOR_STATUS_SUCCESS The operation completed successfully without error
+//! @retval HIPTENSOR_STATUS_NOT_INITIALIZED if the handle or plan is not initialized.
+//! @retval HIPTENSOR_STATUS_INVALID_VALUE if a pointer is nullptr or the backends differ.
+//! @retval HIPTENSOR_STATUS_CK_ERROR if the kernel failed to launch.
+hiptensorStatus_t hiptensorPermutationExecute(const hiptensorHandle_t*          handle,
+                                              const hiptensorPermutationPlan_t* plan,
+                                              const void*                       alpha,
+                                              const void*                       A,
+                                              void*                             B,
+                                              const hipStream_t                 stream);
+
 //! @brief Computes the alignment requirement for a given pointer and descriptor.
 //! @param[in] handle Opaque handle holding hipTensor's library context.
 //! @param[in] ptr Pointer to the respective tensor data.
@@ -159,6 +263,8 @@ hiptensorStatus_t hiptensorInitContractionFind(const hiptensorHandle_t*    handl
                                                const hiptensorAlgo_t       algo);
 
 //! @brief Computes the size of workspace for a given tensor contraction
+//! @details Complex contractions carve their planar real / imaginary copies of the
+//! tensors out of the workspace, so it is required for complex data types.
 //! @param[in] handle Opaque handle holding hipTensor's library context.
 //! @param[in] desc Tensor contraction descriptor.
 //! @param[in] find Narrowed set of candidates for the contraction problem.
@@ -227,7 +333,108 @@ hiptensorStatus_t hiptensorContraction(const hiptensorHandle_t*          handle,
                                        uint64_t                          workspaceSize,
                                        hipStream_t                       stream);
 
+//! @brief Computes a batch of tensor contractions
+//! \f[ D_i = alpha * A_i * B_i + beta * C_i \f] for i in [0, batchCount)
+//! @details Every batch item is the problem the plan was initialized for, with
+//! its operands offset by i times the operand's batch stride. A batch stride of 0
+//! shares the operand between all items. If A or B is shared, the batch is folded
+//! into an extra mode of the problem and computed with a single kernel launch
+//! when the selected kernel supports it. Otherwise the items are launched in
+//! order on the stream and share the workspace.
+//! @param[in] handle Opaque handle holding hipTensor's library context.
+//! @param[in] plan Opaque handle holding the contraction plan of a single item.
+//! @param[in] alpha Scaling parameter for A*B of data type 'typeCompute'.
+//! @param[in] A Pointer to A's data of the first item in device memory.
+//! @param[in] B Pointer to B's data of the first item in device memory.
+//! @param[in] beta Scaling parameter for C of data type 'typeCompute'.
+//! @param[in] C Pointer to C's data of the first item in device memory.
+//! @param[out] D Pointer to D's data of the first item in device memory.
+//! @param[in] batchCount Number of contractions.
+//! @param[in] strideA Offset (in elements) between the A operands of consecutive items.
+//! @param[in] strideB Offset (in elements) between the B operands of consecutive items.
+//! @param[in] strideC Offset (in elements) between the C operands of consecutive items.
+//! @param[in] strideD Offset (in elements) between the D operands of consecutive items.
+//! @param[out] workspace Workspace pointer in device memory
+//! @param[in] workspaceSize Available workspace size.
+//! @param[in] stream HIP stream to perform all operations.
+//! @retval HIPTENSOR_STATUS_SUCCESS Successful completion of the operation.
+//! @retval HIPTENSOR_STATUS_NOT_INITIALIZED if the handle or plan are not initialized.
+//! @retval HIPTENSOR_STATUS_INVALID_VALUE if a pointer is nullptr, batchCount is 0,
+//! a stride is negative or strideD is 0 with more than one item.
+hiptensorStatus_t hiptensorContractionStridedBatched(const hiptensorHandle_t*          handle,
+                                                     const hiptensorContractionPlan_t* plan,
+                                                     const void*                       alpha,
+                                                     const void*                       A,
+                                                     const void*                       B,
+                                                     const void*                       beta,
+                                                     const void*                       C,
+                                                     void*                             D,
+                                                     uint32_t                          batchCount,
+                                                     int64_t                           strideA,
+                                                     int64_t                           strideB,
+                                                     int64_t                           strideC,
+                                                     int64_t                           strideD,
+                                                     void*                             workspace,
+                                                     uint64_t workspaceSize,
+                                                     hipStream_t                       stream);
+
+//! @brief Computes a group of tensor contractions of arbitrary shapes
+//! @details Every entry is computed as by @ref hiptensorContraction with its own
+//! plan, pointers and scalars, and each plan re-uses its kernel argument while its
+//! pointers and scalars are unchanged. All entries are validated before anything
+//! is launched. Entries run in submission order on the stream and share the
+//! workspace, which must be large enough for every plan, so an entry may read the
+//! output of an earlier one. Consecutive entries whose plans selected the same
+//! kernel form a group: with @ref HIPTENSOR_LOG_LEVEL_PERF_TRACE the time and
+//! throughput of each group are logged, and performance statistics record one
+//! sample per group.
+//! @param[in] handle Opaque handle holding hipTensor's library context.
+//! @param[in] entries Plans, data pointers and scalars of the contractions.
+//! @param[in] numEntries Number of entries.
+//! @param[out] workspace Workspace pointer in device memory
+//! @param[in] workspaceSize Available workspace size.
+//! @param[in] stream HIP stream to perform all operations.
+//! @retval HIPTENSOR_STATUS_SUCCESS Successful completion of the operation.
+//! @retval HIPTENSOR_STATUS_NOT_INITIALIZED if the handle or a plan is not initialized.
+//! @retval HIPTENSOR_STATUS_INVALID_VALUE if entries or a required pointer is nullptr.
+//! @retval HIPTENSOR_STATUS_INSUFFICIENT_WORKSPACE if a plan needs more workspace.
+hiptensorStatus_t hiptensorContractionGrouped(const hiptensorHandle_t*                handle,
+                                              const hiptensorContractionGroupEntry_t* entries,
+                                              uint32_t                                numEntries,
+                                              void*                                   workspace,
+                                              uint64_t                                workspaceSize,
+                                              hipStream_t                             stream);
+
+//! @brief Loads a kernel selection cache file.
+//! @details Entries in the file map contraction problems to the kernel that won
+//! selection for them on a given device architecture. On a cache hit,
+//! @ref hiptensorInitContractionPlan skips timing the candidates. The file name
+//! is also remembered as the destination for newly found winners, which are
+//! written back at shutdown. The cache may alternatively be given via the
+//! HIPTENSOR_SELECTION_CACHE environment variable at @ref hiptensorCreate.
+//! @param[in] handle Opaque handle holding hipTensor's library context.
+//! @param[in] filename Path to the cache file.
+//! @retval HIPTENSOR_STATUS_SUCCESS if the operation completed successfully.
+//! @retval HIPTENSOR_STATUS_NOT_INITIALIZED if the handle or filename is not initialized.
+//! @retval HIPTENSOR_STATUS_IO_ERROR if the file does not exist, cannot be read
+//! or was written by an incompatible version.
+hiptensorStatus_t hiptensorContractionSelectionCacheLoad(const hiptensorHandle_t* handle,
+                                                         const char*              filename);
+
+//! @brief Writes the kernel selection cache to a file.
+//! @param[in] handle Opaque handle holding hipTensor's library context.
+//! @param[in] filename Path to the cache file. If nullptr, the last loaded file is used.
+//! @retval HIPTENSOR_STATUS_SUCCESS if the operation completed successfully.
+//! @retval HIPTENSOR_STATUS_NOT_INITIALIZED if the handle is not initialized.
+//! @retval HIPTENSOR_STATUS_INVALID_VALUE if no file name is available.
+//! @retval HIPTENSOR_STATUS_IO_ERROR if the file cannot be written.
+hiptensorStatus_t hiptensorContractionSelectionCacheWrite(const hiptensorHandle_t* handle,
+                                                          const char*              filename);
+
 //! @brief Implements a tensor reduction of the form \f[ D = alpha * opReduce(opA(A)) + beta * opC(C) \f]
+//! @details The call is asynchronous with respect to the host. If C and D differ
+//! and beta is nonzero, C is copied into D on the given stream ahead of the
+//! kernel; if beta is zero, neither C nor D is read.
 //!
 //! @param[in] handle Opaque handle holding hipTensor's library context.
 //! @param[in] alpha Scaling for A; its data type is determined by 'typeCompute'. Pointer to the host memory.
@@ -245,7 +452,9 @@ hiptensorStatus_t hiptensorContraction(const hiptensorHandle_t*          handle,
 //! @param[in] typeCompute All arithmetic is performed using this data type (i.e., it affects the accuracy and performance).
 //! @param[out] workspace Scratchpad (device) memory; the workspace must be aligned to 128 bytes.
 //! @param[in] workspaceSize Please use hiptensorReductionGetWorkspaceSize() to query the required workspace.
-//!            While lower values, including zero, are valid, they may lead to grossly suboptimal performance.
+//!            While lower values, including zero, are valid, they may lead to grossly suboptimal performance:
+//!            reductions of a long extent into few elements of D are split into two passes only if the
+//!            workspace holds the partial results.
 //! @param[in] stream The CUDA stream in which all the computation is performed.
 //! @retval HIPTENSOR_STATUS_NOT_SUPPORTED if operation is not supported.
 //! @retval HIPTENSOR_STATUS_INVALID_VALUE if some input data is invalid (this typically indicates an user error).
@@ -271,6 +480,8 @@ hiptensorStatus_t hiptensorReduction(const hiptensorHandle_t*           handle,
                                      hipStream_t                        stream);
 
 //! @brief Determines the required workspaceSize for a given tensor reduction (see \ref hiptensorReduction)
+//! @details The size is zero if the reduction runs in a single pass. Otherwise it holds the
+//! partial results of the first pass, in the data type of D.
 //! @param[in] handle Opaque handle holding hipTensor's library context.
 //! @param[in] A same as in hiptensorReduction
 //! @param[in] descA same as in hiptensorReduction
@@ -285,7 +496,7 @@ hiptensorStatus_t hiptensorReduction(const hiptensorHandle_t*           handle,
 //! @param[in] typeCompute same as in hiptensorReduction
 //! @param[out] workspaceSize The workspace size (in bytes) that is required for the given tensor reduction.
 //! @retval HIPTENSOR_STATUS_SUCCESS The operation completed successfully.
-//! @retval HIPTENSOR_STATUS_NOT_INITIALIZED if the handle is not initialized.
+//! @retval HIPTENSOR_STATUS_NOT_INITIALIZED if handle, descA, modeA, descD or workspaceSize is nullptr.
 //! @retval HIPTENSOR_STATUS_INVALID_VALUE if some input data is invalid (this typically indicates an user error).
 hiptensorStatus_t hiptensorReductionGetWorkspaceSize(const hiptensorHandle_t*           handle,
                                                      const void*                        A,
@@ -301,6 +512,92 @@ hiptensorStatus_t hiptensorReductionGetWorkspaceSize(const hiptensorHandle_t*
                                                      hiptensorComputeType_t             typeCompute,
                                                      uint64_t* workspaceSize);
 
+//! @brief Initializes a plan for the tensor reduction \f[ D = alpha * opReduce(A) + beta * C \f]
+//! @details Validates the problem and selects its kernels once, so that
+//! @ref hiptensorReductionExecute only patches in the data pointers and scalars.
+//! With HIPTENSOR_ALGO_DEFAULT the kernels whose loads are vectorized along the
+//! fastest-varying mode of A are tried first, and the first one supporting the problem
+//! is selected. A two-pass reduction is preferred if its workspace fits workspaceSizeLimit.
+//! With HIPTENSOR_ALGO_DEFAULT_PATIENT the supporting kernels are timed on scratch
+//! buffers of the handle, and the fastest of the single-pass and two-pass reductions is selected.
+//! @param[in] handle Opaque handle holding hipTensor's library context.
+//! @param[out] plan Opaque handle holding the reduction plan.
+//! @param[in] descA same as in hiptensorReduction
+//! @param[in] modeA same as in hiptensorReduction
+//! @param[in] descC same as in hiptensorReduction
+//! @param[in] modeC same as in hiptensorReduction
+//! @param[in] descD same as in hiptensorReduction
+//! @param[in] modeD same as in hiptensorReduction
+//! @param[in] opReduce same as in hiptensorReduction
+//! @param[in] typeCompute same as in hiptensorReduction
+//! @param[in] algo Kernel selection algorithm.
+//! @param[in] workspaceSizeLimit Largest workspace (in bytes) the plan may require; see
+//! hiptensorReductionGetWorkspaceSize(). The plan's requirement is in plan->mWorkspaceSize.
+//! @retval HIPTENSOR_STATUS_SUCCESS If a viable kernel has been found.
+//! @retval HIPTENSOR_STATUS_NOT_SUPPORTED if the combination of data types or modes is not supported
+//! @retval HIPTENSOR_STATUS_INVALID_VALUE if the algorithm has an illegal value
+//! @retval HIPTENSOR_STATUS_NOT_INITIALIZED if the handle, plan, modeA or a descriptor is not initialized.
+//! @retval HIPTENSOR_STATUS_ALLOC_FAILED if the scratch buffers for timing cannot be allocated.
+hiptensorStatus_t hiptensorInitReductionPlan(const hiptensorHandle_t*           handle,
+                                             hiptensorReductionPlan_t*          plan,
+                                             const hiptensorTensorDescriptor_t* descA,
+                                             const int32_t                      modeA[],
+                                             const hiptensorTensorDescriptor_t* descC,
+                                             const int32_t                      modeC[],
+                                             const hiptensorTensorDescriptor_t* descD,
+                                             const int32_t                      modeD[],
+                                             hiptensorOperator_t                opReduce,
+                                             hiptensorComputeType_t             typeCompute,
+                                             const hiptensorAlgo_t              algo,
+                                             uint64_t                           workspaceSizeLimit);
+
+//! @brief Computes the tensor reduction of a plan
+//! @details The call is asynchronous with respect to the host, as hiptensorReduction().
+//! @param[in] handle Opaque handle holding hipTensor's library context.
+//! @param[in] plan Reduction plan initialized with the same backend as the handle.
+//! @param[in] alpha same as in hiptensorReduction
+//! @param[in] A same as in hiptensorReduction
+//! @param[in] beta same as in hiptensorReduction
+//! @param[in] C same as in hiptensorReduction
+//! @param[out] D same as in hiptensorReduction
+//! @param[out] workspace Scratchpad memory of at least plan->mWorkspaceSize bytes, aligned to 128 bytes.
+//! @param[in] workspaceSize Size (in bytes) of workspace.
+//! @param[in] stream HIP stream to perform all operations.
+//! @retval HIPTENSOR_STATUS_SUCCESS The operation completed successfully without error
+//! @retval HIPTENSOR_STATUS_NOT_INITIALIZED if the handle or plan is not initialized.
+//! @retval HIPTENSOR_STATUS_INVALID_VALUE if a pointer is nullptr or the backends differ.
+//! @retval HIPTENSOR_STATUS_INSUFFICIENT_WORKSPACE if workspace is smaller than the plan requires.
+//! @retval HIPTENSOR_STATUS_CK_ERROR if a kernel failed to launch.
+hiptensorStatus_t hiptensorReductionExecute(const hiptensorHandle_t*        handle,
+                                            const hiptensorReductionPlan_t* plan,
+                                            const void*                     alpha,
+                                            const void*                     A,
+                                            const void*                     beta,
+                                            const void*                     C,
+                                            void*                           D,
+                                            void*                           workspace,
+                                            uint64_t                        workspaceSize,
+                                            hipStream_t                     stream);
+
+//! @brief Returns aggregated execution statistics as a JSON document.
+//! @details Statistics are kept per API, kernel id and problem signature: call count,
+//! total/min/max/p50/p99 time in ms, TFlops and GB/s. They are collected when the
+//! environment sets HIPTENSOR_PERF_STATS=1, or for calls timed under
+//! HIPTENSOR_LOG_LEVEL_PERF_TRACE. Device launches are timed with stream events and
+//! are not synchronized per call; this function waits for outstanding launches.
+//! @param[out] json Receives the NUL-terminated JSON document. May be nullptr to
+//! only query the required size.
+//! @param[in,out] jsonSize On input, the size of json in bytes. On output, the
+//! size required to hold the document.
+//! @retval HIPTENSOR_STATUS_SUCCESS if the operation completed successfully.
+//! @retval HIPTENSOR_STATUS_INVALID_VALUE if jsonSize is nullptr.
+//! @retval HIPTENSOR_STATUS_INSUFFICIENT_WORKSPACE if json is too small for the document.
+hiptensorStatus_t hiptensorGetPerfStats(char* json, uint64_t* jsonSize);
+
+//! @brief Clears all execution statistics collected so far.
+//! @retval HIPTENSOR_STATUS_SUCCESS if the operation completed successfully.
+hiptensorStatus_t hiptensorResetPerfStats();
+
 //! @brief Registers a callback function that will be invoked by logger calls.
 //! @param[in] callback This parameter is the callback function pointer provided to the logger.
 //! @retval HIPTENSOR_STATUS_SUCCESS if the operation completed successfully.
@@ -333,6 +630,17 @@ hiptensorStatus_t hiptensorLoggerSetLevel(hiptensorLogLevel_t level);
 //! @retval HIPTENSOR_STATUS_INVALID_VALUE if the given log mask is invalid.
 hiptensorStatus_t hiptensorLoggerSetMask(int32_t mask);
 
+//! @brief Selects synchronous or asynchronous logger output.
+//! @details Switching back to HIPTENSOR_LOG_MODE_SYNC writes any queued messages first.
+//! @param[in] mode This parameter is the logger output mode to be enforced.
+//! @retval HIPTENSOR_STATUS_SUCCESS if the operation completed successfully.
+//! @retval HIPTENSOR_STATUS_INVALID_VALUE if the given mode is invalid.
+hiptensorStatus_t hiptensorLoggerSetMode(hiptensorLogMode_t mode);
+
+//! @brief Writes out every message logged before the call and flushes the logger file.
+//! @retval HIPTENSOR_STATUS_SUCCESS if the operation completed successfully.
+hiptensorStatus_t hiptensorLoggerFlush();
+
 //! @brief Disables logging.
 //! @retval HIPTENSOR_STATUS_SUCCESS if the operation completed successfully.
 hiptensorStatus_t hiptensorLoggerForceDisable();
@@ -123,7 +123,9 @@ typedef enum
 //! @brief Tensor contraction kernel selection algorithm
 typedef enum
 {
-    //! Uses novel actor-critic selection model
+    //! Uses the kernel selection model, a table of rules over the problem's features
+    //! (built-in, or loaded from HIPTENSOR_SELECTION_MODEL at @ref hiptensorCreate),
+    //! and times the candidates like HIPTENSOR_ALGO_DEFAULT if no rule applies
     HIPTENSOR_ALGO_ACTOR_CRITIC = -8,
     //! Lets the internal heuristic choose
     HIPTENSOR_ALGO_DEFAULT = -1,
@@ -144,6 +146,18 @@ typedef enum
 
 } hiptensorWorksizePreference_t;
 
+//! @brief Execution backend of a handle
+//! @details The default is taken from the HIPTENSOR_BACKEND environment
+//! variable ("device" or "host"), falling back to the HIP device.
+typedef enum
+{
+    //! Kernels run on the handle's HIP device over device pointers
+    HIPTENSOR_BACKEND_DEVICE = 0,
+    //! Host solutions run over host pointers; no HIP device is required
+    HIPTENSOR_BACKEND_HOST = 1,
+
+} hiptensorBackend_t;
+
 //! @brief Logging context
 //! @details The logger output of certain contexts maybe constrained to these levels
 typedef enum
@@ -163,6 +177,21 @@ typedef enum
 
 } hiptensorLogLevel_t;
 
+//! @brief Logger output mode
+//! @details In the async modes the calling thread only copies the message into a
+//! bounded lock-free queue; a background thread writes queued messages to the
+//! logger file and callback.
+typedef enum
+{
+    //! Messages are written by the calling thread
+    HIPTENSOR_LOG_MODE_SYNC = 0,
+    //! Messages are queued; when the queue is full new messages are dropped and counted
+    HIPTENSOR_LOG_MODE_ASYNC_DROP = 1,
+    //! Messages are queued; when the queue is full the caller waits for space
+    HIPTENSOR_LOG_MODE_ASYNC_BLOCK = 2,
+
+} hiptensorLogMode_t;
+
 //! @brief hipTensor's library context
 struct hiptensorHandle_t
 {
@@ -224,6 +253,82 @@ struct hiptensorContractionPlan_t
     void* mSolution;
     //! Contraction parameters
     hiptensorContractionDescriptor_t mContractionDesc;
+    //! Normalized and validated kernel arguments of the solution (opaque)
+    std::shared_ptr<void> mArgs;
+    //! Modes looped over outside of the kernel, for problems above its rank (opaque)
+    std::shared_ptr<void> mSplit;
+    //! Backend of the handle the plan was initialized with
+    hiptensorBackend_t mBackend;
+};
+
+//! @brief hipTensor structure representing a permutation plan.
+//! Constructed with the hiptensorInitPermutationPlan() function.
+struct hiptensorPermutationPlan_t
+{
+    //! Selected solution
+    void* mSolution;
+    //! Validated kernel arguments of the solution (opaque)
+    std::shared_ptr<void> mArgs;
+    //! Modes looped over outside of the kernel, for problems above its rank (opaque)
+    std::shared_ptr<void> mSplit;
+    //! Backend of the handle the plan was initialized with
+    hiptensorBackend_t mBackend;
+};
+
+//! @brief hipTensor structure representing a reduction plan.
+//! Constructed with the hiptensorInitReductionPlan() function.
+struct hiptensorReductionPlan_t
+{
+    //! Selected solutions; the second one is only set for two-pass reductions
+    void* mSolutions[2];
+    //! Validated kernel arguments of the solutions (opaque)
+    std::shared_ptr<void> mArgs[2];
+    //! Modes looped over outside of the kernels, for problems above their rank (opaque)
+    std::shared_ptr<void> mSplit;
+    //! Workspace size (in bytes) that hiptensorReductionExecute() requires
+    uint64_t mWorkspaceSize;
+    //! Size (in bytes) of the element space of D, that C is copied to
+    uint64_t mSizeD;
+    //! Data type of alpha and beta
+    hiptensorComputeType_t mTypeCompute;
+    //! Backend of the handle the plan was initialized with
+    hiptensorBackend_t mBackend;
+};
+
+//! @brief One problem of a grouped contraction.
+//! Submitted with the hiptensorContractionGrouped() function.
+struct hiptensorContractionGroupEntry_t
+{
+    //! Contraction plan of the problem
+    const hiptensorContractionPlan_t* mPlan;
+    //! Scaling parameter for A*B of data type 'typeCompute'
+    const void* mAlpha;
+    //! Pointer to A's data
+    const void* mA;
+    //! Pointer to B's data
+    const void* mB;
+    //! Scaling parameter for C of data type 'typeCompute'
+    const void* mBeta;
+    //! Pointer to C's data
+    const void* mC;
+    //! Pointer to D's data
+    void* mD;
+};
+
+//! @brief Counters of the contraction plan cache held by a handle.
+//! Queried with the hiptensorHandleGetPlanCacheStats() function.
+struct hiptensorPlanCacheStats_t
+{
+    //! Plans served from the cache
+    uint64_t mHits;
+    //! Plans that required kernel selection
+    uint64_t mMisses;
+    //! Entries dropped to respect the capacity
+    uint64_t mEvictions;
+    //! Current number of cached plans
+    uint32_t mSize;
+    //! Maximum number of cached plans
+    uint32_t mCapacity;
 };
 
 //! @brief Logging callback
@@ -235,4 +340,18 @@ typedef void (*hiptensorLoggerCallback_t)(int32_t     logContext,
                                           const char* funcName,
                                           const char* msg);
 
+//! @brief Memory allocation callback
+//! Registered with hiptensorSetAllocator() and used for every device allocation
+//! the library makes internally.
+//! @param size Number of bytes to allocate
+//! @param userData The user pointer registered with the callback
+//! @returns Pointer to the allocated memory, or nullptr on failure
+typedef void* (*hiptensorAllocFunc_t)(size_t size, void* userData);
+
+//! @brief Memory release callback
+//! @param ptr Pointer previously returned by the matching hiptensorAllocFunc_t
+//! @param size Number of bytes requested at allocation
+//! @param userData The user pointer registered with the callback
+typedef void (*hiptensorFreeFunc_t)(void* ptr, size_t size, void* userData);
+
 #endif // HIPTENSOR_TYPES_HPP
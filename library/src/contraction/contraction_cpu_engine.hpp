@@ -0,0 +1,301 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef HIPTENSOR_CONTRACTION_CPU_ENGINE_HPP
+#define HIPTENSOR_CONTRACTION_CPU_ENGINE_HPP
+
+// Std includes
+#include <algorithm>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+// CK includes
+#include <element_wise_operation.hpp>
+
+#include "device/device_element_wise_operation_complex.hpp"
+#include "thread_pool.hpp"
+
+namespace hiptensor
+{
+    namespace detail
+    {
+        // Offsets into a tensor of every flattened index over a group of its modes,
+        // with the first mode fastest. Folding the M, N and K groups this way turns
+        // any contraction into E[m, n] = sum_k A[m, k] * B[n, k].
+        inline std::vector<std::size_t>
+            foldModes(ck::index_t const* lengths, ck::index_t const* strides, uint32_t count)
+        {
+            std::size_t size = 1;
+            for(uint32_t i = 0; i < count; i++)
+            {
+                size *= lengths[i];
+            }
+
+            auto offsets = std::vector<std::size_t>(size);
+            for(std::size_t index = 0; index < size; index++)
+            {
+                std::size_t offset = 0;
+                std::size_t rem    = index;
+                for(uint32_t i = 0; i < count; i++)
+                {
+                    offset += (rem % lengths[i]) * strides[i];
+                    rem /= lengths[i];
+                }
+                offsets[index] = offset;
+            }
+            return offsets;
+        }
+
+    } // namespace detail
+
+    // Blocked, multi-threaded host contraction on the normalized arguments of
+    // ReferenceContraction_M2_N2_K2. M, N and K modes are folded into a GEMM,
+    // tiles of E are spread over the ThreadPool and each tile packs contiguous
+    // panels of A and B so that the inner loop runs unit-stride over n.
+    template <ck::index_t NumDimM,
+              ck::index_t NumDimN,
+              ck::index_t NumDimK,
+              typename ADataType,
+              typename BDataType,
+              typename AccDataType,
+              typename EDataType,
+              typename ComputeDataType,
+              typename Argument>
+    void contractionCpuEngine(Argument const& arg)
+    {
+        using CDEElementwiseOperation = decltype(Argument::mOpCDE);
+
+        constexpr auto NumDTensor = std::tuple_size_v<decltype(Argument::mD)>;
+        constexpr bool IsComplex  = (std::is_same_v<ADataType, hipFloatComplex>
+                                    && std::is_same_v<BDataType, hipFloatComplex>
+                                    && std::is_same_v<EDataType, hipFloatComplex>)
+                                   || (std::is_same_v<ADataType, hipDoubleComplex>
+                                       && std::is_same_v<BDataType, hipDoubleComplex>
+                                       && std::is_same_v<EDataType, hipDoubleComplex>);
+
+        using AccT = std::conditional_t<IsComplex, HIP_vector_type<AccDataType, 2>, AccDataType>;
+
+        // Tile sizes keep the packed panels and accumulators within L2
+        constexpr std::size_t TileM = 32;
+        constexpr std::size_t TileN = 64;
+        constexpr std::size_t TileK = 128;
+
+        auto const* aLengths = arg.mA_ms_ks_lengths.data();
+        auto const* aStrides = arg.mA_ms_ks_strides.data();
+        auto const* bLengths = arg.mB_ns_ks_lengths.data();
+        auto const* bStrides = arg.mB_ns_ks_strides.data();
+        auto const* eLengths = arg.mE_ms_ns_lengths.data();
+        auto const* eStrides = arg.mE_ms_ns_strides.data();
+
+        auto aOffsetsM = detail::foldModes(aLengths, aStrides, NumDimM);
+        auto aOffsetsK = detail::foldModes(aLengths + NumDimM, aStrides + NumDimM, NumDimK);
+        auto bOffsetsN = detail::foldModes(bLengths, bStrides, NumDimN);
+        auto bOffsetsK = detail::foldModes(bLengths + NumDimN, bStrides + NumDimN, NumDimK);
+        auto eOffsetsM = detail::foldModes(eLengths, eStrides, NumDimM);
+        auto eOffsetsN = detail::foldModes(eLengths + NumDimM, eStrides + NumDimM, NumDimN);
+
+        // NumDTensor is at most 1 due to SFINAE of the reference op
+        std::vector<std::size_t> dOffsetsM, dOffsetsN;
+        if constexpr(NumDTensor > 0)
+        {
+            auto const* dLengths = arg.mD_ms_ns_lengths[0].data();
+            auto const* dStrides = arg.mD_ms_ns_strides[0].data();
+            dOffsetsM            = detail::foldModes(dLengths, dStrides, NumDimM);
+            dOffsetsN = detail::foldModes(dLengths + NumDimM, dStrides + NumDimM, NumDimN);
+        }
+
+        auto const* a = (ADataType const*)arg.mA;
+        auto const* b = (BDataType const*)arg.mB;
+        auto*       e = (EDataType*)arg.mE;
+
+        auto loadA = [&](std::size_t index) {
+            AccT value;
+            if constexpr(IsComplex)
+            {
+                value = a[index];
+            }
+            else
+            {
+                arg.mOpA(value, ck::type_convert<ComputeDataType>(a[index]));
+            }
+            return value;
+        };
+
+        auto loadB = [&](std::size_t index) {
+            AccT value;
+            if constexpr(IsComplex)
+            {
+                value = b[index];
+            }
+            else
+            {
+                arg.mOpB(value, ck::type_convert<ComputeDataType>(b[index]));
+            }
+            return value;
+        };
+
+        auto store = [&](std::size_t m, std::size_t n, AccT const& accum) {
+            auto indexE = eOffsetsM[m] + eOffsetsN[n];
+
+            if constexpr(IsComplex)
+            {
+                if constexpr(std::is_same_v<CDEElementwiseOperation,
+                                            ck::tensor_operation::element_wise::Scale>)
+                {
+                    e[indexE] = arg.mOpCDE.scale_ * (EDataType)accum;
+                }
+                else if constexpr(std::is_same_v<CDEElementwiseOperation,
+                                                 ck::tensor_operation::element_wise::ScaleComplex>)
+                {
+                    if constexpr(std::is_same_v<EDataType, hipFloatComplex>)
+                    {
+                        e[indexE] = hipCmulf(hipComplexDoubleToFloat(arg.mOpCDE.scale_),
+                                             (EDataType)accum);
+                    }
+                    else
+                    {
+                        e[indexE] = hipCmul(arg.mOpCDE.scale_, (EDataType)accum);
+                    }
+                }
+                else if constexpr(std::is_same_v<CDEElementwiseOperation,
+                                                 ck::tensor_operation::element_wise::Bilinear>)
+                {
+                    auto const* d = (EDataType const*)arg.mD[0];
+                    e[indexE]     = arg.mOpCDE.alpha_ * (EDataType)accum
+                                + arg.mOpCDE.beta_ * d[dOffsetsM[m] + dOffsetsN[n]];
+                }
+                else if constexpr(std::is_same_v<
+                                      CDEElementwiseOperation,
+                                      ck::tensor_operation::element_wise::BilinearComplex>)
+                {
+                    auto const* d = (EDataType const*)arg.mD[0];
+                    if constexpr(std::is_same_v<EDataType, hipFloatComplex>)
+                    {
+                        e[indexE] = hipCaddf(
+                            hipCmulf(hipComplexDoubleToFloat(arg.mOpCDE.alpha_), (EDataType)accum),
+                            hipCmulf(hipComplexDoubleToFloat(arg.mOpCDE.beta_),
+                                     d[dOffsetsM[m] + dOffsetsN[n]]));
+                    }
+                    else
+                    {
+                        e[indexE]
+                            = hipCadd(hipCmul(arg.mOpCDE.alpha_, (EDataType)accum),
+                                      hipCmul(arg.mOpCDE.beta_, d[dOffsetsM[m] + dOffsetsN[n]]));
+                    }
+                }
+            }
+            else if constexpr(std::is_same_v<CDEElementwiseOperation,
+                                             ck::tensor_operation::element_wise::Scale>)
+            {
+                arg.mOpCDE(e[indexE], ck::type_convert<EDataType>(accum));
+            }
+            else // bilinear
+            {
+                auto const* d = (EDataType const*)arg.mD[0];
+                arg.mOpCDE(e[indexE],
+                           ck::type_convert<EDataType>(accum),
+                           d[dOffsetsM[m] + dOffsetsN[n]]);
+            }
+        };
+
+        auto const sizeM  = aOffsetsM.size();
+        auto const sizeN  = bOffsetsN.size();
+        auto const sizeK  = aOffsetsK.size();
+        auto const tilesM = (sizeM + TileM - 1) / TileM;
+        auto const tilesN = (sizeN + TileN - 1) / TileN;
+
+        ThreadPool::instance()->parallelFor(tilesM * tilesN, [&](std::size_t tile) {
+            auto const m0 = (tile % tilesM) * TileM;
+            auto const n0 = (tile / tilesM) * TileN;
+            auto const mt = std::min(TileM, sizeM - m0);
+            auto const nt = std::min(TileN, sizeN - n0);
+
+            auto accum  = std::vector<AccT>(TileM * TileN, AccT{0});
+            auto panelA = std::vector<AccT>(TileM * TileK);
+            auto panelB = std::vector<AccT>(TileK * TileN);
+
+            for(std::size_t k0 = 0; k0 < sizeK; k0 += TileK)
+            {
+                auto const kt = std::min(TileK, sizeK - k0);
+
+                // Pack A as [m][k] and B as [k][n], applying the element-wise ops once
+                for(std::size_t m = 0; m < mt; m++)
+                {
+                    for(std::size_t k = 0; k < kt; k++)
+                    {
+                        panelA[m * TileK + k] = loadA(aOffsetsM[m0 + m] + aOffsetsK[k0 + k]);
+                    }
+                }
+                for(std::size_t k = 0; k < kt; k++)
+                {
+                    for(std::size_t n = 0; n < nt; n++)
+                    {
+                        panelB[k * TileN + n] = loadB(bOffsetsN[n0 + n] + bOffsetsK[k0 + k]);
+                    }
+                }
+
+                for(std::size_t m = 0; m < mt; m++)
+                {
+                    auto* acc = accum.data() + m * TileN;
+                    for(std::size_t k = 0; k < kt; k++)
+                    {
+                        auto const  valA = panelA[m * TileK + k];
+                        auto const* valB = panelB.data() + k * TileN;
+
+                        // Mult / accum
+                        for(std::size_t n = 0; n < nt; n++)
+                        {
+                            if constexpr(std::is_same_v<AccT, hipFloatComplex>)
+                            {
+                                acc[n] = hipCaddf(acc[n], hipCmulf(valA, valB[n]));
+                            }
+                            else if constexpr(std::is_same_v<AccT, hipDoubleComplex>)
+                            {
+                                acc[n] = hipCadd(acc[n], hipCmul(valA, valB[n]));
+                            }
+                            else
+                            {
+                                acc[n] += valA * valB[n];
+                            }
+                        }
+                    }
+                }
+            }
+
+            for(std::size_t m = 0; m < mt; m++)
+            {
+                for(std::size_t n = 0; n < nt; n++)
+                {
+                    store(m0 + m, n0 + n, accum[m * TileN + n]);
+                }
+            }
+        });
+    }
+
+} // namespace hiptensor
+
+#endif // HIPTENSOR_CONTRACTION_CPU_ENGINE_HPP
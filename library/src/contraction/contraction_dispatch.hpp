@@ -0,0 +1,129 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef HIPTENSOR_CONTRACTION_DISPATCH_HPP
+#define HIPTENSOR_CONTRACTION_DISPATCH_HPP
+
+#include <algorithm>
+#include <vector>
+
+#include <hiptensor/hiptensor_types.hpp>
+
+#include "contraction_meta_traits.hpp"
+#include "data_types.hpp"
+#include "mode_coalescing.hpp"
+
+namespace hiptensor
+{
+    // Operands of a contraction descriptor, in the order A, B, D, then C if it is not a
+    // placeholder. C shares the modes of D.
+    inline std::vector<TensorOperand> toOperands(hiptensorContractionDescriptor_t const& desc)
+    {
+        std::vector<TensorOperand> operands = {{desc.mTensorDesc[0], desc.mTensorMode[0]},
+                                               {desc.mTensorDesc[1], desc.mTensorMode[1]},
+                                               {desc.mTensorDesc[3], desc.mTensorMode[2]}};
+        if(desc.mTensorDesc[2].mType != NONE_TYPE)
+        {
+            operands.push_back({desc.mTensorDesc[2], desc.mTensorMode[2]});
+        }
+        return operands;
+    }
+
+    // The problem as dispatched. Runs of M, N, K or batch modes that are contiguous in
+    // memory in every operand are folded, so that it runs on kernels of lower rank, and the
+    // outer M and N modes that the kernels still cannot hold are looped over. K modes are
+    // summed over by the kernels, so at most MaxNumDimsK of them are supported.
+    inline hiptensorStatus_t makeDispatchProblem(hiptensorContractionDescriptor_t const& desc,
+                                                 hiptensorContractionDescriptor_t&       dispatch,
+                                                 ModeSplit&                              split)
+    {
+        auto operands = toOperands(desc);
+        coalesceModes(operands);
+
+        // M modes are in A and D, N modes in B and D, and K modes in A and B
+        auto holds = [&operands](int operand, int32_t mode) {
+            auto const& modes = operands[operand].mModes;
+            return std::find(modes.cbegin(), modes.cend(), mode) != modes.cend();
+        };
+
+        auto isOuter = [&holds](int32_t mode) {
+            return holds(2, mode) && !(holds(0, mode) && holds(1, mode));
+        };
+
+        auto isK = [&holds](int32_t mode) {
+            return holds(0, mode) && holds(1, mode) && !holds(2, mode);
+        };
+
+        // MaxNumDimsM == MaxNumDimsN
+        for(auto operand : {0, 1})
+        {
+            auto& tensor = operands[operand];
+            while(std::count_if(tensor.mModes.cbegin(), tensor.mModes.cend(), isOuter)
+                  > MaxNumDimsM)
+            {
+                auto pos = outermostMode(tensor, isOuter);
+                if(pos < 0)
+                {
+                    return HIPTENSOR_STATUS_NOT_SUPPORTED;
+                }
+                splitMode(operands, split, tensor.mModes[pos]);
+            }
+        }
+
+        auto const& modesA = operands[0].mModes;
+        if(std::count_if(modesA.cbegin(), modesA.cend(), isK) > MaxNumDimsK)
+        {
+            return HIPTENSOR_STATUS_NOT_SUPPORTED;
+        }
+
+        dispatch                = desc;
+        dispatch.mTensorDesc[0] = std::move(operands[0].mDesc);
+        dispatch.mTensorDesc[1] = std::move(operands[1].mDesc);
+        dispatch.mTensorDesc[3] = std::move(operands[2].mDesc);
+        if(operands.size() > 3)
+        {
+            dispatch.mTensorDesc[2] = std::move(operands[3].mDesc);
+        }
+        else
+        {
+            auto rankD                       = dispatch.mTensorDesc[3].mLengths.size();
+            dispatch.mTensorDesc[2].mLengths = std::vector<std::size_t>(rankD, 0);
+            dispatch.mTensorDesc[2].mStrides = std::vector<std::size_t>(rankD, 0);
+        }
+
+        for(auto i = 2u; i < dispatch.mTensorMode.size(); i++)
+        {
+            dispatch.mTensorMode[i] = operands[2].mModes;
+        }
+        dispatch.mTensorMode[0] = std::move(operands[0].mModes);
+        dispatch.mTensorMode[1] = std::move(operands[1].mModes);
+
+        return HIPTENSOR_STATUS_SUCCESS;
+    }
+
+} // namespace hiptensor
+
+#endif // HIPTENSOR_CONTRACTION_DISPATCH_HPP
@@ -119,22 +119,131 @@ namespace hiptensor
         }
     }
 
-    struct DeviceDeleter
+    /**
+     * \brief This function unpacks structured data (hipFloatComplex / hipDoubleComplex)
+     *        into real, imaginary and (real + imaginary) planes for 3M contractions.
+     */
+    template<typename InputType, typename OutputType>
+    __global__ void unpack3m(const InputType* in, OutputType* out_real, OutputType *out_img,
+                             OutputType* out_sum, int length)
     {
-        void operator()(void* ptr)
+        int idx = threadIdx.x + blockIdx.x * blockDim.x;
+
+        if(idx < length)
         {
-            CHECK_HIP_ERROR(hipFree(ptr));
+            auto real = in[idx].x;
+            auto imag = in[idx].y;
+            out_real[idx] = real;
+            out_img[idx] = imag;
+            out_sum[idx] = real + imag;
         }
-    };
+    }
+
+    /**
+     * \brief 3M combine step. The sub-contractions leave mE_real = Re(AB) and
+     *        mE_imag = Im(AB) - Re(AB), so Im(AB) is restored before the
+     *        E = accum * alpha + D * beta epilogue.
+     */
+    template <typename DataType>
+    __global__ void mfma3m(DataType* mE_real, DataType* mE_imag, DataType* mD_real, DataType* mD_imag,
+                           HIP_vector_type<DataType, 2> *mE_grid, HIP_vector_type<double, 2> alpha,
+                           HIP_vector_type<double, 2> beta, int length)
+    {
+        int idx = threadIdx.x + blockIdx.x * blockDim.x;
+
+        if(idx < length)
+        {
+            auto real = mE_real[idx];
+            auto imag = mE_imag[idx] + real;
+            if constexpr(std::is_same_v<DataType, float>)
+            {
+                mE_grid[idx] = hipCaddf(
+                                        hipCmulf(
+                                                make_hipFloatComplex(real, imag),
+                                                hipComplexDoubleToFloat(alpha)),
+                                        hipCmulf(
+                                                make_hipFloatComplex(mD_real[idx], mD_imag[idx]),
+                                                hipComplexDoubleToFloat(beta)));
+            }
+            else if constexpr(std::is_same_v<DataType, double>)
+            {
+                mE_grid[idx] = hipCadd(hipCmul(
+                                              make_hipDoubleComplex(real, imag),
+                                              alpha),
+                                       hipCmul(
+                                              make_hipDoubleComplex(mD_real[idx], mD_imag[idx]),
+                                              beta));
+           }
+        }
+    }
 
-    template<typename T>
-    auto allocDevice(int64_t numElements)
+    /**
+     * \brief 3M combine step for scale contractions: C = accum * alpha
+     *
+     */
+    template <typename DataType>
+    __global__ void multiply3m(DataType* mE_real, DataType* mE_imag, HIP_vector_type<DataType, 2> *mE_grid,
+                               HIP_vector_type<double, 2> alpha, int length)
     {
-        T* data;
-        CHECK_HIP_ERROR(hipMalloc(&data, numElements * sizeof(T)));
-        return std::unique_ptr<T, DeviceDeleter>(data, DeviceDeleter());
+        int idx = threadIdx.x + blockIdx.x * blockDim.x;
+
+        if(idx < length)
+        {
+            auto real = mE_real[idx];
+            auto imag = mE_imag[idx] + real;
+            if constexpr(std::is_same_v<DataType, float>)
+            {
+                mE_grid[idx] = hipCmulf(
+                                      make_hipFloatComplex(real, imag),
+                                      hipComplexDoubleToFloat(alpha));
+            }
+            else if constexpr(std::is_same_v<DataType, double>)
+            {
+                mE_grid[idx] = hipCmul(
+                                    make_hipDoubleComplex(real, imag),
+                                    alpha);
+           }
+        }
     }
 
+    /**
+     * \brief Carves aligned sub-buffers out of a caller-provided workspace, in order.
+     *        With a null workspace no pointers are produced, but the required size
+     *        is still accumulated.
+     */
+    struct WorkspaceCarver
+    {
+        static constexpr std::size_t Alignment = 256u;
+
+        explicit WorkspaceCarver(void* workspace)
+            : mBase(static_cast<char*>(workspace))
+            , mOffset(0u)
+        {
+        }
+
+        template <typename T>
+        T* carve(std::size_t numElements)
+        {
+            auto offset = mOffset;
+            mOffset += ceilDiv(numElements * sizeof(T), Alignment) * Alignment;
+            return mBase == nullptr ? nullptr : reinterpret_cast<T*>(mBase + offset);
+        }
+
+        std::size_t size() const
+        {
+            return mOffset;
+        }
+
+        void* remainder() const
+        {
+            return mBase == nullptr ? nullptr : mBase + mOffset;
+        }
+
+    private:
+        char*       mBase;
+        std::size_t mOffset;
+    };
+
 } // namespace hiptensor
 
 #endif // HIPTENSOR_CONTRACTION_PACK_UTIL_HPP
@@ -24,16 +24,10 @@
  *
  *******************************************************************************/
 
-#ifndef CHECK_HIP_ALLOC
-#define CHECK_HIP_ALLOC(status)               \
-    if(status != hipSuccess)                  \
-    {                                         \
-        return HIPTENSOR_STATUS_ALLOC_FAILED; \
-    }
-#endif
-
 #include "contraction_selection.hpp"
+#include "contraction_selection_model.hpp"
 #include "logger.hpp"
+#include "memory_pool.hpp"
 #include "performance.hpp"
 #include "util.hpp"
 
@@ -60,7 +54,11 @@ namespace hiptensor
                                       std::vector<std::size_t> const&          e_ms_ns_strides,
                                       std::vector<int32_t> const&              e_ms_ns_modes,
                                       hiptensorComputeType_t                   computeType,
-                                      const uint64_t                           workspaceSize)
+                                      const uint64_t                           workspaceSize,
+                                      Allocator&                               allocator,
+                                      std::vector<PerfMetrics>*                timings,
+                                      int32_t                                  coldIters,
+                                      int32_t                                  repeats)
     {
         // Make sure that we calculate full element space incase strides are not packed.
         auto sizeA = elementsFromLengths(a_ms_ks_lengths) * hipDataTypeSize(typeA);
@@ -72,8 +70,6 @@ namespace hiptensor
         }
         auto sizeE = elementsFromLengths(e_ms_ns_lengths) * hipDataTypeSize(typeE);
 
-        void *A_d, *B_d, *D_d, *E_d, *wspace;
-
         /*
          * `alpha` and `beta` are void pointer. hiptensor uses readVal to load the value of alpha.
          * ```
@@ -95,11 +91,24 @@ namespace hiptensor
             writeVal(&beta, computeType, ScalarData(computeType, 1.03));
         }
 
-        CHECK_HIP_ALLOC(hipMalloc(&A_d, sizeA));
-        CHECK_HIP_ALLOC(hipMalloc(&B_d, sizeB));
-        CHECK_HIP_ALLOC(hipMalloc(&D_d, sizeD));
-        CHECK_HIP_ALLOC(hipMalloc(&E_d, sizeE));
-        CHECK_HIP_ALLOC(hipMalloc(&wspace, workspaceSize));
+        // Released on every return path
+        ScopedBuffer bufferA(allocator, sizeA);
+        ScopedBuffer bufferB(allocator, sizeB);
+        ScopedBuffer bufferD(allocator, sizeD);
+        ScopedBuffer bufferE(allocator, sizeE);
+        ScopedBuffer bufferWspace(allocator, workspaceSize);
+
+        if(!bufferA.valid() || !bufferB.valid() || !bufferD.valid() || !bufferE.valid()
+           || !bufferWspace.valid())
+        {
+            return HIPTENSOR_STATUS_ALLOC_FAILED;
+        }
+
+        auto* A_d    = bufferA.get();
+        auto* B_d    = bufferB.get();
+        auto* D_d    = bufferD.get();
+        auto* E_d    = bufferE.get();
+        auto* wspace = bufferWspace.get();
 
         std::string          best_op_name;
         ContractionSolution* bestSolution = nullptr;
@@ -111,9 +120,19 @@ namespace hiptensor
             0,
         };
 
+        auto config = StreamConfig{
+            nullptr, // stream id
+            true, // time_kernel
+            0, // log_level
+            coldIters, // cold_niters
+            repeats, // nrepeat
+        };
+
         for(auto* solution : candidates)
         {
-            auto [errorCode, time] = (*solution)(&alpha,
+            ContractionArgs args;
+            auto [errorCode, time] = (*solution)(args,
+                                                 &alpha,
                                                  A_d,
                                                  B_d,
                                                  &beta,
@@ -133,14 +152,14 @@ namespace hiptensor
                                                  e_ms_ns_modes,
                                                  wspace,
                                                  workspaceSize,
-                                                 StreamConfig{nullptr, true});
+                                                 config);
             if(errorCode == HIPTENSOR_STATUS_SUCCESS && time > 0)
             {
                 // Make sure to time the kernels
                 int32_t m, n, k;
-                std::tie(m, n, k) = solution->problemDims();
+                std::tie(m, n, k) = args.problemDims();
                 auto flops        = std::size_t(2) * m * n * k;
-                auto bytes        = solution->problemBytes();
+                auto bytes        = args.mBytes;
 
                 PerfMetrics metrics = {
                     solution->uid(), // id
@@ -168,6 +187,11 @@ namespace hiptensor
                     logger->logHeuristics("BRUTE_FORCE_KERNEL_PERF", msg);
                 }
 
+                if(timings != nullptr)
+                {
+                    timings->push_back(metrics);
+                }
+
                 if(metrics > bestMetrics)
                 {
                     bestSolution = solution;
@@ -176,12 +200,6 @@ namespace hiptensor
             }
         }
 
-        CHECK_HIP_ALLOC(hipFree(A_d));
-        CHECK_HIP_ALLOC(hipFree(B_d));
-        CHECK_HIP_ALLOC(hipFree(D_d));
-        CHECK_HIP_ALLOC(hipFree(E_d));
-        CHECK_HIP_ALLOC(hipFree(wspace));
-
         *winner = bestSolution;
 
         if(bestSolution == nullptr)
@@ -194,269 +212,11 @@ namespace hiptensor
         }
     }
 
-    template <>
-    struct ActorCriticSelection<_Float16,
-                                _Float16,
-                                _Float16,
-                                _Float16,
-                                ContractionOpId_t::SCALE,
-                                float>
-    {
-        static hiptensorStatus_t
-            selectWinner(ContractionSolution**                                   winner,
-                         std::unordered_map<size_t, ContractionSolution*> const& candidates,
-                         hipDataType                                             typeA,
-                         std::vector<std::size_t> const&                         a_ms_ks_lengths,
-                         std::vector<std::size_t> const&                         a_ms_ks_strides,
-                         std::vector<int32_t> const&                             a_ms_ks_modes,
-                         hipDataType                                             typeB,
-                         std::vector<std::size_t> const&                         b_ns_ks_lengths,
-                         std::vector<std::size_t> const&                         b_ns_ks_strides,
-                         std::vector<int32_t> const&                             b_ns_ks_modes,
-                         hipDataType                                             typeD,
-                         std::vector<std::size_t> const&                         d_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         d_ms_ns_strides,
-                         std::vector<int32_t> const&                             d_ms_ns_modes,
-                         hipDataType                                             typeE,
-                         std::vector<std::size_t> const&                         e_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         e_ms_ns_strides,
-                         std::vector<int32_t> const&                             e_ms_ns_modes,
-                         const uint64_t                                          workspaceSize)
-        {
-            int d1 = a_ms_ks_strides[1];
-            int d2 = a_ms_ks_strides[3];
-            int d3 = a_ms_ks_strides[5];
-            int d4 = a_ms_ks_strides[7];
-            int d5 = a_ms_ks_strides[9];
-            int d6 = a_ms_ks_strides[11];
-
-            size_t unique_id = 0;
-
-            // m1n1k1
-            if(d1 == 1)
-            {
-                unique_id = 2317674114976786230ull;
-            }
-            // m2n2k2
-            else if(d2 == 1)
-            {
-                unique_id = 2317674114976786230ull;
-            }
-            // m3n3k3
-            else if(d3 == 1)
-            {
-                unique_id = 2317674114976786230ull;
-            }
-            // m4n4k4
-            else if(d4 == 1)
-            {
-                unique_id = 12241437837959333440ull;
-            }
-            // m5n5k5
-            else if(d5 == 1)
-            {
-                unique_id = 12241437837959333440ull;
-            }
-            // m6n6k6
-            else if(d6 == 1)
-            {
-                unique_id = 11152060091307708334ull;
-            }
-
-            if(auto candidate = candidates.find(unique_id); candidate != candidates.end())
-            {
-                *winner = candidate->second;
-                return HIPTENSOR_STATUS_SUCCESS;
-            }
-            else
-            {
-                return HIPTENSOR_STATUS_EXECUTION_FAILED;
-            }
-        }
-    };
-
-    template <>
-    struct ActorCriticSelection<_Float16,
-                                _Float16,
-                                _Float16,
-                                _Float16,
-                                ContractionOpId_t::BILINEAR,
-                                float>
-    {
-        static hiptensorStatus_t
-            selectWinner(ContractionSolution**                                   winner,
-                         std::unordered_map<size_t, ContractionSolution*> const& candidates,
-                         hipDataType                                             typeA,
-                         std::vector<std::size_t> const&                         a_ms_ks_lengths,
-                         std::vector<std::size_t> const&                         a_ms_ks_strides,
-                         std::vector<int32_t> const&                             a_ms_ks_modes,
-                         hipDataType                                             typeB,
-                         std::vector<std::size_t> const&                         b_ns_ks_lengths,
-                         std::vector<std::size_t> const&                         b_ns_ks_strides,
-                         std::vector<int32_t> const&                             b_ns_ks_modes,
-                         hipDataType                                             typeD,
-                         std::vector<std::size_t> const&                         d_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         d_ms_ns_strides,
-                         std::vector<int32_t> const&                             d_ms_ns_modes,
-                         hipDataType                                             typeE,
-                         std::vector<std::size_t> const&                         e_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         e_ms_ns_strides,
-                         std::vector<int32_t> const&                             e_ms_ns_modes,
-                         const uint64_t                                          workspaceSize)
-        {
-            int d1 = a_ms_ks_strides[1];
-            int d2 = a_ms_ks_strides[3];
-            int d3 = a_ms_ks_strides[5];
-            int d4 = a_ms_ks_strides[7];
-            int d5 = a_ms_ks_strides[9];
-            int d6 = a_ms_ks_strides[11];
-
-            size_t unique_id = 0;
-
-            bool dim1 = std::count(a_ms_ks_lengths.cbegin(), a_ms_ks_lengths.cend(), 1)
-                        || std::count(b_ns_ks_lengths.cbegin(), b_ns_ks_lengths.cend(), 1);
-
-            // rank2 dim1 case
-            if(d2 == 1 && dim1)
-            {
-                unique_id = 58303249112943560ull;
-            }
-            // m1n1k1
-            else if(d1 == 1)
-            // if (d1 == 1 || (d2 == 1 && (a_ms_ks_lengths[3] == 1 || b_ns_ks_lengths[3] == 1)))
-            {
-                unique_id = 58303249112943560ull;
-            }
-            // m2n2k2
-            else if(d2 == 1)
-            {
-                unique_id = 2303552229010777601ull;
-            }
-            // m3n3k3
-            else if(d3 == 1)
-            {
-                unique_id = 58303249112943560ull;
-            }
-            // m4n4k4
-            else if(d4 == 1)
-            {
-                unique_id = 58303249112943560ull;
-            }
-            // m5n5k5
-            else if(d5 == 1)
-            {
-                unique_id = 58303249112943560ull;
-            }
-            // m6n6k6
-            else if(d6 == 1)
-            {
-                unique_id = 2303552229010777601ull;
-            }
-
-            if(auto candidate = candidates.find(unique_id); candidate != candidates.end())
-            {
-                *winner = candidate->second;
-                return HIPTENSOR_STATUS_SUCCESS;
-            }
-            else
-            {
-                return HIPTENSOR_STATUS_EXECUTION_FAILED;
-            }
-        }
-    };
-
-    template <>
-    struct ActorCriticSelection<hip_bfloat16,
-                                hip_bfloat16,
-                                hip_bfloat16,
-                                hip_bfloat16,
-                                ContractionOpId_t::SCALE,
-                                float>
-    {
-        static hiptensorStatus_t
-            selectWinner(ContractionSolution**                                   winner,
-                         std::unordered_map<size_t, ContractionSolution*> const& candidates,
-                         hipDataType                                             typeA,
-                         std::vector<std::size_t> const&                         a_ms_ks_lengths,
-                         std::vector<std::size_t> const&                         a_ms_ks_strides,
-                         std::vector<int32_t> const&                             a_ms_ks_modes,
-                         hipDataType                                             typeB,
-                         std::vector<std::size_t> const&                         b_ns_ks_lengths,
-                         std::vector<std::size_t> const&                         b_ns_ks_strides,
-                         std::vector<int32_t> const&                             b_ns_ks_modes,
-                         hipDataType                                             typeD,
-                         std::vector<std::size_t> const&                         d_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         d_ms_ns_strides,
-                         std::vector<int32_t> const&                             d_ms_ns_modes,
-                         hipDataType                                             typeE,
-                         std::vector<std::size_t> const&                         e_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         e_ms_ns_strides,
-                         std::vector<int32_t> const&                             e_ms_ns_modes,
-                         const uint64_t                                          workspaceSize)
-        {
-            int d1 = a_ms_ks_strides[1];
-            int d2 = a_ms_ks_strides[3];
-            int d3 = a_ms_ks_strides[5];
-            int d4 = a_ms_ks_strides[7];
-            int d5 = a_ms_ks_strides[9];
-            int d6 = a_ms_ks_strides[11];
-
-            size_t unique_id = 0;
-
-            // m1n1k1
-            if(d1 == 1)
-            {
-                unique_id = 9967477699864925937ull;
-            }
-            // m2n2k2
-            else if(d2 == 1)
-            {
-                unique_id = 14071475272156866885ull;
-            }
-            // m3n3k3
-            else if(d3 == 1)
-            {
-                unique_id = 14071475272156866885ull;
-            }
-            // m4n4k4
-            else if(d4 == 1)
-            {
-                unique_id = 15452087623356707112ull;
-            }
-            // m5n5k5
-            else if(d5 == 1)
-            {
-                unique_id = 15452087623356707112ull;
-            }
-            // m6n6k6
-            else if(d6 == 1)
-            {
-                unique_id = 8307633941691601884ull;
-            }
-
-            if(auto candidate = candidates.find(unique_id); candidate != candidates.end())
-            {
-                *winner = candidate->second;
-                return HIPTENSOR_STATUS_SUCCESS;
-            }
-            else
-            {
-                return HIPTENSOR_STATUS_EXECUTION_FAILED;
-            }
-        }
-    };
 
-    template <>
-    struct ActorCriticSelection<hip_bfloat16,
-                                hip_bfloat16,
-                                hip_bfloat16,
-                                hip_bfloat16,
-                                ContractionOpId_t::BILINEAR,
-                                float>
-    {
-        static hiptensorStatus_t
-            selectWinner(ContractionSolution**                                   winner,
+    hiptensorStatus_t
+        actorCriticModel(ContractionSolution**                                   winner,
                          std::unordered_map<size_t, ContractionSolution*> const& candidates,
+                         int32_t                                                 contractionOpId,
                          hipDataType                                             typeA,
                          std::vector<std::size_t> const&                         a_ms_ks_lengths,
                          std::vector<std::size_t> const&                         a_ms_ks_strides,
@@ -473,1743 +233,64 @@ namespace hiptensor
                          std::vector<std::size_t> const&                         e_ms_ns_lengths,
                          std::vector<std::size_t> const&                         e_ms_ns_strides,
                          std::vector<int32_t> const&                             e_ms_ns_modes,
-                         const uint64_t                                          workspaceSize)
-        {
-            int d1 = a_ms_ks_strides[1];
-            int d2 = a_ms_ks_strides[3];
-            int d3 = a_ms_ks_strides[5];
-            int d4 = a_ms_ks_strides[7];
-            int d5 = a_ms_ks_strides[9];
-            int d6 = a_ms_ks_strides[11];
-
-            size_t unique_id = 0;
-
-            bool dim1 = std::count(a_ms_ks_lengths.cbegin(), a_ms_ks_lengths.cend(), 1)
-                        || std::count(b_ns_ks_lengths.cbegin(), b_ns_ks_lengths.cend(), 1);
-
-            // rank2 dim1 case
-            if(d2 == 1 && dim1)
-            {
-                unique_id = 16299024124514902126ull;
-            }
-            // m1n1k1
-            else if(d1 == 1)
-            {
-                unique_id = 378062791888302715ull;
-            }
-            // m2n2k2
-            else if(d2 == 1)
-            {
-                unique_id = 76527422265261696ull;
-            }
-            // m3n3k3
-            else if(d3 == 1)
-            {
-                unique_id = 378062791888302715ull;
-            }
-            // m4n4k4
-            else if(d4 == 1)
-            {
-                unique_id = 378062791888302715ull;
-            }
-            // m5n5k5
-            else if(d5 == 1)
-            {
-                unique_id = 378062791888302715ull;
-            }
-            // m6n6k6
-            else if(d6 == 1)
-            {
-                unique_id = 378062791888302715ull;
-            }
-
-            if(auto candidate = candidates.find(unique_id); candidate != candidates.end())
-            {
-                *winner = candidate->second;
-                return HIPTENSOR_STATUS_SUCCESS;
-            }
-            else
-            {
-                return HIPTENSOR_STATUS_EXECUTION_FAILED;
-            }
-        }
-    };
-
-    template <>
-    struct ActorCriticSelection<float, float, float, float, ContractionOpId_t::SCALE, _Float16>
+                         hiptensorComputeType_t                                  computeType,
+                         const uint64_t                                          workspaceSize,
+                         uint32_t                                                deviceArch)
     {
-        static hiptensorStatus_t
-            selectWinner(ContractionSolution**                                   winner,
-                         std::unordered_map<size_t, ContractionSolution*> const& candidates,
-                         hipDataType                                             typeA,
-                         std::vector<std::size_t> const&                         a_ms_ks_lengths,
-                         std::vector<std::size_t> const&                         a_ms_ks_strides,
-                         std::vector<int32_t> const&                             a_ms_ks_modes,
-                         hipDataType                                             typeB,
-                         std::vector<std::size_t> const&                         b_ns_ks_lengths,
-                         std::vector<std::size_t> const&                         b_ns_ks_strides,
-                         std::vector<int32_t> const&                             b_ns_ks_modes,
-                         hipDataType                                             typeD,
-                         std::vector<std::size_t> const&                         d_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         d_ms_ns_strides,
-                         std::vector<int32_t> const&                             d_ms_ns_modes,
-                         hipDataType                                             typeE,
-                         std::vector<std::size_t> const&                         e_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         e_ms_ns_strides,
-                         std::vector<int32_t> const&                             e_ms_ns_modes,
-                         const uint64_t                                          workspaceSize)
-        {
-            int d1 = a_ms_ks_strides[1];
-            int d2 = a_ms_ks_strides[3];
-            int d3 = a_ms_ks_strides[5];
-            int d4 = a_ms_ks_strides[7];
-            int d5 = a_ms_ks_strides[9];
-            int d6 = a_ms_ks_strides[11];
-
-            size_t unique_id = 0;
-
-            // m1n1k1
-            if(d1 == 1)
-            {
-                unique_id = 17141562253969597117ull;
-            }
-            // m2n2k2
-            else if(d2 == 1)
-            {
-                unique_id = 17141562253969597117ull;
-            }
-            // m3n3k3
-            else if(d3 == 1)
-            {
-                unique_id = 17141562253969597117ull;
-            }
-            // m4n4k4
-            else if(d4 == 1)
-            {
-                unique_id = 17141562253969597117ull;
-            }
-            // m5n5k5
-            else if(d5 == 1)
-            {
-                unique_id = 17141562253969597117ull;
-            }
-            // m6n6k6
-            else if(d6 == 1)
-            {
-                unique_id = 6384780398804323250ull;
-            }
-
-            if(auto candidate = candidates.find(unique_id); candidate != candidates.end())
+        auto& model    = ContractionSelectionModel::instance();
+        auto  features = ContractionSelectionModel::makeFeatures(contractionOpId,
+                                                                typeA,
+                                                                typeB,
+                                                                typeD,
+                                                                typeE,
+                                                                computeType,
+                                                                a_ms_ks_lengths,
+                                                                a_ms_ks_strides,
+                                                                a_ms_ks_modes,
+                                                                b_ns_ks_lengths,
+                                                                b_ns_ks_strides,
+                                                                b_ns_ks_modes,
+                                                                e_ms_ns_modes,
+                                                                deviceArch);
+
+        // Rules naming kernels that are not built, or that cannot run the problem,
+        // give way to the next matching rule.
+        for(auto uid : model->query(features))
+        {
+            auto candidate = candidates.find(uid);
+            if(candidate == candidates.end())
+            {
+                continue;
+            }
+
+            ContractionArgs args;
+            if(candidate->second->initArgs(args,
+                                           nullptr,
+                                           nullptr,
+                                           nullptr,
+                                           nullptr,
+                                           nullptr,
+                                           nullptr,
+                                           a_ms_ks_lengths,
+                                           a_ms_ks_strides,
+                                           a_ms_ks_modes,
+                                           b_ns_ks_lengths,
+                                           b_ns_ks_strides,
+                                           b_ns_ks_modes,
+                                           d_ms_ns_lengths,
+                                           d_ms_ns_strides,
+                                           d_ms_ns_modes,
+                                           e_ms_ns_lengths,
+                                           e_ms_ns_strides,
+                                           e_ms_ns_modes,
+                                           nullptr)
+               && args.mWorkspaceSize <= workspaceSize)
             {
                 *winner = candidate->second;
                 return HIPTENSOR_STATUS_SUCCESS;
             }
-            else
-            {
-                return HIPTENSOR_STATUS_EXECUTION_FAILED;
-            }
         }
-    };
-
-    template <>
-    struct ActorCriticSelection<float, float, float, float, ContractionOpId_t::BILINEAR, _Float16>
-    {
-        static hiptensorStatus_t
-            selectWinner(ContractionSolution**                                   winner,
-                         std::unordered_map<size_t, ContractionSolution*> const& candidates,
-                         hipDataType                                             typeA,
-                         std::vector<std::size_t> const&                         a_ms_ks_lengths,
-                         std::vector<std::size_t> const&                         a_ms_ks_strides,
-                         std::vector<int32_t> const&                             a_ms_ks_modes,
-                         hipDataType                                             typeB,
-                         std::vector<std::size_t> const&                         b_ns_ks_lengths,
-                         std::vector<std::size_t> const&                         b_ns_ks_strides,
-                         std::vector<int32_t> const&                             b_ns_ks_modes,
-                         hipDataType                                             typeD,
-                         std::vector<std::size_t> const&                         d_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         d_ms_ns_strides,
-                         std::vector<int32_t> const&                             d_ms_ns_modes,
-                         hipDataType                                             typeE,
-                         std::vector<std::size_t> const&                         e_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         e_ms_ns_strides,
-                         std::vector<int32_t> const&                             e_ms_ns_modes,
-                         const uint64_t                                          workspaceSize)
-        {
-            int d1 = a_ms_ks_strides[1];
-            int d2 = a_ms_ks_strides[3];
-            int d3 = a_ms_ks_strides[5];
-            int d4 = a_ms_ks_strides[7];
-            int d5 = a_ms_ks_strides[9];
-            int d6 = a_ms_ks_strides[11];
-
-            size_t unique_id = 0;
-
-            bool dim1 = std::count(a_ms_ks_lengths.cbegin(), a_ms_ks_lengths.cend(), 1)
-                        || std::count(b_ns_ks_lengths.cbegin(), b_ns_ks_lengths.cend(), 1);
 
-            // rank2 dim1 case
-            if(d2 == 1 && dim1)
-            {
-                unique_id = 8251132190088736039ull;
-            }
-            // m1n1k1
-            else if(d1 == 1)
-            {
-                unique_id = 2897979232477761524ull;
-            }
-            // m2n2k2
-            else if(d2 == 1)
-            {
-                unique_id = 2897979232477761524ull;
-            }
-            // m3n3k3
-            else if(d3 == 1)
-            {
-                unique_id = 2897979232477761524ull;
-            }
-            // m4n4k4
-            else if(d4 == 1)
-            {
-                unique_id = 2897979232477761524ull;
-            }
-            // m5n5k5
-            else if(d5 == 1)
-            {
-                unique_id = 2897979232477761524ull;
-            }
-            // m6n6k6
-            else if(d6 == 1)
-            {
-                unique_id = 2897979232477761524ull;
-            }
-
-            if(auto candidate = candidates.find(unique_id); candidate != candidates.end())
-            {
-                *winner = candidate->second;
-                return HIPTENSOR_STATUS_SUCCESS;
-            }
-            else
-            {
-                return HIPTENSOR_STATUS_EXECUTION_FAILED;
-            }
-        }
-    };
-
-    template <>
-    struct ActorCriticSelection<float, float, float, float, ContractionOpId_t::SCALE, hip_bfloat16>
-    {
-        static hiptensorStatus_t
-            selectWinner(ContractionSolution**                                   winner,
-                         std::unordered_map<size_t, ContractionSolution*> const& candidates,
-                         hipDataType                                             typeA,
-                         std::vector<std::size_t> const&                         a_ms_ks_lengths,
-                         std::vector<std::size_t> const&                         a_ms_ks_strides,
-                         std::vector<int32_t> const&                             a_ms_ks_modes,
-                         hipDataType                                             typeB,
-                         std::vector<std::size_t> const&                         b_ns_ks_lengths,
-                         std::vector<std::size_t> const&                         b_ns_ks_strides,
-                         std::vector<int32_t> const&                             b_ns_ks_modes,
-                         hipDataType                                             typeD,
-                         std::vector<std::size_t> const&                         d_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         d_ms_ns_strides,
-                         std::vector<int32_t> const&                             d_ms_ns_modes,
-                         hipDataType                                             typeE,
-                         std::vector<std::size_t> const&                         e_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         e_ms_ns_strides,
-                         std::vector<int32_t> const&                             e_ms_ns_modes,
-                         const uint64_t                                          workspaceSize)
-        {
-            int d1 = a_ms_ks_strides[1];
-            int d2 = a_ms_ks_strides[3];
-            int d3 = a_ms_ks_strides[5];
-            int d4 = a_ms_ks_strides[7];
-            int d5 = a_ms_ks_strides[9];
-            int d6 = a_ms_ks_strides[11];
-
-            size_t unique_id = 0;
-
-            // m1n1k1
-            if(d1 == 1)
-            {
-                unique_id = 4373449368168185126ull;
-            }
-            // m2n2k2
-            else if(d2 == 1)
-            {
-                unique_id = 4373449368168185126ull;
-            }
-            // m3n3k3
-            else if(d3 == 1)
-            {
-                unique_id = 2008216990064456310ull;
-            }
-            // m4n4k4
-            else if(d4 == 1)
-            {
-                unique_id = 4373449368168185126ull;
-            }
-            // m5n5k5
-            else if(d5 == 1)
-            {
-                unique_id = 13613206280884761703ull;
-            }
-            // m6n6k6
-            else if(d6 == 1)
-            {
-                unique_id = 15116758930810193332ull;
-            }
-
-            if(auto candidate = candidates.find(unique_id); candidate != candidates.end())
-            {
-                *winner = candidate->second;
-                return HIPTENSOR_STATUS_SUCCESS;
-            }
-            else
-            {
-                return HIPTENSOR_STATUS_EXECUTION_FAILED;
-            }
-        }
-    };
-
-    template <>
-    struct ActorCriticSelection<float,
-                                float,
-                                float,
-                                float,
-                                ContractionOpId_t::BILINEAR,
-                                hip_bfloat16>
-    {
-        static hiptensorStatus_t
-            selectWinner(ContractionSolution**                                   winner,
-                         std::unordered_map<size_t, ContractionSolution*> const& candidates,
-                         hipDataType                                             typeA,
-                         std::vector<std::size_t> const&                         a_ms_ks_lengths,
-                         std::vector<std::size_t> const&                         a_ms_ks_strides,
-                         std::vector<int32_t> const&                             a_ms_ks_modes,
-                         hipDataType                                             typeB,
-                         std::vector<std::size_t> const&                         b_ns_ks_lengths,
-                         std::vector<std::size_t> const&                         b_ns_ks_strides,
-                         std::vector<int32_t> const&                             b_ns_ks_modes,
-                         hipDataType                                             typeD,
-                         std::vector<std::size_t> const&                         d_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         d_ms_ns_strides,
-                         std::vector<int32_t> const&                             d_ms_ns_modes,
-                         hipDataType                                             typeE,
-                         std::vector<std::size_t> const&                         e_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         e_ms_ns_strides,
-                         std::vector<int32_t> const&                             e_ms_ns_modes,
-                         const uint64_t                                          workspaceSize)
-        {
-            int d1 = a_ms_ks_strides[1];
-            int d2 = a_ms_ks_strides[3];
-            int d3 = a_ms_ks_strides[5];
-            int d4 = a_ms_ks_strides[7];
-            int d5 = a_ms_ks_strides[9];
-            int d6 = a_ms_ks_strides[11];
-
-            size_t unique_id = 0;
-
-            bool dim1 = std::count(a_ms_ks_lengths.cbegin(), a_ms_ks_lengths.cend(), 1)
-                        || std::count(b_ns_ks_lengths.cbegin(), b_ns_ks_lengths.cend(), 1);
-
-            // rank2 dim1 case
-            if(d2 == 1 && dim1)
-            {
-                unique_id = 8067958629699904967ull;
-            }
-            // m1n1k1
-            else if(d1 == 1)
-            {
-                unique_id = 8116863550692548667ull;
-            }
-            // m2n2k2
-            else if(d2 == 1)
-            {
-                unique_id = 8116863550692548667ull;
-            }
-            // m3n3k3
-            else if(d3 == 1)
-            {
-                unique_id = 8116863550692548667ull;
-            }
-            // m4n4k4
-            else if(d4 == 1)
-            {
-                unique_id = 8116863550692548667ull;
-            }
-            // m5n5k5
-            else if(d5 == 1)
-            {
-                unique_id = 8116863550692548667ull;
-            }
-            // m6n6k6
-            else if(d6 == 1)
-            {
-                unique_id = 8116863550692548667ull;
-            }
-
-            if(auto candidate = candidates.find(unique_id); candidate != candidates.end())
-            {
-                *winner = candidate->second;
-                return HIPTENSOR_STATUS_SUCCESS;
-            }
-            else
-            {
-                return HIPTENSOR_STATUS_EXECUTION_FAILED;
-            }
-        }
-    };
-
-    template <>
-    struct ActorCriticSelection<float, float, float, float, ContractionOpId_t::SCALE, float>
-    {
-        static hiptensorStatus_t
-            selectWinner(ContractionSolution**                                   winner,
-                         std::unordered_map<size_t, ContractionSolution*> const& candidates,
-                         hipDataType                                             typeA,
-                         std::vector<std::size_t> const&                         a_ms_ks_lengths,
-                         std::vector<std::size_t> const&                         a_ms_ks_strides,
-                         std::vector<int32_t> const&                             a_ms_ks_modes,
-                         hipDataType                                             typeB,
-                         std::vector<std::size_t> const&                         b_ns_ks_lengths,
-                         std::vector<std::size_t> const&                         b_ns_ks_strides,
-                         std::vector<int32_t> const&                             b_ns_ks_modes,
-                         hipDataType                                             typeD,
-                         std::vector<std::size_t> const&                         d_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         d_ms_ns_strides,
-                         std::vector<int32_t> const&                             d_ms_ns_modes,
-                         hipDataType                                             typeE,
-                         std::vector<std::size_t> const&                         e_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         e_ms_ns_strides,
-                         std::vector<int32_t> const&                             e_ms_ns_modes,
-                         const uint64_t                                          workspaceSize)
-        {
-            int d1 = a_ms_ks_strides[1];
-            int d2 = a_ms_ks_strides[3];
-            int d3 = a_ms_ks_strides[5];
-            int d4 = a_ms_ks_strides[7];
-            int d5 = a_ms_ks_strides[9];
-            int d6 = a_ms_ks_strides[11];
-
-            size_t unique_id = 0;
-
-            // m1n1k1
-            if(d1 == 1)
-            {
-                unique_id = 5794367356792942822ull;
-            }
-            // m2n2k2
-            else if(d2 == 1)
-            {
-                unique_id = 17939389824758640014ull;
-            }
-            // m3n3k3
-            else if(d3 == 1)
-            {
-                unique_id = 10640128726648594287ull;
-            }
-            // m4n4k4
-            else if(d4 == 1)
-            {
-                unique_id = 5794367356792942822ull;
-            }
-            // m5n5k5
-            else if(d5 == 1)
-            {
-                unique_id = 5794367356792942822ull;
-            }
-            // m6n6k6
-            else if(d6 == 1)
-            {
-                unique_id = 13933081369664111675ull;
-            }
-
-            if(auto candidate = candidates.find(unique_id); candidate != candidates.end())
-            {
-                *winner = candidate->second;
-                return HIPTENSOR_STATUS_SUCCESS;
-            }
-            else
-            {
-                return HIPTENSOR_STATUS_EXECUTION_FAILED;
-            }
-        }
-    };
-
-    template <>
-    struct ActorCriticSelection<float, float, float, float, ContractionOpId_t::BILINEAR, float>
-    {
-        static hiptensorStatus_t
-            selectWinner(ContractionSolution**                                   winner,
-                         std::unordered_map<size_t, ContractionSolution*> const& candidates,
-                         hipDataType                                             typeA,
-                         std::vector<std::size_t> const&                         a_ms_ks_lengths,
-                         std::vector<std::size_t> const&                         a_ms_ks_strides,
-                         std::vector<int32_t> const&                             a_ms_ks_modes,
-                         hipDataType                                             typeB,
-                         std::vector<std::size_t> const&                         b_ns_ks_lengths,
-                         std::vector<std::size_t> const&                         b_ns_ks_strides,
-                         std::vector<int32_t> const&                             b_ns_ks_modes,
-                         hipDataType                                             typeD,
-                         std::vector<std::size_t> const&                         d_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         d_ms_ns_strides,
-                         std::vector<int32_t> const&                             d_ms_ns_modes,
-                         hipDataType                                             typeE,
-                         std::vector<std::size_t> const&                         e_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         e_ms_ns_strides,
-                         std::vector<int32_t> const&                             e_ms_ns_modes,
-                         const uint64_t                                          workspaceSize)
-        {
-            int d1 = a_ms_ks_strides[1];
-            int d2 = a_ms_ks_strides[3];
-            int d3 = a_ms_ks_strides[5];
-            int d4 = a_ms_ks_strides[7];
-            int d5 = a_ms_ks_strides[9];
-            int d6 = a_ms_ks_strides[11];
-
-            size_t unique_id = 0;
-
-            bool dim1 = std::count(a_ms_ks_lengths.cbegin(), a_ms_ks_lengths.cend(), 1)
-                        || std::count(b_ns_ks_lengths.cbegin(), b_ns_ks_lengths.cend(), 1);
-
-            // rank2 dim1 case
-            if(d2 == 1 && dim1)
-            {
-                unique_id = 14915761978535949477ull;
-            }
-            // m1n1k1
-            else if(d1 == 1)
-            {
-                unique_id = 14915761978535949477ull;
-            }
-            // m2n2k2
-            else if(d2 == 1)
-            {
-                unique_id = 14915761978535949477ull;
-            }
-            // m3n3k3
-            else if(d3 == 1)
-            {
-                unique_id = 14915761978535949477ull;
-            }
-            // m4n4k4
-            else if(d4 == 1)
-            {
-                unique_id = 14915761978535949477ull;
-            }
-            // m5n5k5
-            else if(d5 == 1)
-            {
-                unique_id = 14915761978535949477ull;
-            }
-            // m6n6k6
-            else if(d6 == 1)
-            {
-                unique_id = 14915761978535949477ull;
-            }
-
-            if(auto candidate = candidates.find(unique_id); candidate != candidates.end())
-            {
-                *winner = candidate->second;
-                return HIPTENSOR_STATUS_SUCCESS;
-            }
-            else
-            {
-                return HIPTENSOR_STATUS_EXECUTION_FAILED;
-            }
-        }
-    };
-
-    template <>
-    struct ActorCriticSelection<double, double, double, double, ContractionOpId_t::SCALE, float>
-    {
-        static hiptensorStatus_t
-            selectWinner(ContractionSolution**                                   winner,
-                         std::unordered_map<size_t, ContractionSolution*> const& candidates,
-                         hipDataType                                             typeA,
-                         std::vector<std::size_t> const&                         a_ms_ks_lengths,
-                         std::vector<std::size_t> const&                         a_ms_ks_strides,
-                         std::vector<int32_t> const&                             a_ms_ks_modes,
-                         hipDataType                                             typeB,
-                         std::vector<std::size_t> const&                         b_ns_ks_lengths,
-                         std::vector<std::size_t> const&                         b_ns_ks_strides,
-                         std::vector<int32_t> const&                             b_ns_ks_modes,
-                         hipDataType                                             typeD,
-                         std::vector<std::size_t> const&                         d_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         d_ms_ns_strides,
-                         std::vector<int32_t> const&                             d_ms_ns_modes,
-                         hipDataType                                             typeE,
-                         std::vector<std::size_t> const&                         e_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         e_ms_ns_strides,
-                         std::vector<int32_t> const&                             e_ms_ns_modes,
-                         const uint64_t                                          workspaceSize)
-        {
-
-            int d1 = a_ms_ks_strides[1];
-            int d2 = a_ms_ks_strides[3];
-            int d3 = a_ms_ks_strides[5];
-            int d4 = a_ms_ks_strides[7];
-            int d5 = a_ms_ks_strides[9];
-            int d6 = a_ms_ks_strides[11];
-
-            size_t unique_id = 0;
-
-            // m1n1k1
-            if(d1 == 1)
-            {
-                unique_id = 18207091374964962208ull;
-            }
-            // m2n2k2
-            else if(d2 == 1)
-            {
-                unique_id = 16948282955506101335ull;
-            }
-            // m3n3k3
-            else if(d3 == 1)
-            {
-                unique_id = 16870758234615651290ull;
-            }
-            // m4n4k4
-            else if(d4 == 1)
-            {
-                unique_id = 15355329505248522280ull;
-            }
-            // m5n5k5
-            else if(d5 == 1)
-            {
-                unique_id = 14642257549075851915ull;
-            }
-            // m6n6k6
-            else if(d6 == 1)
-            {
-                unique_id = 14642257549075851915ull;
-            }
-
-            if(auto candidate = candidates.find(unique_id); candidate != candidates.end())
-            {
-                *winner = candidate->second;
-                return HIPTENSOR_STATUS_SUCCESS;
-            }
-            else
-            {
-                return HIPTENSOR_STATUS_EXECUTION_FAILED;
-            }
-        }
-    };
-
-    template <>
-    struct ActorCriticSelection<double, double, double, double, ContractionOpId_t::BILINEAR, float>
-    {
-        static hiptensorStatus_t
-            selectWinner(ContractionSolution**                                   winner,
-                         std::unordered_map<size_t, ContractionSolution*> const& candidates,
-                         hipDataType                                             typeA,
-                         std::vector<std::size_t> const&                         a_ms_ks_lengths,
-                         std::vector<std::size_t> const&                         a_ms_ks_strides,
-                         std::vector<int32_t> const&                             a_ms_ks_modes,
-                         hipDataType                                             typeB,
-                         std::vector<std::size_t> const&                         b_ns_ks_lengths,
-                         std::vector<std::size_t> const&                         b_ns_ks_strides,
-                         std::vector<int32_t> const&                             b_ns_ks_modes,
-                         hipDataType                                             typeD,
-                         std::vector<std::size_t> const&                         d_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         d_ms_ns_strides,
-                         std::vector<int32_t> const&                             d_ms_ns_modes,
-                         hipDataType                                             typeE,
-                         std::vector<std::size_t> const&                         e_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         e_ms_ns_strides,
-                         std::vector<int32_t> const&                             e_ms_ns_modes,
-                         const uint64_t                                          workspaceSize)
-        {
-            int d1 = a_ms_ks_strides[1];
-            int d2 = a_ms_ks_strides[3];
-            int d3 = a_ms_ks_strides[5];
-            int d4 = a_ms_ks_strides[7];
-            int d5 = a_ms_ks_strides[9];
-            int d6 = a_ms_ks_strides[11];
-
-            size_t unique_id = 0;
-
-            bool dim1 = std::count(a_ms_ks_lengths.cbegin(), a_ms_ks_lengths.cend(), 1)
-                        || std::count(b_ns_ks_lengths.cbegin(), b_ns_ks_lengths.cend(), 1);
-
-            // rank2 dim1 case
-            if(d2 == 1 && dim1)
-            {
-                unique_id = 11269655469469274301ull;
-            }
-            // m1n1k1
-            else if(d1 == 1)
-            {
-                unique_id = 2143493311543532856ull;
-            }
-            // m2n2k2
-            else if(d2 == 1)
-            {
-                unique_id = 2143493311543532856ull;
-            }
-            // m3n3k3
-            else if(d3 == 1)
-            {
-                unique_id = 2143493311543532856ull;
-            }
-            // m4n4k4
-            else if(d4 == 1)
-            {
-                unique_id = 2143493311543532856ull;
-            }
-            // m5n5k5
-            else if(d5 == 1)
-            {
-                unique_id = 2143493311543532856ull;
-            }
-            // m6n6k6
-            else if(d6 == 1)
-            {
-                unique_id = 2143493311543532856ull;
-            }
-
-            if(auto candidate = candidates.find(unique_id); candidate != candidates.end())
-            {
-                *winner = candidate->second;
-                return HIPTENSOR_STATUS_SUCCESS;
-            }
-            else
-            {
-                return HIPTENSOR_STATUS_EXECUTION_FAILED;
-            }
-        }
-    };
-
-    template <>
-    struct ActorCriticSelection<double, double, double, double, ContractionOpId_t::SCALE, double>
-    {
-        static hiptensorStatus_t
-            selectWinner(ContractionSolution**                                   winner,
-                         std::unordered_map<size_t, ContractionSolution*> const& candidates,
-                         hipDataType                                             typeA,
-                         std::vector<std::size_t> const&                         a_ms_ks_lengths,
-                         std::vector<std::size_t> const&                         a_ms_ks_strides,
-                         std::vector<int32_t> const&                             a_ms_ks_modes,
-                         hipDataType                                             typeB,
-                         std::vector<std::size_t> const&                         b_ns_ks_lengths,
-                         std::vector<std::size_t> const&                         b_ns_ks_strides,
-                         std::vector<int32_t> const&                             b_ns_ks_modes,
-                         hipDataType                                             typeD,
-                         std::vector<std::size_t> const&                         d_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         d_ms_ns_strides,
-                         std::vector<int32_t> const&                             d_ms_ns_modes,
-                         hipDataType                                             typeE,
-                         std::vector<std::size_t> const&                         e_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         e_ms_ns_strides,
-                         std::vector<int32_t> const&                             e_ms_ns_modes,
-                         const uint64_t                                          workspaceSize)
-        {
-
-            int d1 = a_ms_ks_strides[1];
-            int d2 = a_ms_ks_strides[3];
-            int d3 = a_ms_ks_strides[5];
-            int d4 = a_ms_ks_strides[7];
-            int d5 = a_ms_ks_strides[9];
-            int d6 = a_ms_ks_strides[11];
-
-            size_t unique_id = 0;
-
-            // m1n1k1
-            if(d1 == 1)
-            {
-                unique_id = 3879892272436099392ull;
-            }
-            // m2n2k2
-            else if(d2 == 1)
-            {
-                unique_id = 8021137963958390646ull;
-            }
-            // m3n3k3
-            else if(d3 == 1)
-            {
-                unique_id = 3248584345341330494ull;
-            }
-            // m4n4k4
-            else if(d4 == 1)
-            {
-                unique_id = 3879892272436099392ull;
-            }
-            // m5n5k5
-            else if(d5 == 1)
-            {
-                unique_id = 3879892272436099392ull;
-            }
-            // m6n6k6
-            else if(d6 == 1)
-            {
-                unique_id = 7950787545240972863ull;
-            }
-
-            if(auto candidate = candidates.find(unique_id); candidate != candidates.end())
-            {
-                *winner = candidate->second;
-                return HIPTENSOR_STATUS_SUCCESS;
-            }
-            else
-            {
-                return HIPTENSOR_STATUS_EXECUTION_FAILED;
-            }
-        }
-    };
-
-    template <>
-    struct ActorCriticSelection<double, double, double, double, ContractionOpId_t::BILINEAR, double>
-    {
-        static hiptensorStatus_t
-            selectWinner(ContractionSolution**                                   winner,
-                         std::unordered_map<size_t, ContractionSolution*> const& candidates,
-                         hipDataType                                             typeA,
-                         std::vector<std::size_t> const&                         a_ms_ks_lengths,
-                         std::vector<std::size_t> const&                         a_ms_ks_strides,
-                         std::vector<int32_t> const&                             a_ms_ks_modes,
-                         hipDataType                                             typeB,
-                         std::vector<std::size_t> const&                         b_ns_ks_lengths,
-                         std::vector<std::size_t> const&                         b_ns_ks_strides,
-                         std::vector<int32_t> const&                             b_ns_ks_modes,
-                         hipDataType                                             typeD,
-                         std::vector<std::size_t> const&                         d_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         d_ms_ns_strides,
-                         std::vector<int32_t> const&                             d_ms_ns_modes,
-                         hipDataType                                             typeE,
-                         std::vector<std::size_t> const&                         e_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         e_ms_ns_strides,
-                         std::vector<int32_t> const&                             e_ms_ns_modes,
-                         const uint64_t                                          workspaceSize)
-        {
-            int d1 = a_ms_ks_strides[1];
-            int d2 = a_ms_ks_strides[3];
-            int d3 = a_ms_ks_strides[5];
-            int d4 = a_ms_ks_strides[7];
-            int d5 = a_ms_ks_strides[9];
-            int d6 = a_ms_ks_strides[11];
-
-            size_t unique_id = 0;
-
-            bool dim1 = std::count(a_ms_ks_lengths.cbegin(), a_ms_ks_lengths.cend(), 1)
-                        || std::count(b_ns_ks_lengths.cbegin(), b_ns_ks_lengths.cend(), 1);
-
-            // rank2 dim1 case
-            if(d2 == 1 && dim1)
-            {
-                unique_id = 2054609181761357786ull;
-            }
-            // m1n1k1
-            else if(d1 == 1)
-            {
-                unique_id = 14145390177844245465ull;
-            }
-            // m2n2k2
-            else if(d2 == 1)
-            {
-                unique_id = 14145390177844245465ull;
-            }
-            // m3n3k3
-            else if(d3 == 1)
-            {
-                unique_id = 14145390177844245465ull;
-            }
-            // m4n4k4
-            else if(d4 == 1)
-            {
-                unique_id = 14145390177844245465ull;
-            }
-            // m5n5k5
-            else if(d5 == 1)
-            {
-                unique_id = 14145390177844245465ull;
-            }
-            // m6n6k6
-            else if(d6 == 1)
-            {
-                unique_id = 14145390177844245465ull;
-            }
-
-            if(auto candidate = candidates.find(unique_id); candidate != candidates.end())
-            {
-                *winner = candidate->second;
-                return HIPTENSOR_STATUS_SUCCESS;
-            }
-            else
-            {
-                return HIPTENSOR_STATUS_EXECUTION_FAILED;
-            }
-        }
-    };
-
-    template <>
-    struct ActorCriticSelection<hipFloatComplex,
-                                hipFloatComplex,
-                                hipFloatComplex,
-                                hipFloatComplex,
-                                ContractionOpId_t::SCALE_COMPLEX,
-                                hipFloatComplex>
-    {
-        static hiptensorStatus_t
-            selectWinner(ContractionSolution**                                   winner,
-                         std::unordered_map<size_t, ContractionSolution*> const& candidates,
-                         hipDataType                                             typeA,
-                         std::vector<std::size_t> const&                         a_ms_ks_lengths,
-                         std::vector<std::size_t> const&                         a_ms_ks_strides,
-                         std::vector<int32_t> const&                             a_ms_ks_modes,
-                         hipDataType                                             typeB,
-                         std::vector<std::size_t> const&                         b_ns_ks_lengths,
-                         std::vector<std::size_t> const&                         b_ns_ks_strides,
-                         std::vector<int32_t> const&                             b_ns_ks_modes,
-                         hipDataType                                             typeD,
-                         std::vector<std::size_t> const&                         d_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         d_ms_ns_strides,
-                         std::vector<int32_t> const&                             d_ms_ns_modes,
-                         hipDataType                                             typeE,
-                         std::vector<std::size_t> const&                         e_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         e_ms_ns_strides,
-                         std::vector<int32_t> const&                             e_ms_ns_modes,
-                         const uint64_t                                          workspaceSize)
-        {
-
-            int d1 = a_ms_ks_strides[1];
-            int d2 = a_ms_ks_strides[3];
-            int d3 = a_ms_ks_strides[5];
-            int d4 = a_ms_ks_strides[7];
-            int d5 = a_ms_ks_strides[9];
-            int d6 = a_ms_ks_strides[11];
-
-            size_t unique_id = 0;
-
-            // m1n1k1
-            if(d1 == 1)
-            {
-                unique_id = 1688099565795560288ull;
-            }
-            // m2n2k2
-            else if(d2 == 1)
-            {
-                unique_id = 4348837698146370003ull;
-            }
-            // m3n3k3
-            else if(d3 == 1)
-            {
-                unique_id = 1688099565795560288ull;
-            }
-            // m4n4k4
-            else if(d4 == 1)
-            {
-                unique_id = 1688099565795560288ull;
-            }
-            // m5n5k5
-            else if(d5 == 1)
-            {
-                unique_id = 1688099565795560288ull;
-            }
-            // m6n6k6
-            else if(d6 == 1)
-            {
-                unique_id = 4363356859752806590ull;
-            }
-
-            if(auto candidate = candidates.find(unique_id); candidate != candidates.end())
-            {
-                *winner = candidate->second;
-                return HIPTENSOR_STATUS_SUCCESS;
-            }
-            else
-            {
-                return HIPTENSOR_STATUS_EXECUTION_FAILED;
-            }
-        }
-    };
-
-    template <>
-    struct ActorCriticSelection<hipFloatComplex,
-                                hipFloatComplex,
-                                hipFloatComplex,
-                                hipFloatComplex,
-                                ContractionOpId_t::BILINEAR_COMPLEX,
-                                hipFloatComplex>
-    {
-        static hiptensorStatus_t
-            selectWinner(ContractionSolution**                                   winner,
-                         std::unordered_map<size_t, ContractionSolution*> const& candidates,
-                         hipDataType                                             typeA,
-                         std::vector<std::size_t> const&                         a_ms_ks_lengths,
-                         std::vector<std::size_t> const&                         a_ms_ks_strides,
-                         std::vector<int32_t> const&                             a_ms_ks_modes,
-                         hipDataType                                             typeB,
-                         std::vector<std::size_t> const&                         b_ns_ks_lengths,
-                         std::vector<std::size_t> const&                         b_ns_ks_strides,
-                         std::vector<int32_t> const&                             b_ns_ks_modes,
-                         hipDataType                                             typeD,
-                         std::vector<std::size_t> const&                         d_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         d_ms_ns_strides,
-                         std::vector<int32_t> const&                             d_ms_ns_modes,
-                         hipDataType                                             typeE,
-                         std::vector<std::size_t> const&                         e_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         e_ms_ns_strides,
-                         std::vector<int32_t> const&                             e_ms_ns_modes,
-                         const uint64_t                                          workspaceSize)
-        {
-            int d1 = a_ms_ks_strides[1];
-            int d2 = a_ms_ks_strides[3];
-            int d3 = a_ms_ks_strides[5];
-            int d4 = a_ms_ks_strides[7];
-            int d5 = a_ms_ks_strides[9];
-            int d6 = a_ms_ks_strides[11];
-
-            size_t unique_id = 0;
-
-            bool dim1 = std::count(a_ms_ks_lengths.cbegin(), a_ms_ks_lengths.cend(), 1)
-                        || std::count(b_ns_ks_lengths.cbegin(), b_ns_ks_lengths.cend(), 1);
-
-            // rank2 dim1 case
-            if(d2 == 1 && dim1)
-            {
-                unique_id = 15330878641001915472ull;
-            }
-            // m1n1k1
-            else if(d1 == 1)
-            {
-                unique_id = 11537900932066889768ull;
-            }
-            // m2n2k2
-            else if(d2 == 1)
-            {
-                unique_id = 8338926107119209426ull;
-            }
-            // m3n3k3
-            else if(d3 == 1)
-            {
-                unique_id = 11537900932066889768ull;
-            }
-            // m4n4k4
-            else if(d4 == 1)
-            {
-                unique_id = 11537900932066889768ull;
-            }
-            // m5n5k5
-            else if(d5 == 1)
-            {
-                unique_id = 11537900932066889768ull;
-            }
-            // m6n6k6
-            else if(d6 == 1)
-            {
-                unique_id = 11537900932066889768ull;
-            }
-
-            if(auto candidate = candidates.find(unique_id); candidate != candidates.end())
-            {
-                *winner = candidate->second;
-                return HIPTENSOR_STATUS_SUCCESS;
-            }
-            else
-            {
-                return HIPTENSOR_STATUS_EXECUTION_FAILED;
-            }
-        }
-    };
-
-    template <>
-    struct ActorCriticSelection<hipDoubleComplex,
-                                hipDoubleComplex,
-                                hipDoubleComplex,
-                                hipDoubleComplex,
-                                ContractionOpId_t::SCALE_COMPLEX,
-                                hipDoubleComplex>
-    {
-        static hiptensorStatus_t
-            selectWinner(ContractionSolution**                                   winner,
-                         std::unordered_map<size_t, ContractionSolution*> const& candidates,
-                         hipDataType                                             typeA,
-                         std::vector<std::size_t> const&                         a_ms_ks_lengths,
-                         std::vector<std::size_t> const&                         a_ms_ks_strides,
-                         std::vector<int32_t> const&                             a_ms_ks_modes,
-                         hipDataType                                             typeB,
-                         std::vector<std::size_t> const&                         b_ns_ks_lengths,
-                         std::vector<std::size_t> const&                         b_ns_ks_strides,
-                         std::vector<int32_t> const&                             b_ns_ks_modes,
-                         hipDataType                                             typeD,
-                         std::vector<std::size_t> const&                         d_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         d_ms_ns_strides,
-                         std::vector<int32_t> const&                             d_ms_ns_modes,
-                         hipDataType                                             typeE,
-                         std::vector<std::size_t> const&                         e_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         e_ms_ns_strides,
-                         std::vector<int32_t> const&                             e_ms_ns_modes,
-                         const uint64_t                                          workspaceSize)
-        {
-
-            int d1 = a_ms_ks_strides[1];
-            int d2 = a_ms_ks_strides[3];
-            int d3 = a_ms_ks_strides[5];
-            int d4 = a_ms_ks_strides[7];
-            int d5 = a_ms_ks_strides[9];
-            int d6 = a_ms_ks_strides[11];
-
-            size_t unique_id = 0;
-
-            // m1n1k1
-            if(d1 == 1)
-            {
-                unique_id = 10254320286859648634ull;
-            }
-            // m2n2k2
-            else if(d2 == 1)
-            {
-                unique_id = 15705829219230515535ull;
-            }
-            // m3n3k3
-            else if(d3 == 1)
-            {
-                unique_id = 12959721676360111684ull;
-            }
-            // m4n4k4
-            else if(d4 == 1)
-            {
-                unique_id = 10254320286859648634ull;
-            }
-            // m5n5k5
-            else if(d5 == 1)
-            {
-                unique_id = 10254320286859648634ull;
-            }
-            // m6n6k6
-            else if(d6 == 1)
-            {
-                unique_id = 10254320286859648634ull;
-            }
-
-            if(auto candidate = candidates.find(unique_id); candidate != candidates.end())
-            {
-                *winner = candidate->second;
-                return HIPTENSOR_STATUS_SUCCESS;
-            }
-            else
-            {
-                return HIPTENSOR_STATUS_EXECUTION_FAILED;
-            }
-        }
-    };
-
-    template <>
-    struct ActorCriticSelection<hipDoubleComplex,
-                                hipDoubleComplex,
-                                hipDoubleComplex,
-                                hipDoubleComplex,
-                                ContractionOpId_t::BILINEAR_COMPLEX,
-                                hipDoubleComplex>
-    {
-        static hiptensorStatus_t
-            selectWinner(ContractionSolution**                                   winner,
-                         std::unordered_map<size_t, ContractionSolution*> const& candidates,
-                         hipDataType                                             typeA,
-                         std::vector<std::size_t> const&                         a_ms_ks_lengths,
-                         std::vector<std::size_t> const&                         a_ms_ks_strides,
-                         std::vector<int32_t> const&                             a_ms_ks_modes,
-                         hipDataType                                             typeB,
-                         std::vector<std::size_t> const&                         b_ns_ks_lengths,
-                         std::vector<std::size_t> const&                         b_ns_ks_strides,
-                         std::vector<int32_t> const&                             b_ns_ks_modes,
-                         hipDataType                                             typeD,
-                         std::vector<std::size_t> const&                         d_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         d_ms_ns_strides,
-                         std::vector<int32_t> const&                             d_ms_ns_modes,
-                         hipDataType                                             typeE,
-                         std::vector<std::size_t> const&                         e_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         e_ms_ns_strides,
-                         std::vector<int32_t> const&                             e_ms_ns_modes,
-                         const uint64_t                                          workspaceSize)
-        {
-            int d1 = a_ms_ks_strides[1];
-            int d2 = a_ms_ks_strides[3];
-            int d3 = a_ms_ks_strides[5];
-            int d4 = a_ms_ks_strides[7];
-            int d5 = a_ms_ks_strides[9];
-            int d6 = a_ms_ks_strides[11];
-
-            size_t unique_id = 0;
-
-            bool dim1 = std::count(a_ms_ks_lengths.cbegin(), a_ms_ks_lengths.cend(), 1)
-                        || std::count(b_ns_ks_lengths.cbegin(), b_ns_ks_lengths.cend(), 1);
-
-            // rank2 dim1 case
-            if(d2 == 1 && dim1)
-            {
-                unique_id = 14051358583041094215ull;
-            }
-            // m1n1k1
-            else if(d1 == 1)
-            {
-                unique_id = 8503926755447648324ull;
-            }
-            // m2n2k2
-            else if(d2 == 1)
-            {
-                unique_id = 8503926755447648324ull;
-            }
-            // m3n3k3
-            else if(d3 == 1)
-            {
-                unique_id = 8503926755447648324ull;
-            }
-            // m4n4k4
-            else if(d4 == 1)
-            {
-                unique_id = 8503926755447648324ull;
-            }
-            // m5n5k5
-            else if(d5 == 1)
-            {
-                unique_id = 8503926755447648324ull;
-            }
-            // m6n6k6
-            else if(d6 == 1)
-            {
-                unique_id = 8503926755447648324ull;
-            }
-
-            if(auto candidate = candidates.find(unique_id); candidate != candidates.end())
-            {
-                *winner = candidate->second;
-                return HIPTENSOR_STATUS_SUCCESS;
-            }
-            else
-            {
-                return HIPTENSOR_STATUS_EXECUTION_FAILED;
-            }
-        }
-    };
-
-    hiptensorStatus_t
-        actorCriticModel(ContractionSolution**                                   winner,
-                         std::unordered_map<size_t, ContractionSolution*> const& candidates,
-                         hipDataType                                             typeA,
-                         std::vector<std::size_t> const&                         a_ms_ks_lengths,
-                         std::vector<std::size_t> const&                         a_ms_ks_strides,
-                         std::vector<int32_t> const&                             a_ms_ks_modes,
-                         hipDataType                                             typeB,
-                         std::vector<std::size_t> const&                         b_ns_ks_lengths,
-                         std::vector<std::size_t> const&                         b_ns_ks_strides,
-                         std::vector<int32_t> const&                             b_ns_ks_modes,
-                         hipDataType                                             typeD,
-                         std::vector<std::size_t> const&                         d_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         d_ms_ns_strides,
-                         std::vector<int32_t> const&                             d_ms_ns_modes,
-                         hipDataType                                             typeE,
-                         std::vector<std::size_t> const&                         e_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         e_ms_ns_strides,
-                         std::vector<int32_t> const&                             e_ms_ns_modes,
-                         hiptensorComputeType_t                                  computeType,
-                         const uint64_t                                          workspaceSize)
-    {
-        if(typeA == HIP_R_16F && typeB == HIP_R_16F && typeD == NONE_TYPE && typeE == HIP_R_16F
-           && computeType == HIPTENSOR_COMPUTE_32F)
-        {
-            return ActorCriticSelection<_Float16,
-                                        _Float16,
-                                        _Float16,
-                                        _Float16,
-                                        ContractionOpId_t::SCALE,
-                                        float>::selectWinner(winner,
-                                                             candidates,
-                                                             typeA,
-                                                             a_ms_ks_lengths,
-                                                             a_ms_ks_strides,
-                                                             a_ms_ks_modes,
-                                                             typeB,
-                                                             b_ns_ks_lengths,
-                                                             b_ns_ks_strides,
-                                                             b_ns_ks_modes,
-                                                             typeD,
-                                                             d_ms_ns_lengths,
-                                                             d_ms_ns_strides,
-                                                             d_ms_ns_modes,
-                                                             typeE,
-                                                             e_ms_ns_lengths,
-                                                             e_ms_ns_strides,
-                                                             e_ms_ns_modes,
-                                                             workspaceSize);
-        }
-        else if(typeA == HIP_R_16F && typeB == HIP_R_16F && typeD == HIP_R_16F && typeE == HIP_R_16F
-                && computeType == HIPTENSOR_COMPUTE_32F)
-        {
-            return ActorCriticSelection<_Float16,
-                                        _Float16,
-                                        _Float16,
-                                        _Float16,
-                                        ContractionOpId_t::BILINEAR,
-                                        float>::selectWinner(winner,
-                                                             candidates,
-                                                             typeA,
-                                                             a_ms_ks_lengths,
-                                                             a_ms_ks_strides,
-                                                             a_ms_ks_modes,
-                                                             typeB,
-                                                             b_ns_ks_lengths,
-                                                             b_ns_ks_strides,
-                                                             b_ns_ks_modes,
-                                                             typeD,
-                                                             d_ms_ns_lengths,
-                                                             d_ms_ns_strides,
-                                                             d_ms_ns_modes,
-                                                             typeE,
-                                                             e_ms_ns_lengths,
-                                                             e_ms_ns_strides,
-                                                             e_ms_ns_modes,
-                                                             workspaceSize);
-        }
-        else if(typeA == HIP_R_16BF && typeB == HIP_R_16BF && typeD == NONE_TYPE
-                && typeE == HIP_R_16BF && computeType == HIPTENSOR_COMPUTE_32F)
-        {
-            return ActorCriticSelection<hip_bfloat16,
-                                        hip_bfloat16,
-                                        hip_bfloat16,
-                                        hip_bfloat16,
-                                        ContractionOpId_t::SCALE,
-                                        float>::selectWinner(winner,
-                                                             candidates,
-                                                             typeA,
-                                                             a_ms_ks_lengths,
-                                                             a_ms_ks_strides,
-                                                             a_ms_ks_modes,
-                                                             typeB,
-                                                             b_ns_ks_lengths,
-                                                             b_ns_ks_strides,
-                                                             b_ns_ks_modes,
-                                                             typeD,
-                                                             d_ms_ns_lengths,
-                                                             d_ms_ns_strides,
-                                                             d_ms_ns_modes,
-                                                             typeE,
-                                                             e_ms_ns_lengths,
-                                                             e_ms_ns_strides,
-                                                             e_ms_ns_modes,
-                                                             workspaceSize);
-        }
-        else if(typeA == HIP_R_16BF && typeB == HIP_R_16BF && typeD == HIP_R_16BF
-                && typeE == HIP_R_16BF && computeType == HIPTENSOR_COMPUTE_32F)
-        {
-            return ActorCriticSelection<hip_bfloat16,
-                                        hip_bfloat16,
-                                        hip_bfloat16,
-                                        hip_bfloat16,
-                                        ContractionOpId_t::BILINEAR,
-                                        float>::selectWinner(winner,
-                                                             candidates,
-                                                             typeA,
-                                                             a_ms_ks_lengths,
-                                                             a_ms_ks_strides,
-                                                             a_ms_ks_modes,
-                                                             typeB,
-                                                             b_ns_ks_lengths,
-                                                             b_ns_ks_strides,
-                                                             b_ns_ks_modes,
-                                                             typeD,
-                                                             d_ms_ns_lengths,
-                                                             d_ms_ns_strides,
-                                                             d_ms_ns_modes,
-                                                             typeE,
-                                                             e_ms_ns_lengths,
-                                                             e_ms_ns_strides,
-                                                             e_ms_ns_modes,
-                                                             workspaceSize);
-        }
-        else if(typeA == HIP_R_32F && typeB == HIP_R_32F && typeD == NONE_TYPE && typeE == HIP_R_32F
-                && computeType == HIPTENSOR_COMPUTE_16F)
-        {
-            return ActorCriticSelection<float,
-                                        float,
-                                        float,
-                                        float,
-                                        ContractionOpId_t::SCALE,
-                                        _Float16>::selectWinner(winner,
-                                                                candidates,
-                                                                typeA,
-                                                                a_ms_ks_lengths,
-                                                                a_ms_ks_strides,
-                                                                a_ms_ks_modes,
-                                                                typeB,
-                                                                b_ns_ks_lengths,
-                                                                b_ns_ks_strides,
-                                                                b_ns_ks_modes,
-                                                                typeD,
-                                                                d_ms_ns_lengths,
-                                                                d_ms_ns_strides,
-                                                                d_ms_ns_modes,
-                                                                typeE,
-                                                                e_ms_ns_lengths,
-                                                                e_ms_ns_strides,
-                                                                e_ms_ns_modes,
-                                                                workspaceSize);
-        }
-        else if(typeA == HIP_R_32F && typeB == HIP_R_32F && typeD == HIP_R_32F && typeE == HIP_R_32F
-                && computeType == HIPTENSOR_COMPUTE_16F)
-        {
-            return ActorCriticSelection<float,
-                                        float,
-                                        float,
-                                        float,
-                                        ContractionOpId_t::BILINEAR,
-                                        _Float16>::selectWinner(winner,
-                                                                candidates,
-                                                                typeA,
-                                                                a_ms_ks_lengths,
-                                                                a_ms_ks_strides,
-                                                                a_ms_ks_modes,
-                                                                typeB,
-                                                                b_ns_ks_lengths,
-                                                                b_ns_ks_strides,
-                                                                b_ns_ks_modes,
-                                                                typeD,
-                                                                d_ms_ns_lengths,
-                                                                d_ms_ns_strides,
-                                                                d_ms_ns_modes,
-                                                                typeE,
-                                                                e_ms_ns_lengths,
-                                                                e_ms_ns_strides,
-                                                                e_ms_ns_modes,
-                                                                workspaceSize);
-        }
-        else if(typeA == HIP_R_32F && typeB == HIP_R_32F && typeD == NONE_TYPE && typeE == HIP_R_32F
-                && computeType == HIP_R_16BF)
-        {
-            return ActorCriticSelection<float,
-                                        float,
-                                        float,
-                                        float,
-                                        ContractionOpId_t::SCALE,
-                                        hip_bfloat16>::selectWinner(winner,
-                                                                    candidates,
-                                                                    typeA,
-                                                                    a_ms_ks_lengths,
-                                                                    a_ms_ks_strides,
-                                                                    a_ms_ks_modes,
-                                                                    typeB,
-                                                                    b_ns_ks_lengths,
-                                                                    b_ns_ks_strides,
-                                                                    b_ns_ks_modes,
-                                                                    typeD,
-                                                                    d_ms_ns_lengths,
-                                                                    d_ms_ns_strides,
-                                                                    d_ms_ns_modes,
-                                                                    typeE,
-                                                                    e_ms_ns_lengths,
-                                                                    e_ms_ns_strides,
-                                                                    e_ms_ns_modes,
-                                                                    workspaceSize);
-        }
-        else if(typeA == HIP_R_32F && typeB == HIP_R_32F && typeD == HIP_R_32F && typeE == HIP_R_32F
-                && computeType == HIP_R_16BF)
-        {
-            return ActorCriticSelection<float,
-                                        float,
-                                        float,
-                                        float,
-                                        ContractionOpId_t::BILINEAR,
-                                        hip_bfloat16>::selectWinner(winner,
-                                                                    candidates,
-                                                                    typeA,
-                                                                    a_ms_ks_lengths,
-                                                                    a_ms_ks_strides,
-                                                                    a_ms_ks_modes,
-                                                                    typeB,
-                                                                    b_ns_ks_lengths,
-                                                                    b_ns_ks_strides,
-                                                                    b_ns_ks_modes,
-                                                                    typeD,
-                                                                    d_ms_ns_lengths,
-                                                                    d_ms_ns_strides,
-                                                                    d_ms_ns_modes,
-                                                                    typeE,
-                                                                    e_ms_ns_lengths,
-                                                                    e_ms_ns_strides,
-                                                                    e_ms_ns_modes,
-                                                                    workspaceSize);
-        }
-        else if(typeA == HIP_R_32F && typeB == HIP_R_32F && typeD == NONE_TYPE && typeE == HIP_R_32F
-                && computeType == HIPTENSOR_COMPUTE_32F)
-        {
-            return ActorCriticSelection<float,
-                                        float,
-                                        float,
-                                        float,
-                                        ContractionOpId_t::SCALE,
-                                        float>::selectWinner(winner,
-                                                             candidates,
-                                                             typeA,
-                                                             a_ms_ks_lengths,
-                                                             a_ms_ks_strides,
-                                                             a_ms_ks_modes,
-                                                             typeB,
-                                                             b_ns_ks_lengths,
-                                                             b_ns_ks_strides,
-                                                             b_ns_ks_modes,
-                                                             typeD,
-                                                             d_ms_ns_lengths,
-                                                             d_ms_ns_strides,
-                                                             d_ms_ns_modes,
-                                                             typeE,
-                                                             e_ms_ns_lengths,
-                                                             e_ms_ns_strides,
-                                                             e_ms_ns_modes,
-                                                             workspaceSize);
-        }
-        else if(typeA == HIP_R_32F && typeB == HIP_R_32F && typeD == HIP_R_32F && typeE == HIP_R_32F
-                && computeType == HIPTENSOR_COMPUTE_32F)
-        {
-            return ActorCriticSelection<float,
-                                        float,
-                                        float,
-                                        float,
-                                        ContractionOpId_t::BILINEAR,
-                                        float>::selectWinner(winner,
-                                                             candidates,
-                                                             typeA,
-                                                             a_ms_ks_lengths,
-                                                             a_ms_ks_strides,
-                                                             a_ms_ks_modes,
-                                                             typeB,
-                                                             b_ns_ks_lengths,
-                                                             b_ns_ks_strides,
-                                                             b_ns_ks_modes,
-                                                             typeD,
-                                                             d_ms_ns_lengths,
-                                                             d_ms_ns_strides,
-                                                             d_ms_ns_modes,
-                                                             typeE,
-                                                             e_ms_ns_lengths,
-                                                             e_ms_ns_strides,
-                                                             e_ms_ns_modes,
-                                                             workspaceSize);
-        }
-        else if(typeA == HIP_R_64F && typeB == HIP_R_64F && typeD == NONE_TYPE && typeE == HIP_R_64F
-                && computeType == HIPTENSOR_COMPUTE_32F)
-        {
-            return ActorCriticSelection<double,
-                                        double,
-                                        double,
-                                        double,
-                                        ContractionOpId_t::SCALE,
-                                        float>::selectWinner(winner,
-                                                             candidates,
-                                                             typeA,
-                                                             a_ms_ks_lengths,
-                                                             a_ms_ks_strides,
-                                                             a_ms_ks_modes,
-                                                             typeB,
-                                                             b_ns_ks_lengths,
-                                                             b_ns_ks_strides,
-                                                             b_ns_ks_modes,
-                                                             typeD,
-                                                             d_ms_ns_lengths,
-                                                             d_ms_ns_strides,
-                                                             d_ms_ns_modes,
-                                                             typeE,
-                                                             e_ms_ns_lengths,
-                                                             e_ms_ns_strides,
-                                                             e_ms_ns_modes,
-                                                             workspaceSize);
-        }
-        else if(typeA == HIP_R_64F && typeB == HIP_R_64F && typeD == HIP_R_64F && typeE == HIP_R_64F
-                && computeType == HIPTENSOR_COMPUTE_32F)
-        {
-            return ActorCriticSelection<double,
-                                        double,
-                                        double,
-                                        double,
-                                        ContractionOpId_t::BILINEAR,
-                                        float>::selectWinner(winner,
-                                                             candidates,
-                                                             typeA,
-                                                             a_ms_ks_lengths,
-                                                             a_ms_ks_strides,
-                                                             a_ms_ks_modes,
-                                                             typeB,
-                                                             b_ns_ks_lengths,
-                                                             b_ns_ks_strides,
-                                                             b_ns_ks_modes,
-                                                             typeD,
-                                                             d_ms_ns_lengths,
-                                                             d_ms_ns_strides,
-                                                             d_ms_ns_modes,
-                                                             typeE,
-                                                             e_ms_ns_lengths,
-                                                             e_ms_ns_strides,
-                                                             e_ms_ns_modes,
-                                                             workspaceSize);
-        }
-        else if(typeA == HIP_R_64F && typeB == HIP_R_64F && typeD == NONE_TYPE && typeE == HIP_R_64F
-                && computeType == HIPTENSOR_COMPUTE_64F)
-        {
-            return ActorCriticSelection<double,
-                                        double,
-                                        double,
-                                        double,
-                                        ContractionOpId_t::SCALE,
-                                        double>::selectWinner(winner,
-                                                              candidates,
-                                                              typeA,
-                                                              a_ms_ks_lengths,
-                                                              a_ms_ks_strides,
-                                                              a_ms_ks_modes,
-                                                              typeB,
-                                                              b_ns_ks_lengths,
-                                                              b_ns_ks_strides,
-                                                              b_ns_ks_modes,
-                                                              typeD,
-                                                              d_ms_ns_lengths,
-                                                              d_ms_ns_strides,
-                                                              d_ms_ns_modes,
-                                                              typeE,
-                                                              e_ms_ns_lengths,
-                                                              e_ms_ns_strides,
-                                                              e_ms_ns_modes,
-                                                              workspaceSize);
-        }
-        else if(typeA == HIP_R_64F && typeB == HIP_R_64F && typeD == HIP_R_64F && typeE == HIP_R_64F
-                && computeType == HIPTENSOR_COMPUTE_64F)
-        {
-            return ActorCriticSelection<double,
-                                        double,
-                                        double,
-                                        double,
-                                        ContractionOpId_t::BILINEAR,
-                                        double>::selectWinner(winner,
-                                                              candidates,
-                                                              typeA,
-                                                              a_ms_ks_lengths,
-                                                              a_ms_ks_strides,
-                                                              a_ms_ks_modes,
-                                                              typeB,
-                                                              b_ns_ks_lengths,
-                                                              b_ns_ks_strides,
-                                                              b_ns_ks_modes,
-                                                              typeD,
-                                                              d_ms_ns_lengths,
-                                                              d_ms_ns_strides,
-                                                              d_ms_ns_modes,
-                                                              typeE,
-                                                              e_ms_ns_lengths,
-                                                              e_ms_ns_strides,
-                                                              e_ms_ns_modes,
-                                                              workspaceSize);
-        }
-        else if(typeA == HIP_C_32F && typeB == HIP_C_32F && typeD == NONE_TYPE && typeE == HIP_C_32F
-                && computeType == HIPTENSOR_COMPUTE_C32F)
-        {
-            return ActorCriticSelection<hipFloatComplex,
-                                        hipFloatComplex,
-                                        hipFloatComplex,
-                                        hipFloatComplex,
-                                        ContractionOpId_t::SCALE_COMPLEX,
-                                        hipFloatComplex>::selectWinner(winner,
-                                                                       candidates,
-                                                                       typeA,
-                                                                       a_ms_ks_lengths,
-                                                                       a_ms_ks_strides,
-                                                                       a_ms_ks_modes,
-                                                                       typeB,
-                                                                       b_ns_ks_lengths,
-                                                                       b_ns_ks_strides,
-                                                                       b_ns_ks_modes,
-                                                                       typeD,
-                                                                       d_ms_ns_lengths,
-                                                                       d_ms_ns_strides,
-                                                                       d_ms_ns_modes,
-                                                                       typeE,
-                                                                       e_ms_ns_lengths,
-                                                                       e_ms_ns_strides,
-                                                                       e_ms_ns_modes,
-                                                                       workspaceSize);
-        }
-        else if(typeA == HIP_C_32F && typeB == HIP_C_32F && typeD == HIP_C_32F && typeE == HIP_C_32F
-                && computeType == HIPTENSOR_COMPUTE_C32F)
-        {
-            return ActorCriticSelection<hipFloatComplex,
-                                        hipFloatComplex,
-                                        hipFloatComplex,
-                                        hipFloatComplex,
-                                        ContractionOpId_t::BILINEAR_COMPLEX,
-                                        hipFloatComplex>::selectWinner(winner,
-                                                                       candidates,
-                                                                       typeA,
-                                                                       a_ms_ks_lengths,
-                                                                       a_ms_ks_strides,
-                                                                       a_ms_ks_modes,
-                                                                       typeB,
-                                                                       b_ns_ks_lengths,
-                                                                       b_ns_ks_strides,
-                                                                       b_ns_ks_modes,
-                                                                       typeD,
-                                                                       d_ms_ns_lengths,
-                                                                       d_ms_ns_strides,
-                                                                       d_ms_ns_modes,
-                                                                       typeE,
-                                                                       e_ms_ns_lengths,
-                                                                       e_ms_ns_strides,
-                                                                       e_ms_ns_modes,
-                                                                       workspaceSize);
-        }
-        else if(typeA == HIP_C_64F && typeB == HIP_C_64F && typeD == NONE_TYPE && typeE == HIP_C_64F
-                && computeType == HIPTENSOR_COMPUTE_C64F)
-        {
-            return ActorCriticSelection<hipDoubleComplex,
-                                        hipDoubleComplex,
-                                        hipDoubleComplex,
-                                        hipDoubleComplex,
-                                        ContractionOpId_t::SCALE_COMPLEX,
-                                        hipDoubleComplex>::selectWinner(winner,
-                                                                        candidates,
-                                                                        typeA,
-                                                                        a_ms_ks_lengths,
-                                                                        a_ms_ks_strides,
-                                                                        a_ms_ks_modes,
-                                                                        typeB,
-                                                                        b_ns_ks_lengths,
-                                                                        b_ns_ks_strides,
-                                                                        b_ns_ks_modes,
-                                                                        typeD,
-                                                                        d_ms_ns_lengths,
-                                                                        d_ms_ns_strides,
-                                                                        d_ms_ns_modes,
-                                                                        typeE,
-                                                                        e_ms_ns_lengths,
-                                                                        e_ms_ns_strides,
-                                                                        e_ms_ns_modes,
-                                                                        workspaceSize);
-        }
-        else if(typeA == HIP_C_64F && typeB == HIP_C_64F && typeD == HIP_C_64F && typeE == HIP_C_64F
-                && computeType == HIPTENSOR_COMPUTE_C64F)
-        {
-            return ActorCriticSelection<hipDoubleComplex,
-                                        hipDoubleComplex,
-                                        hipDoubleComplex,
-                                        hipDoubleComplex,
-                                        ContractionOpId_t::BILINEAR_COMPLEX,
-                                        hipDoubleComplex>::selectWinner(winner,
-                                                                        candidates,
-                                                                        typeA,
-                                                                        a_ms_ks_lengths,
-                                                                        a_ms_ks_strides,
-                                                                        a_ms_ks_modes,
-                                                                        typeB,
-                                                                        b_ns_ks_lengths,
-                                                                        b_ns_ks_strides,
-                                                                        b_ns_ks_modes,
-                                                                        typeD,
-                                                                        d_ms_ns_lengths,
-                                                                        d_ms_ns_strides,
-                                                                        d_ms_ns_modes,
-                                                                        typeE,
-                                                                        e_ms_ns_lengths,
-                                                                        e_ms_ns_strides,
-                                                                        e_ms_ns_modes,
-                                                                        workspaceSize);
-        }
         return HIPTENSOR_STATUS_EXECUTION_FAILED;
     }
 }
@@ -32,9 +32,13 @@
 
 namespace hiptensor
 {
+    class Allocator;
     class ContractionSolution;
     struct PerfMetrics;
 
+    // Times every candidate on the problem and selects the fastest. The timing of each
+    // candidate that ran is appended to timings if given. Kernels are launched coldIters
+    // times untimed, then timed as the average of repeats launches.
     hiptensorStatus_t bruteForceModel(ContractionSolution**                    winner,
                                       std::vector<ContractionSolution*> const& candidates,
                                       hipDataType                              typeA,
@@ -54,41 +58,18 @@ namespace hiptensor
                                       std::vector<std::size_t> const&          e_ms_ns_strides,
                                       std::vector<int32_t> const&              e_ms_ns_modes,
                                       hiptensorComputeType_t                   computeType,
-                                      const uint64_t                           workspaceSize);
-
-    template <typename A,
-              typename B,
-              typename C,
-              typename D,
-              ContractionOpId_t ContractionOp,
-              typename ComputeType>
-    struct ActorCriticSelection
-    {
-        static hiptensorStatus_t
-            selectWinner(ContractionSolution**                                   winner,
-                         std::unordered_map<size_t, ContractionSolution*> const& candidates,
-                         hipDataType                                             typeA,
-                         std::vector<std::size_t> const&                         a_ms_ks_lengths,
-                         std::vector<std::size_t> const&                         a_ms_ks_strides,
-                         std::vector<int32_t> const&                             a_ms_ks_modes,
-                         hipDataType                                             typeB,
-                         std::vector<std::size_t> const&                         b_ns_ks_lengths,
-                         std::vector<std::size_t> const&                         b_ns_ks_strides,
-                         std::vector<int32_t> const&                             b_ns_ks_modes,
-                         hipDataType                                             typeD,
-                         std::vector<std::size_t> const&                         d_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         d_ms_ns_strides,
-                         std::vector<int32_t> const&                             d_ms_ns_modes,
-                         hipDataType                                             typeE,
-                         std::vector<std::size_t> const&                         e_ms_ns_lengths,
-                         std::vector<std::size_t> const&                         e_ms_ns_strides,
-                         std::vector<int32_t> const&                             e_ms_ns_modes,
-                         const uint64_t                                          workspaceSize);
-    };
+                                      const uint64_t                           workspaceSize,
+                                      Allocator&                               allocator,
+                                      std::vector<PerfMetrics>*                timings = nullptr,
+                                      int32_t                                  coldIters = 5,
+                                      int32_t                                  repeats = 50);
 
+    // Selects the first solution that the rules of the selection model name for the
+    // problem and that can run it. Fails if there is none.
     hiptensorStatus_t
         actorCriticModel(ContractionSolution**                                   winner,
                          std::unordered_map<size_t, ContractionSolution*> const& candidates,
+                         int32_t                                                 contractionOpId,
                          hipDataType                                             typeA,
                          std::vector<std::size_t> const&                         a_ms_ks_lengths,
                          std::vector<std::size_t> const&                         a_ms_ks_strides,
@@ -106,7 +87,8 @@ namespace hiptensor
                          std::vector<std::size_t> const&                         e_ms_ns_strides,
                          std::vector<int32_t> const&                             e_ms_ns_modes,
                          hiptensorComputeType_t                                  computeType,
-                         const uint64_t                                          workspaceSize);
+                         const uint64_t                                          workspaceSize,
+                         uint32_t                                                deviceArch);
 
 } // namespace hiptensor
 
@@ -0,0 +1,272 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+#include "contraction_selection_cache.hpp"
+#include "contraction_solution.hpp"
+#include "hash.hpp"
+
+namespace hiptensor
+{
+    namespace
+    {
+        constexpr char CacheFileTag[] = "hiptensor_selection_cache";
+    }
+
+    ContractionSelectionCache::ContractionSelectionCache()
+        : mDirty(false)
+    {
+    }
+
+    ContractionSelectionCache::~ContractionSelectionCache()
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        if(mDirty && !mFileName.empty())
+        {
+            writeUnlocked(mFileName);
+        }
+    }
+
+    ContractionSelectionCache::Key
+        ContractionSelectionCache::hashProblem(int32_t                         contractionOpId,
+                                               hipDataType                     typeA,
+                                               hipDataType                     typeB,
+                                               hipDataType                     typeD,
+                                               hipDataType                     typeE,
+                                               hiptensorComputeType_t          typeCompute,
+                                               std::vector<std::size_t> const& a_ms_ks_lengths,
+                                               std::vector<std::size_t> const& a_ms_ks_strides,
+                                               std::vector<int32_t> const&     a_ms_ks_modes,
+                                               std::vector<std::size_t> const& b_ns_ks_lengths,
+                                               std::vector<std::size_t> const& b_ns_ks_strides,
+                                               std::vector<int32_t> const&     b_ns_ks_modes,
+                                               std::vector<std::size_t> const& d_ms_ns_lengths,
+                                               std::vector<std::size_t> const& d_ms_ns_strides,
+                                               std::vector<int32_t> const&     d_ms_ns_modes,
+                                               std::vector<std::size_t> const& e_ms_ns_lengths,
+                                               std::vector<std::size_t> const& e_ms_ns_strides,
+                                               std::vector<int32_t> const&     e_ms_ns_modes,
+                                               uint32_t                        deviceArch)
+    {
+        auto normal = normalizeTensorModes(a_ms_ks_lengths,
+                                           a_ms_ks_strides,
+                                           a_ms_ks_modes,
+                                           b_ns_ks_lengths,
+                                           b_ns_ks_strides,
+                                           b_ns_ks_modes,
+                                           e_ms_ns_lengths,
+                                           e_ms_ns_strides,
+                                           e_ms_ns_modes);
+
+        // D is laid out against the same A and B as E, its normalized
+        // extents are those of the result tensor.
+        auto normalD = normal;
+        if(!d_ms_ns_lengths.empty())
+        {
+            normalD = normalizeTensorModes(a_ms_ks_lengths,
+                                           a_ms_ks_strides,
+                                           a_ms_ks_modes,
+                                           b_ns_ks_lengths,
+                                           b_ns_ks_strides,
+                                           b_ns_ks_modes,
+                                           d_ms_ns_lengths,
+                                           d_ms_ns_strides,
+                                           d_ms_ns_modes);
+        }
+
+        return Hash{}(Version,
+                      contractionOpId,
+                      (int32_t)typeA,
+                      (int32_t)typeB,
+                      (int32_t)typeD,
+                      (int32_t)typeE,
+                      (int32_t)typeCompute,
+                      deviceArch,
+                      normal,
+                      d_ms_ns_lengths.empty(),
+                      normalD[4],
+                      normalD[5]);
+    }
+
+    bool ContractionSelectionCache::lookup(Key key, Uid* uid) const
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        auto                        it = mEntries.find(key);
+        if(it == mEntries.end())
+        {
+            return false;
+        }
+
+        *uid = it->second;
+        return true;
+    }
+
+    void ContractionSelectionCache::insert(Key key, Uid uid)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        auto                        it = mEntries.find(key);
+        if(it == mEntries.end() || it->second != uid)
+        {
+            mEntries[key] = uid;
+            mDirty        = true;
+        }
+    }
+
+    void ContractionSelectionCache::erase(Key key)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        if(mEntries.erase(key) > 0)
+        {
+            mDirty = true;
+        }
+    }
+
+    void ContractionSelectionCache::clear()
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mEntries.clear();
+        mFileName.clear();
+        mDirty = false;
+    }
+
+    std::size_t ContractionSelectionCache::size() const
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return mEntries.size();
+    }
+
+    std::string ContractionSelectionCache::fileName() const
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return mFileName;
+    }
+
+    hiptensorStatus_t ContractionSelectionCache::load(std::string const& fileName)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        if(fileName.empty())
+        {
+            return HIPTENSOR_STATUS_INVALID_VALUE;
+        }
+
+        // Remember the destination even if the file doesn't exist yet,
+        // so that a first run populates it.
+        mFileName = fileName;
+
+        std::ifstream file(fileName);
+        if(!file.is_open())
+        {
+            return HIPTENSOR_STATUS_IO_ERROR;
+        }
+
+        std::string tag;
+        uint32_t    version = 0u;
+        if(!(file >> tag >> version) || tag != CacheFileTag || version != Version)
+        {
+            // Stale or foreign file: start over, it will be rewritten.
+            mDirty = true;
+            return HIPTENSOR_STATUS_IO_ERROR;
+        }
+
+        std::unordered_map<Key, Uid> entries;
+        Key                          key;
+        Uid                          uid;
+        while(file >> std::hex >> key >> uid)
+        {
+            entries[key] = uid;
+        }
+
+        if(!file.eof())
+        {
+            mDirty = true;
+            return HIPTENSOR_STATUS_IO_ERROR;
+        }
+
+        // Entries resolved in this process take precedence
+        for(auto const& entry : mEntries)
+        {
+            entries[entry.first] = entry.second;
+        }
+        mEntries = std::move(entries);
+
+        return HIPTENSOR_STATUS_SUCCESS;
+    }
+
+    hiptensorStatus_t ContractionSelectionCache::write(std::string const& fileName /*= ""*/)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return writeUnlocked(fileName.empty() ? mFileName : fileName);
+    }
+
+    hiptensorStatus_t ContractionSelectionCache::writeUnlocked(std::string const& fileName)
+    {
+        if(fileName.empty())
+        {
+            return HIPTENSOR_STATUS_INVALID_VALUE;
+        }
+
+        // Write to a temporary file first so that concurrent readers
+        // never observe a partially written cache.
+        auto tmpFileName = fileName + ".tmp";
+        {
+            std::ofstream file(tmpFileName, std::ios::trunc);
+            if(!file.is_open())
+            {
+                return HIPTENSOR_STATUS_IO_ERROR;
+            }
+
+            file << CacheFileTag << " " << Version << "\n" << std::hex;
+            for(auto const& entry : mEntries)
+            {
+                file << entry.first << " " << entry.second << "\n";
+            }
+
+            if(!file.good())
+            {
+                std::remove(tmpFileName.c_str());
+                return HIPTENSOR_STATUS_IO_ERROR;
+            }
+        }
+
+        if(std::rename(tmpFileName.c_str(), fileName.c_str()) != 0)
+        {
+            std::remove(tmpFileName.c_str());
+            return HIPTENSOR_STATUS_IO_ERROR;
+        }
+
+        if(fileName == mFileName)
+        {
+            mDirty = false;
+        }
+
+        return HIPTENSOR_STATUS_SUCCESS;
+    }
+
+} // namespace hiptensor
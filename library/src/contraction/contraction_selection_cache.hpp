@@ -0,0 +1,121 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef HIPTENSOR_CONTRACTION_SELECTION_CACHE_HPP
+#define HIPTENSOR_CONTRACTION_SELECTION_CACHE_HPP
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <hiptensor/hiptensor_types.hpp>
+
+#include "singleton.hpp"
+
+namespace hiptensor
+{
+    // Persistent record of kernel selection winners.
+    // Maps a contraction problem signature to the uid of the solution that
+    // won selection for it, so that repeated runs can skip brute-force timing.
+    class ContractionSelectionCache : public LazySingleton<ContractionSelectionCache>
+    {
+    public:
+        using Key = std::size_t;
+        using Uid = std::size_t;
+
+        // Bump when the key hashing or the file layout changes.
+        // Files with a different version are ignored.
+        static constexpr uint32_t Version = 3u;
+
+        // For static initialization
+        friend std::unique_ptr<ContractionSelectionCache>
+            std::make_unique<ContractionSelectionCache>();
+
+        // Flushes any new entries back to the file they were loaded from.
+        ~ContractionSelectionCache();
+
+        // Problem signature, taken over the normalized tensor modes so that
+        // equivalent problems described with different mode labels collide.
+        // The D and E layouts are part of the signature: the best kernel, and
+        // whether it applies at all, depends on them. D may be left empty.
+        static Key hashProblem(int32_t                         contractionOpId,
+                               hipDataType                     typeA,
+                               hipDataType                     typeB,
+                               hipDataType                     typeD,
+                               hipDataType                     typeE,
+                               hiptensorComputeType_t          typeCompute,
+                               std::vector<std::size_t> const& a_ms_ks_lengths,
+                               std::vector<std::size_t> const& a_ms_ks_strides,
+                               std::vector<int32_t> const&     a_ms_ks_modes,
+                               std::vector<std::size_t> const& b_ns_ks_lengths,
+                               std::vector<std::size_t> const& b_ns_ks_strides,
+                               std::vector<int32_t> const&     b_ns_ks_modes,
+                               std::vector<std::size_t> const& d_ms_ns_lengths,
+                               std::vector<std::size_t> const& d_ms_ns_strides,
+                               std::vector<int32_t> const&     d_ms_ns_modes,
+                               std::vector<std::size_t> const& e_ms_ns_lengths,
+                               std::vector<std::size_t> const& e_ms_ns_strides,
+                               std::vector<int32_t> const&     e_ms_ns_modes,
+                               uint32_t                        deviceArch);
+
+        bool lookup(Key key, Uid* uid) const;
+        void insert(Key key, Uid uid);
+        void erase(Key key);
+        void clear();
+
+        std::size_t size() const;
+
+        // Merges the entries of the given file into the cache. The file name
+        // is remembered as the default destination for write().
+        hiptensorStatus_t load(std::string const& fileName);
+
+        // Writes all entries to the given file, or to the last loaded file
+        // if fileName is empty.
+        hiptensorStatus_t write(std::string const& fileName = "");
+
+        std::string fileName() const;
+
+    private:
+        ContractionSelectionCache();
+        ContractionSelectionCache(ContractionSelectionCache const&)            = delete;
+        ContractionSelectionCache(ContractionSelectionCache&&)                 = delete;
+        ContractionSelectionCache& operator=(ContractionSelectionCache const&) = delete;
+        ContractionSelectionCache& operator=(ContractionSelectionCache&&)      = delete;
+
+        hiptensorStatus_t writeUnlocked(std::string const& fileName);
+
+    private:
+        std::unordered_map<Key, Uid> mEntries;
+        std::string                  mFileName;
+        bool                         mDirty;
+
+        mutable std::mutex mMutex;
+    };
+
+} // namespace hiptensor
+
+#endif // HIPTENSOR_CONTRACTION_SELECTION_CACHE_HPP
@@ -0,0 +1,565 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+#include "contraction_selection_model.hpp"
+#include "contraction_selection_model_table.hpp"
+#include "contraction_types.hpp"
+#include "data_types.hpp"
+
+namespace hiptensor
+{
+    namespace
+    {
+        constexpr char ModelFileTag[] = "hiptensor_selection_model";
+
+        bool parseType(std::string const& value, hipDataType& type)
+        {
+            for(auto candidate : {HIP_R_16F,
+                                  HIP_R_16BF,
+                                  HIP_R_32F,
+                                  HIP_R_64F,
+                                  HIP_C_32F,
+                                  HIP_C_64F,
+                                  HIP_R_8I,
+                                  HIP_R_8U,
+                                  HIP_R_32I,
+                                  HIP_R_32U,
+                                  NONE_TYPE})
+            {
+                if(hipTypeToString(candidate) == value)
+                {
+                    type = candidate;
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        bool parseComputeType(std::string const& value, hiptensorComputeType_t& type)
+        {
+            for(auto candidate : {HIPTENSOR_COMPUTE_16F,
+                                  HIPTENSOR_COMPUTE_16BF,
+                                  HIPTENSOR_COMPUTE_32F,
+                                  HIPTENSOR_COMPUTE_64F,
+                                  HIPTENSOR_COMPUTE_C32F,
+                                  HIPTENSOR_COMPUTE_C64F,
+                                  HIPTENSOR_COMPUTE_8I,
+                                  HIPTENSOR_COMPUTE_8U,
+                                  HIPTENSOR_COMPUTE_32I,
+                                  HIPTENSOR_COMPUTE_32U})
+            {
+                if(computeTypeToString(candidate) == value)
+                {
+                    type = candidate;
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        constexpr std::pair<char const*, ContractionOpId_t> OpNames[]
+            = {{"scale", ContractionOpId_t::SCALE},
+               {"bilinear", ContractionOpId_t::BILINEAR},
+               {"scale_complex", ContractionOpId_t::SCALE_COMPLEX},
+               {"bilinear_complex", ContractionOpId_t::BILINEAR_COMPLEX}};
+
+        bool parseOpId(std::string const& value, int32_t& opId)
+        {
+            for(auto const& op : OpNames)
+            {
+                if(value == op.first)
+                {
+                    opId = (int32_t)op.second;
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        std::string formatOpId(int32_t opId)
+        {
+            for(auto const& op : OpNames)
+            {
+                if(opId == (int32_t)op.second)
+                {
+                    return op.first;
+                }
+            }
+            return std::to_string(opId);
+        }
+
+        bool parseUnsigned(std::string const& value, std::size_t& result, int base = 10)
+        {
+            if(value.empty() || value[0] == '-')
+            {
+                return false;
+            }
+
+            char* end = nullptr;
+            result    = std::strtoull(value.c_str(), &end, base);
+            return *end == '\0';
+        }
+
+        // gfx942
+        bool parseArch(std::string const& value, uint32_t& arch)
+        {
+            std::size_t result;
+            if(value.compare(0, 3, "gfx") != 0 || !parseUnsigned(value.substr(3), result, 16))
+            {
+                return false;
+            }
+            arch = (uint32_t)result;
+            return true;
+        }
+
+        std::string formatArch(uint32_t arch)
+        {
+            std::ostringstream value;
+            value << "gfx" << std::hex << arch;
+            return value.str();
+        }
+
+        // Exactly n, or from lo to hi inclusive with either bound left open: n, lo:hi,
+        // lo:, :hi
+        bool parseRange(std::string const& value, ContractionSelectionModel::Range& range)
+        {
+            auto colon = value.find(':');
+            if(colon == std::string::npos)
+            {
+                std::size_t extent;
+                if(!parseUnsigned(value, extent))
+                {
+                    return false;
+                }
+                range = {extent, extent};
+                return true;
+            }
+
+            auto lo = value.substr(0, colon);
+            auto hi = value.substr(colon + 1);
+            range   = {0u, std::numeric_limits<std::size_t>::max()};
+            return (lo.empty() || parseUnsigned(lo, range.first))
+                   && (hi.empty() || parseUnsigned(hi, range.second));
+        }
+
+        std::string formatRange(ContractionSelectionModel::Range const& range)
+        {
+            if(range.first == range.second)
+            {
+                return std::to_string(range.first);
+            }
+
+            auto lo = range.first == 0u ? "" : std::to_string(range.first);
+            auto hi = range.second == std::numeric_limits<std::size_t>::max()
+                          ? ""
+                          : std::to_string(range.second);
+            return lo + ":" + hi;
+        }
+
+        bool parseLayout(std::string const& value, char outer, bool& contiguousK)
+        {
+            if(value.size() != 1 || (value[0] != outer && value[0] != 'k'))
+            {
+                return false;
+            }
+            contiguousK = value[0] == 'k';
+            return true;
+        }
+
+        bool parseRule(std::string const& line, ContractionSelectionModel::Rule& rule)
+        {
+            std::istringstream tokens(line);
+            std::string        token;
+            bool               hasUid = false;
+            while(tokens >> token)
+            {
+                auto equals = token.find('=');
+                if(equals == std::string::npos)
+                {
+                    return false;
+                }
+
+                auto key   = token.substr(0, equals);
+                auto value = token.substr(equals + 1);
+
+                hipDataType                      type        = NONE_TYPE;
+                hiptensorComputeType_t           computeType = HIPTENSOR_COMPUTE_32F;
+                int32_t                          opId        = 0;
+                uint32_t                         arch        = 0u;
+                std::size_t                      number      = 0u;
+                ContractionSelectionModel::Range range       = {0u, 0u};
+                bool                             contiguousK = false;
+
+                // Fields are set before validation: the rule is dropped on failure
+                bool parsed = false;
+                if(key == "op")
+                {
+                    parsed                = parseOpId(value, opId);
+                    rule.mContractionOpId = opId;
+                }
+                else if(key == "a" || key == "b" || key == "d" || key == "e")
+                {
+                    auto& field = key == "a"   ? rule.mTypeA
+                                  : key == "b" ? rule.mTypeB
+                                  : key == "d" ? rule.mTypeD
+                                               : rule.mTypeE;
+                    parsed      = parseType(value, type);
+                    field       = type;
+                }
+                else if(key == "compute")
+                {
+                    parsed            = parseComputeType(value, computeType);
+                    rule.mTypeCompute = computeType;
+                }
+                else if(key == "arch")
+                {
+                    parsed           = parseArch(value, arch);
+                    rule.mDeviceArch = arch;
+                }
+                else if(key == "rank_m" || key == "rank_n" || key == "rank_k")
+                {
+                    auto& field = key == "rank_m"   ? rule.mRankM
+                                  : key == "rank_n" ? rule.mRankN
+                                                    : rule.mRankK;
+                    parsed      = parseUnsigned(value, number);
+                    field       = (uint32_t)number;
+                }
+                else if(key == "m" || key == "n" || key == "k")
+                {
+                    auto& field = key == "m" ? rule.mM : key == "n" ? rule.mN : rule.mK;
+                    parsed      = parseRange(value, range);
+                    field       = range;
+                }
+                else if(key == "layout_a" || key == "layout_b")
+                {
+                    auto& field = key == "layout_a" ? rule.mContiguousKA : rule.mContiguousKB;
+                    parsed      = parseLayout(value, key == "layout_a" ? 'm' : 'n', contiguousK);
+                    field       = contiguousK;
+                }
+                else if(key == "unit")
+                {
+                    parsed           = parseUnsigned(value, number) && number <= 1u;
+                    rule.mUnitExtent = number == 1u;
+                }
+                else if(key == "uid")
+                {
+                    parsed = hasUid = parseUnsigned(value, rule.mUid);
+                }
+
+                if(!parsed)
+                {
+                    return false;
+                }
+            }
+
+            return hasUid;
+        }
+
+        // Position of the fastest-varying mode of extent > 1, packed strides if unset
+        std::size_t contiguousMode(std::vector<std::size_t> const& lengths,
+                                   std::vector<std::size_t> const& strides)
+        {
+            if(strides.size() != lengths.size())
+            {
+                return HIPTENSOR_DATA_LAYOUT_COL_MAJOR || lengths.empty() ? 0u
+                                                                          : lengths.size() - 1;
+            }
+
+            std::size_t position = 0u;
+            for(std::size_t i = 0; i < lengths.size(); i++)
+            {
+                if(lengths[i] > 1 && (lengths[position] <= 1 || strides[i] < strides[position]))
+                {
+                    position = i;
+                }
+            }
+            return position;
+        }
+
+        template <typename T>
+        bool matchField(std::optional<T> const& field, T const& value)
+        {
+            return !field || *field == value;
+        }
+
+        bool matchRange(std::optional<ContractionSelectionModel::Range> const& range,
+                        std::size_t                                             extent)
+        {
+            return !range || (range->first <= extent && extent <= range->second);
+        }
+    }
+
+    bool ContractionSelectionModel::Rule::matches(Features const& features) const
+    {
+        return matchField(mContractionOpId, features.mContractionOpId)
+               && matchField(mTypeA, features.mTypeA) && matchField(mTypeB, features.mTypeB)
+               && matchField(mTypeD, features.mTypeD) && matchField(mTypeE, features.mTypeE)
+               && matchField(mTypeCompute, features.mTypeCompute)
+               && matchField(mDeviceArch, features.mDeviceArch)
+               && matchField(mRankM, features.mRankM) && matchField(mRankN, features.mRankN)
+               && matchField(mRankK, features.mRankK) && matchRange(mM, features.mM)
+               && matchRange(mN, features.mN) && matchRange(mK, features.mK)
+               && matchField(mContiguousKA, features.mContiguousKA)
+               && matchField(mContiguousKB, features.mContiguousKB)
+               && matchField(mUnitExtent, features.mUnitExtent);
+    }
+
+    ContractionSelectionModel::ContractionSelectionModel()
+    {
+        reset();
+    }
+
+    ContractionSelectionModel::Features
+        ContractionSelectionModel::makeFeatures(int32_t                         contractionOpId,
+                                                hipDataType                     typeA,
+                                                hipDataType                     typeB,
+                                                hipDataType                     typeD,
+                                                hipDataType                     typeE,
+                                                hiptensorComputeType_t          typeCompute,
+                                                std::vector<std::size_t> const& a_ms_ks_lengths,
+                                                std::vector<std::size_t> const& a_ms_ks_strides,
+                                                std::vector<int32_t> const&     a_ms_ks_modes,
+                                                std::vector<std::size_t> const& b_ns_ks_lengths,
+                                                std::vector<std::size_t> const& b_ns_ks_strides,
+                                                std::vector<int32_t> const&     b_ns_ks_modes,
+                                                std::vector<int32_t> const&     e_ms_ns_modes,
+                                                uint32_t                        deviceArch)
+    {
+        Features features = {contractionOpId,
+                             typeA,
+                             typeB,
+                             typeD,
+                             typeE,
+                             typeCompute,
+                             deviceArch,
+                             0u,
+                             0u,
+                             0u,
+                             1u,
+                             1u,
+                             1u,
+                             false,
+                             false,
+                             false};
+
+        auto isOutput = [&e_ms_ns_modes](int32_t mode) {
+            return std::find(e_ms_ns_modes.cbegin(), e_ms_ns_modes.cend(), mode)
+                   != e_ms_ns_modes.cend();
+        };
+
+        // Modes of A (B) are its M (N) modes if D holds them, K modes otherwise
+        for(std::size_t i = 0; i < a_ms_ks_modes.size() && i < a_ms_ks_lengths.size(); i++)
+        {
+            auto outer = isOutput(a_ms_ks_modes[i]);
+            (outer ? features.mRankM : features.mRankK)++;
+            (outer ? features.mM : features.mK) *= a_ms_ks_lengths[i];
+        }
+        for(std::size_t i = 0; i < b_ns_ks_modes.size() && i < b_ns_ks_lengths.size(); i++)
+        {
+            if(isOutput(b_ns_ks_modes[i]))
+            {
+                features.mRankN++;
+                features.mN *= b_ns_ks_lengths[i];
+            }
+        }
+
+        if(!a_ms_ks_modes.empty())
+        {
+            auto mode = a_ms_ks_modes[contiguousMode(a_ms_ks_lengths, a_ms_ks_strides)];
+            features.mContiguousKA = !isOutput(mode);
+        }
+        if(!b_ns_ks_modes.empty())
+        {
+            auto mode = b_ns_ks_modes[contiguousMode(b_ns_ks_lengths, b_ns_ks_strides)];
+            features.mContiguousKB = !isOutput(mode);
+        }
+
+        features.mUnitExtent
+            = std::count(a_ms_ks_lengths.cbegin(), a_ms_ks_lengths.cend(), 1u) > 0
+              || std::count(b_ns_ks_lengths.cbegin(), b_ns_ks_lengths.cend(), 1u) > 0;
+
+        return features;
+    }
+
+    std::string ContractionSelectionModel::toString(Rule const& rule)
+    {
+        std::ostringstream line;
+        auto               field = [&line](char const* key, auto const& value, auto format) {
+            if(value)
+            {
+                line << key << '=' << format(*value) << ' ';
+            }
+        };
+
+        auto formatType = [](hipDataType type) { return hipTypeToString(type); };
+        auto formatRank = [](uint32_t rank) { return rank; };
+
+        field("op", rule.mContractionOpId, formatOpId);
+        field("a", rule.mTypeA, formatType);
+        field("b", rule.mTypeB, formatType);
+        field("d", rule.mTypeD, formatType);
+        field("e", rule.mTypeE, formatType);
+        field("compute", rule.mTypeCompute, [](hiptensorComputeType_t type) {
+            return computeTypeToString(type);
+        });
+        field("arch", rule.mDeviceArch, formatArch);
+        field("rank_m", rule.mRankM, formatRank);
+        field("rank_n", rule.mRankN, formatRank);
+        field("rank_k", rule.mRankK, formatRank);
+        field("m", rule.mM, formatRange);
+        field("n", rule.mN, formatRange);
+        field("k", rule.mK, formatRange);
+        field("layout_a", rule.mContiguousKA, [](bool k) { return k ? 'k' : 'm'; });
+        field("layout_b", rule.mContiguousKB, [](bool k) { return k ? 'k' : 'n'; });
+        field("unit", rule.mUnitExtent, [](bool unit) { return unit ? 1 : 0; });
+
+        line << "uid=" << rule.mUid;
+        return line.str();
+    }
+
+    bool ContractionSelectionModel::fromString(std::string const& line, Rule& rule)
+    {
+        Rule result;
+        if(!parseRule(line.substr(0, line.find('#')), result))
+        {
+            return false;
+        }
+
+        rule = std::move(result);
+        return true;
+    }
+
+    std::vector<ContractionSelectionModel::Uid>
+        ContractionSelectionModel::query(Features const& features) const
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        std::vector<Uid> uids;
+        for(auto const& rule : mRules)
+        {
+            if(rule.matches(features)
+               && std::find(uids.cbegin(), uids.cend(), rule.mUid) == uids.cend())
+            {
+                uids.push_back(rule.mUid);
+            }
+        }
+        return uids;
+    }
+
+    hiptensorStatus_t ContractionSelectionModel::load(std::string const& fileName)
+    {
+        if(fileName.empty())
+        {
+            return HIPTENSOR_STATUS_INVALID_VALUE;
+        }
+
+        std::ifstream file(fileName);
+        if(!file.is_open())
+        {
+            return HIPTENSOR_STATUS_IO_ERROR;
+        }
+
+        auto result = read(file);
+        if(result == HIPTENSOR_STATUS_SUCCESS)
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mFileName = fileName;
+        }
+        return result;
+    }
+
+    hiptensorStatus_t ContractionSelectionModel::read(std::istream& stream)
+    {
+        std::vector<Rule> rules;
+        bool              hasHeader = false;
+
+        std::string line;
+        while(std::getline(stream, line))
+        {
+            // Comments run to the end of the line
+            line = line.substr(0, line.find('#'));
+            if(line.find_first_not_of(" \t\r") == std::string::npos)
+            {
+                continue;
+            }
+
+            if(!hasHeader)
+            {
+                std::istringstream header(line);
+                std::string        tag;
+                uint32_t           version = 0u;
+                if(!(header >> tag >> version) || tag != ModelFileTag || version != Version)
+                {
+                    return HIPTENSOR_STATUS_IO_ERROR;
+                }
+                hasHeader = true;
+                continue;
+            }
+
+            Rule rule;
+            if(!parseRule(line, rule))
+            {
+                return HIPTENSOR_STATUS_IO_ERROR;
+            }
+            rules.push_back(std::move(rule));
+        }
+
+        if(!hasHeader || stream.bad())
+        {
+            return HIPTENSOR_STATUS_IO_ERROR;
+        }
+
+        std::lock_guard<std::mutex> lock(mMutex);
+        mRules = std::move(rules);
+        mFileName.clear();
+
+        return HIPTENSOR_STATUS_SUCCESS;
+    }
+
+    void ContractionSelectionModel::reset()
+    {
+        std::istringstream table(defaultSelectionModel());
+        read(table);
+    }
+
+    std::size_t ContractionSelectionModel::size() const
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return mRules.size();
+    }
+
+    std::string ContractionSelectionModel::fileName() const
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return mFileName;
+    }
+
+} // namespace hiptensor
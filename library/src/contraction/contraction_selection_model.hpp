@@ -0,0 +1,169 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef HIPTENSOR_CONTRACTION_SELECTION_MODEL_HPP
+#define HIPTENSOR_CONTRACTION_SELECTION_MODEL_HPP
+
+#include <istream>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <hiptensor/hiptensor_types.hpp>
+
+#include "singleton.hpp"
+
+namespace hiptensor
+{
+    // Data-driven kernel selection for HIPTENSOR_ALGO_ACTOR_CRITIC.
+    // An ordered table of rules, each mapping a set of problem features to the uid of
+    // the solution that won on benchmarks. The built-in table is compiled in from
+    // contraction_selection_model.txt; retuning replaces the table, not the code.
+    class ContractionSelectionModel : public LazySingleton<ContractionSelectionModel>
+    {
+    public:
+        using Uid = std::size_t;
+
+        // Bump when the file layout changes.
+        // Files with a different version are rejected.
+        static constexpr uint32_t Version = 1u;
+
+        // Inclusive range of an extent
+        using Range = std::pair<std::size_t, std::size_t>;
+
+        // What the rules look at
+        struct Features
+        {
+            int32_t                mContractionOpId;
+            hipDataType            mTypeA;
+            hipDataType            mTypeB;
+            hipDataType            mTypeD;
+            hipDataType            mTypeE;
+            hiptensorComputeType_t mTypeCompute;
+            uint32_t               mDeviceArch;
+
+            // Number of M, N and K modes, and their total extents
+            uint32_t    mRankM;
+            uint32_t    mRankN;
+            uint32_t    mRankK;
+            std::size_t mM;
+            std::size_t mN;
+            std::size_t mK;
+
+            // Whether the fastest-varying mode of A (B) is a K mode, rather than M (N)
+            bool mContiguousKA;
+            bool mContiguousKB;
+
+            // Whether A or B hold a mode of extent 1
+            bool mUnitExtent;
+        };
+
+        // Features left unset match any problem
+        struct Rule
+        {
+            std::optional<int32_t>                mContractionOpId;
+            std::optional<hipDataType>            mTypeA;
+            std::optional<hipDataType>            mTypeB;
+            std::optional<hipDataType>            mTypeD;
+            std::optional<hipDataType>            mTypeE;
+            std::optional<hiptensorComputeType_t> mTypeCompute;
+            std::optional<uint32_t>               mDeviceArch;
+            std::optional<uint32_t>               mRankM;
+            std::optional<uint32_t>               mRankN;
+            std::optional<uint32_t>               mRankK;
+            std::optional<Range>                  mM;
+            std::optional<Range>                  mN;
+            std::optional<Range>                  mK;
+            std::optional<bool>                   mContiguousKA;
+            std::optional<bool>                   mContiguousKB;
+            std::optional<bool>                   mUnitExtent;
+
+            Uid mUid = 0u;
+
+            bool matches(Features const& features) const;
+        };
+
+        // For static initialization
+        friend std::unique_ptr<ContractionSelectionModel>
+            std::make_unique<ContractionSelectionModel>();
+
+        static Features makeFeatures(int32_t                         contractionOpId,
+                                     hipDataType                     typeA,
+                                     hipDataType                     typeB,
+                                     hipDataType                     typeD,
+                                     hipDataType                     typeE,
+                                     hiptensorComputeType_t          typeCompute,
+                                     std::vector<std::size_t> const& a_ms_ks_lengths,
+                                     std::vector<std::size_t> const& a_ms_ks_strides,
+                                     std::vector<int32_t> const&     a_ms_ks_modes,
+                                     std::vector<std::size_t> const& b_ns_ks_lengths,
+                                     std::vector<std::size_t> const& b_ns_ks_strides,
+                                     std::vector<int32_t> const&     b_ns_ks_modes,
+                                     std::vector<int32_t> const&     e_ms_ns_modes,
+                                     uint32_t                        deviceArch);
+
+        // A rule as a line of a model file, and back. Comments are ignored.
+        static std::string toString(Rule const& rule);
+        static bool        fromString(std::string const& line, Rule& rule);
+
+        // Uids of the rules matching the problem, in order of preference
+        std::vector<Uid> query(Features const& features) const;
+
+        // Replaces the rules with those of the given file. The rules are left
+        // as they are if the file cannot be read or is malformed.
+        hiptensorStatus_t load(std::string const& fileName);
+
+        // Replaces the rules with those of the stream, as for load().
+        hiptensorStatus_t read(std::istream& stream);
+
+        // Back to the built-in rules
+        void reset();
+
+        std::size_t size() const;
+
+        // The file the rules were loaded from, empty for the built-in rules
+        std::string fileName() const;
+
+    private:
+        ContractionSelectionModel();
+        ContractionSelectionModel(ContractionSelectionModel const&)            = delete;
+        ContractionSelectionModel(ContractionSelectionModel&&)                 = delete;
+        ContractionSelectionModel& operator=(ContractionSelectionModel const&) = delete;
+        ContractionSelectionModel& operator=(ContractionSelectionModel&&)      = delete;
+
+    private:
+        std::vector<Rule> mRules;
+        std::string       mFileName;
+
+        mutable std::mutex mMutex;
+    };
+
+} // namespace hiptensor
+
+#endif // HIPTENSOR_CONTRACTION_SELECTION_MODEL_HPP
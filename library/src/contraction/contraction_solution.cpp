@@ -24,14 +24,17 @@
  *
  *******************************************************************************/
 
+#include <cassert>
+#include <cstring>
 #include <set>
+#include <type_traits>
 
 #include "contraction_solution.hpp"
 #include "util.hpp"
 
 namespace hiptensor
 {
-    std::array<std::vector<std::size_t>, 8>
+    std::array<NormalExtents, 8>
         normalizeTensorModes(std::vector<std::size_t> const& a_ms_ks_lengths,
                              std::vector<std::size_t> const& a_ms_ks_strides,
                              std::vector<int32_t> const&     a_ms_ks_modes,
@@ -42,17 +45,25 @@ namespace hiptensor
                              std::vector<std::size_t> const& e_ms_ns_strides,
                              std::vector<int32_t> const&     e_ms_ns_modes)
     {
-        std::vector<std::size_t> normal_a_ms_ks_lengths(MaxNumDimsM + MaxNumDimsK, 1);
-        std::vector<std::size_t> normal_a_ms_ks_strides(MaxNumDimsM + MaxNumDimsK, 1);
-        std::vector<int32_t>     normal_a_ms_ks_modes(MaxNumDimsM + MaxNumDimsK, -1);
-        std::vector<std::size_t> normal_b_ns_ks_lengths(MaxNumDimsK + MaxNumDimsN, 1);
-        std::vector<std::size_t> normal_b_ns_ks_strides(MaxNumDimsK + MaxNumDimsN, 1);
-        std::vector<int32_t>     normal_b_ns_ks_modes(MaxNumDimsK + MaxNumDimsN, -1);
-        std::vector<std::size_t> normal_e_ms_ns_lengths(MaxNumDimsM + MaxNumDimsN, 1);
-        std::vector<std::size_t> normal_e_ms_ns_strides(MaxNumDimsM + MaxNumDimsN, 1);
-        std::vector<int32_t>     normal_e_ms_ns_modes(MaxNumDimsM + MaxNumDimsN, -1);
-        int                      mOffset = 0;
-        int                      nOffset = 0;
+        NormalExtents                                  normal_a_ms_ks_lengths;
+        NormalExtents                                  normal_a_ms_ks_strides;
+        std::array<int32_t, MaxNumDimsM + MaxNumDimsK> normal_a_ms_ks_modes;
+        NormalExtents                                  normal_b_ns_ks_lengths;
+        NormalExtents                                  normal_b_ns_ks_strides;
+        std::array<int32_t, MaxNumDimsK + MaxNumDimsN> normal_b_ns_ks_modes;
+        NormalExtents                                  normal_e_ms_ns_lengths;
+        NormalExtents                                  normal_e_ms_ns_strides;
+        int                                            mOffset = 0;
+        int                                            nOffset = 0;
+
+        normal_a_ms_ks_lengths.fill(1);
+        normal_a_ms_ks_strides.fill(1);
+        normal_a_ms_ks_modes.fill(-1);
+        normal_b_ns_ks_lengths.fill(1);
+        normal_b_ns_ks_strides.fill(1);
+        normal_b_ns_ks_modes.fill(-1);
+        normal_e_ms_ns_lengths.fill(1);
+        normal_e_ms_ns_strides.fill(1);
 
         // reorder m, n in A, B
         for(int i = 0; i < e_ms_ns_modes.size(); i++)
@@ -122,7 +133,7 @@ namespace hiptensor
         }
 
         // reorder m, n in D, E
-        std::vector<int32_t> contraction_result_modes(MaxNumDimsM + MaxNumDimsN, -1);
+        std::array<int32_t, MaxNumDimsM + MaxNumDimsN> contraction_result_modes;
         std::copy(normal_a_ms_ks_modes.cbegin(),
                   normal_a_ms_ks_modes.cbegin() + MaxNumDimsM,
                   contraction_result_modes.begin());
@@ -159,29 +170,96 @@ namespace hiptensor
         };
     }
 
-    ContractionSolution::ContractionSolution(
-        std::unique_ptr<ck::tensor_operation::device::BaseOperator>&& deviceOp,
-        std::unique_ptr<ContractionSolutionParams>&&                  params)
+    bool ContractionArgs::LaunchData::operator==(LaunchData const& other) const
+    {
+        return mPointers == other.mPointers && mScalars == other.mScalars;
+    }
+
+    ContractionArgs::ContractionArgs()
         : mM(0)
         , mN(0)
         , mK(0)
         , mBytes(0)
+        , mWorkspaceSize(0)
+        , mScalarSize(0)
         , mValid(false)
-        , mDeviceOp(std::move(deviceOp))
+        , mLaunchData{}
+        , mBatchLaunchData{}
+        , mBatchStrides{}
+        , mFoldedBatchCount(0)
+        , mFoldedStrides{}
+    {
+    }
+
+    std::tuple<ck::index_t, ck::index_t, ck::index_t> ContractionArgs::problemDims() const
+    {
+        return std::make_tuple(mM, mN, mK);
+    }
+
+    ContractionArgs::LaunchData ContractionArgs::launchData(void const* alpha,
+                                                            void const* A,
+                                                            void const* B,
+                                                            void const* beta,
+                                                            void const* D,
+                                                            void*       E,
+                                                            void*       workspacePtr) const
+    {
+        assert(mScalarSize <= LaunchData::MaxScalarSize);
+
+        LaunchData result{{A, B, D, E, workspacePtr}, {}};
+        if(alpha != nullptr)
+        {
+            std::memcpy(result.mScalars.data(), alpha, mScalarSize);
+        }
+        if(beta != nullptr)
+        {
+            std::memcpy(result.mScalars.data() + LaunchData::MaxScalarSize, beta, mScalarSize);
+        }
+        return result;
+    }
+
+    void ContractionArgs::reset()
+    {
+        mM             = 0;
+        mN             = 0;
+        mK             = 0;
+        mBytes         = 0;
+        mWorkspaceSize = 0;
+        mScalarSize    = 0;
+
+        mALengths.clear();
+        mAStrides.clear();
+        mBLengths.clear();
+        mBStrides.clear();
+        mELengths.clear();
+        mEStrides.clear();
+
+        mInvokerArgPtr.reset(nullptr);
+        mInvokerPtr.reset(nullptr);
+        mLaunchData = {};
+
+        mBatchArgPtrs.clear();
+        mBatchLaunchData = {};
+        mBatchStrides    = {};
+
+        mFoldedArgs.reset();
+        mFoldedBatchCount = 0;
+        mFoldedStrides    = {};
+
+        mValid = false;
+    }
+
+    ContractionSolution::ContractionSolution(
+        std::unique_ptr<ck::tensor_operation::device::BaseOperator>&& deviceOp,
+        std::unique_ptr<ContractionSolutionParams>&&                  params)
+        : mDeviceOp(std::move(deviceOp))
         , mParams(std::move(params))
     {
     }
 
     ContractionSolution::ContractionSolution(ContractionSolution&& other)
-        : mM(other.mM)
-        , mN(other.mN)
-        , mK(other.mK)
-        , mBytes(other.mBytes)
-        , mValid(other.mValid)
-        , mDeviceOp(std::move(other.mDeviceOp))
+        : mDeviceOp(std::move(other.mDeviceOp))
         , mParams(std::move(other.mParams))
-        , mInvokerArgPtr(std::move(other.mInvokerArgPtr))
-        , mInvokerPtr(std::move(other.mInvokerPtr))
     {
     }
 
@@ -189,45 +267,184 @@ namespace hiptensor
     {
         if(this != &other)
         {
-            mM = other.mM;
-            mN = other.mN;
-            mK = other.mK;
+            mParams   = std::move(other.mParams);
+            mDeviceOp = std::move(other.mDeviceOp);
+        }
+        return *this;
+    }
 
-            mBytes = other.mBytes;
-            mValid = other.mValid;
+    std::tuple<hiptensorStatus_t, float>
+        ContractionSolution::run(ContractionArgs const& args,
+                                 unsigned long          workspaceSize,
+                                 StreamConfig const&    streamConfig /*= StreamConfig{}*/) const
+    {
+        return run(args, args.mInvokerArgPtr.get(), workspaceSize, streamConfig);
+    }
 
-            mParams        = std::move(other.mParams);
-            mDeviceOp      = std::move(other.mDeviceOp);
-            mInvokerArgPtr = std::move(other.mInvokerArgPtr);
-            mInvokerPtr    = std::move(other.mInvokerPtr);
+    std::tuple<hiptensorStatus_t, float> ContractionSolution::run(
+        ContractionArgs const&                            args,
+        ck::tensor_operation::device::BaseArgument const* argument,
+        unsigned long                                     workspaceSize,
+        StreamConfig const&                               streamConfig /*= StreamConfig{}*/) const
+    {
+        if(!args.mValid || argument == nullptr)
+        {
+            return {HIPTENSOR_STATUS_INTERNAL_ERROR, -1.0f};
         }
-        return *this;
+
+        if(args.mWorkspaceSize > workspaceSize)
+        {
+            return {HIPTENSOR_STATUS_INSUFFICIENT_WORKSPACE, -1.0f};
+        }
+
+        auto time = args.mInvokerPtr->Run(argument, streamConfig);
+
+        return {HIPTENSOR_STATUS_SUCCESS, time};
+    }
+
+    std::tuple<hiptensorStatus_t, float>
+        ContractionSolution::operator()(ContractionArgs const& args,
+                                        void const*            alpha,
+                                        void const*            A,
+                                        void const*            B,
+                                        void const*            beta,
+                                        void const*            D,
+                                        void*                  E,
+                                        void*                  workspacePtr,
+                                        unsigned long          workspaceSize,
+                                        StreamConfig const& streamConfig /*= StreamConfig{}*/) const
+    {
+        if(!args.mValid)
+        {
+            return {HIPTENSOR_STATUS_INTERNAL_ERROR, -1.0f};
+        }
+
+        auto data = args.launchData(alpha, A, B, beta, D, E, workspacePtr);
+
+        // Concurrent launches of the same args fall back to a call-local argument
+        std::unique_lock<std::mutex> lock(args.mLaunchMutex, std::try_to_lock);
+        if(lock.owns_lock())
+        {
+            if(args.mInvokerArgPtr == nullptr || !(args.mLaunchData == data))
+            {
+                args.mInvokerArgPtr = makeArgument(args, alpha, A, B, beta, D, E, workspacePtr);
+                args.mLaunchData    = data;
+            }
+            return run(args, args.mInvokerArgPtr.get(), workspaceSize, streamConfig);
+        }
+
+        auto argument = makeArgument(args, alpha, A, B, beta, D, E, workspacePtr);
+        return run(args, argument.get(), workspaceSize, streamConfig);
+    }
+
+    // Advances a data pointer by a byte offset, nullptr stays nullptr
+    template <typename T>
+    static inline T* offsetBytes(T* ptr, int64_t bytes)
+    {
+        using Byte = std::conditional_t<std::is_const_v<T>, char const, char>;
+        return ptr == nullptr ? ptr : static_cast<T*>(static_cast<Byte*>(ptr) + bytes);
+    }
+
+    std::tuple<hiptensorStatus_t, float> ContractionSolution::runStridedBatched(
+        ContractionArgs const&        args,
+        uint32_t                      batchCount,
+        std::array<int64_t, 4> const& batchStrides,
+        void const*                   alpha,
+        void const*                   A,
+        void const*                   B,
+        void const*                   beta,
+        void const*                   D,
+        void*                         E,
+        void*                         workspacePtr,
+        unsigned long                 workspaceSize,
+        StreamConfig const&           streamConfig /*= StreamConfig{}*/) const
+    {
+        if(!args.mValid)
+        {
+            return {HIPTENSOR_STATUS_INTERNAL_ERROR, -1.0f};
+        }
+
+        using ArgumentPtrs
+            = std::vector<std::unique_ptr<ck::tensor_operation::device::BaseArgument>>;
+
+        // Shapes and scalars are shared, only the data pointers advance per item
+        auto makeItems = [&](ArgumentPtrs& argPtrs) {
+            argPtrs.clear();
+            argPtrs.reserve(batchCount);
+            for(uint32_t item = 0; item < batchCount; item++)
+            {
+                argPtrs.push_back(makeArgument(args,
+                                               alpha,
+                                               offsetBytes(A, batchStrides[0] * item),
+                                               offsetBytes(B, batchStrides[1] * item),
+                                               beta,
+                                               offsetBytes(D, batchStrides[2] * item),
+                                               offsetBytes(E, batchStrides[3] * item),
+                                               workspacePtr));
+            }
+        };
+
+        auto runItems = [&](ArgumentPtrs const& argPtrs) -> std::tuple<hiptensorStatus_t, float> {
+            auto totalTime = 0.0f;
+            for(auto const& argument : argPtrs)
+            {
+                auto [errorCode, time] = run(args, argument.get(), workspaceSize, streamConfig);
+                if(errorCode != HIPTENSOR_STATUS_SUCCESS)
+                {
+                    return {errorCode, -1.0f};
+                }
+                totalTime += time;
+            }
+            return {HIPTENSOR_STATUS_SUCCESS, totalTime};
+        };
+
+        auto data = args.launchData(alpha, A, B, beta, D, E, workspacePtr);
+
+        // Concurrent launches of the same args fall back to call-local arguments
+        std::unique_lock<std::mutex> lock(args.mLaunchMutex, std::try_to_lock);
+        if(lock.owns_lock())
+        {
+            if(args.mBatchArgPtrs.size() != batchCount || args.mBatchStrides != batchStrides
+               || !(args.mBatchLaunchData == data))
+            {
+                makeItems(args.mBatchArgPtrs);
+                args.mBatchLaunchData = data;
+                args.mBatchStrides    = batchStrides;
+            }
+            return runItems(args.mBatchArgPtrs);
+        }
+
+        ArgumentPtrs argPtrs;
+        makeItems(argPtrs);
+        return runItems(argPtrs);
     }
 
     std::tuple<hiptensorStatus_t, float>
-        ContractionSolution::operator()(void const*              alpha,
-                                        void const*              A,
-                                        void const*              B,
-                                        void const*              beta,
-                                        void const*              D,
-                                        void*                    E,
-                                        std::vector<std::size_t> a_ms_ns_lengths,
-                                        std::vector<std::size_t> a_ms_ks_strides,
-                                        std::vector<int32_t>     a_ms_ks_modes,
-                                        std::vector<std::size_t> b_ns_ks_lengths,
-                                        std::vector<std::size_t> b_ns_ks_strides,
-                                        std::vector<int32_t>     b_ns_ks_modes,
-                                        std::vector<std::size_t> ds_ms_ns_lengths,
-                                        std::vector<std::size_t> ds_ms_ns_strides,
-                                        std::vector<int32_t>     ds_ms_ns_modes,
-                                        std::vector<std::size_t> e_ms_ns_lengths,
-                                        std::vector<std::size_t> e_ms_ns_strides,
-                                        std::vector<int32_t>     e_ms_ns_modes,
-                                        void*                    workspacePtr,
-                                        unsigned long            workspaceSize,
-                                        StreamConfig const&      streamConfig /*= StreamConfig{}*/)
+        ContractionSolution::operator()(ContractionArgs&                args,
+                                        void const*                     alpha,
+                                        void const*                     A,
+                                        void const*                     B,
+                                        void const*                     beta,
+                                        void const*                     D,
+                                        void*                           E,
+                                        std::vector<std::size_t> const& a_ms_ns_lengths,
+                                        std::vector<std::size_t> const& a_ms_ks_strides,
+                                        std::vector<int32_t> const&     a_ms_ks_modes,
+                                        std::vector<std::size_t> const& b_ns_ks_lengths,
+                                        std::vector<std::size_t> const& b_ns_ks_strides,
+                                        std::vector<int32_t> const&     b_ns_ks_modes,
+                                        std::vector<std::size_t> const& ds_ms_ns_lengths,
+                                        std::vector<std::size_t> const& ds_ms_ns_strides,
+                                        std::vector<int32_t> const&     ds_ms_ns_modes,
+                                        std::vector<std::size_t> const& e_ms_ns_lengths,
+                                        std::vector<std::size_t> const& e_ms_ns_strides,
+                                        std::vector<int32_t> const&     e_ms_ns_modes,
+                                        void*                           workspacePtr,
+                                        unsigned long                   workspaceSize,
+                                        StreamConfig const& streamConfig /*= StreamConfig{}*/) const
     {
-        if(!initArgs(alpha,
+        if(!initArgs(args,
+                     alpha,
                      A,
                      B,
                      beta,
@@ -250,20 +467,55 @@ namespace hiptensor
             return {HIPTENSOR_STATUS_INTERNAL_ERROR, -1.0f};
         }
 
-        if(this->workspaceSize() > workspaceSize)
-        {
-            resetInvokerArgs();
-            return {HIPTENSOR_STATUS_INSUFFICIENT_WORKSPACE, -1.0f};
-        }
-        auto time = mInvokerPtr->Run(mInvokerArgPtr.get(), streamConfig);
-        resetInvokerArgs();
-
-        return {HIPTENSOR_STATUS_SUCCESS, time};
+        return run(args, workspaceSize, streamConfig);
     }
 
-    bool ContractionSolution::isValid() const
+    std::tuple<hiptensorStatus_t, float>
+        ContractionSolution::operator()(void const*                     alpha,
+                                        void const*                     A,
+                                        void const*                     B,
+                                        void const*                     beta,
+                                        void const*                     D,
+                                        void*                           E,
+                                        std::vector<std::size_t> const& a_ms_ns_lengths,
+                                        std::vector<std::size_t> const& a_ms_ks_strides,
+                                        std::vector<int32_t> const&     a_ms_ks_modes,
+                                        std::vector<std::size_t> const& b_ns_ks_lengths,
+                                        std::vector<std::size_t> const& b_ns_ks_strides,
+                                        std::vector<int32_t> const&     b_ns_ks_modes,
+                                        std::vector<std::size_t> const& ds_ms_ns_lengths,
+                                        std::vector<std::size_t> const& ds_ms_ns_strides,
+                                        std::vector<int32_t> const&     ds_ms_ns_modes,
+                                        std::vector<std::size_t> const& e_ms_ns_lengths,
+                                        std::vector<std::size_t> const& e_ms_ns_strides,
+                                        std::vector<int32_t> const&     e_ms_ns_modes,
+                                        void*                           workspacePtr,
+                                        unsigned long                   workspaceSize,
+                                        StreamConfig const& streamConfig /*= StreamConfig{}*/) const
     {
-        return mValid;
+        ContractionArgs args;
+        return (*this)(args,
+                       alpha,
+                       A,
+                       B,
+                       beta,
+                       D,
+                       E,
+                       a_ms_ns_lengths,
+                       a_ms_ks_strides,
+                       a_ms_ks_modes,
+                       b_ns_ks_lengths,
+                       b_ns_ks_strides,
+                       b_ns_ks_modes,
+                       ds_ms_ns_lengths,
+                       ds_ms_ns_strides,
+                       ds_ms_ns_modes,
+                       e_ms_ns_lengths,
+                       e_ms_ns_strides,
+                       e_ms_ns_modes,
+                       workspacePtr,
+                       workspaceSize,
+                       streamConfig);
     }
 
     std::unique_ptr<ContractionSolutionParams> const& ContractionSolution::params() const
@@ -280,48 +532,8 @@ namespace hiptensor
         return value;
     }
 
-    std::tuple<ck::index_t, ck::index_t, ck::index_t> ContractionSolution::problemDims() const
-    {
-        return std::make_tuple(mM, mN, mK);
-    }
-
-    ck::index_t ContractionSolution::problemBytes() const
-    {
-        return mBytes;
-    }
-
     std::string ContractionSolution::kernelName() const
     {
         return mDeviceOp->GetTypeString();
     }
-
-    size_t ContractionSolution::workspaceSize() const
-    {
-        if(mValid)
-        {
-            return mDeviceOp->GetWorkSpaceSize(mInvokerArgPtr.get());
-        }
-        else
-        {
-            return 0;
-        }
-    }
-
-    void ContractionSolution::resetArgs()
-    {
-        mM     = 0;
-        mN     = 0;
-        mK     = 0;
-        mBytes = 0;
-
-        mInvokerArgPtr.reset(nullptr);
-        mInvokerPtr.reset(nullptr);
-
-        mValid = false;
-    }
-
-    void ContractionSolution::resetInvokerArgs()
-    {
-        mInvokerArgPtr.reset(nullptr);
-    }
 } // namespace hiptensor
@@ -27,8 +27,10 @@
 #ifndef HIPTENSOR_CONTRACTION_SOLUTION_HPP
 #define HIPTENSOR_CONTRACTION_SOLUTION_HPP
 
+#include <array>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <tuple>
 #include <vector>
 
@@ -46,6 +48,81 @@
 
 namespace hiptensor
 {
+    // Kernel arguments and invoker for one contraction problem.
+    // These are owned by the caller rather than the solution, so that a single
+    // solution can be executed concurrently from multiple threads.
+    struct ContractionArgs
+    {
+        // Data pointers {A, B, D, E, workspace} and scalar bytes {alpha, beta}
+        // that a kernel argument was made for.
+        struct LaunchData
+        {
+            static constexpr uint32_t MaxScalarSize = 2u * sizeof(double);
+
+            std::array<void const*, 5>                   mPointers;
+            std::array<unsigned char, 2 * MaxScalarSize> mScalars;
+
+            bool operator==(LaunchData const& other) const;
+        };
+
+        ContractionArgs();
+        ~ContractionArgs()                                 = default;
+        ContractionArgs(ContractionArgs const&)            = delete;
+        ContractionArgs& operator=(ContractionArgs const&) = delete;
+
+        // Problem dimensions
+        std::tuple<ck::index_t, ck::index_t, ck::index_t> problemDims() const;
+
+        LaunchData launchData(void const* alpha,
+                              void const* A,
+                              void const* B,
+                              void const* beta,
+                              void const* D,
+                              void*       E,
+                              void*       workspacePtr) const;
+
+        void reset();
+
+        // Derived runtime arguments
+        ck::index_t mM, mN, mK;
+        ck::index_t mBytes;
+        size_t      mWorkspaceSize;
+        uint32_t    mScalarSize;
+
+        // Arguments were accepted by the kernel
+        bool mValid;
+
+        // Normalized problem in CK index format, kept so that the kernel
+        // argument can be re-made for new data pointers and scalars.
+        std::vector<ck::index_t> mALengths, mAStrides;
+        std::vector<ck::index_t> mBLengths, mBStrides;
+        std::vector<ck::index_t> mELengths, mEStrides;
+
+        // Kernel argument of the last launch and the data it was made for.
+        // It is re-launched as is while that data doesn't change, so steady-state
+        // execution does not touch the heap. Guarded by mLaunchMutex.
+        mutable std::unique_ptr<ck::tensor_operation::device::BaseArgument> mInvokerArgPtr;
+        mutable LaunchData                                                  mLaunchData;
+        mutable std::mutex                                                  mLaunchMutex;
+
+        // Kernel arguments of the last strided-batched launch, one per batch item,
+        // and the data and byte strides they were made for. Re-launched as is while
+        // those don't change. Guarded by mLaunchMutex.
+        mutable std::vector<std::unique_ptr<ck::tensor_operation::device::BaseArgument>>
+                                       mBatchArgPtrs;
+        mutable LaunchData             mBatchLaunchData;
+        mutable std::array<int64_t, 4> mBatchStrides;
+
+        // Args of the last batch folded into a single problem, nullptr if it could not
+        // be folded, and the batch count and element strides they were made for.
+        // Guarded by mLaunchMutex.
+        mutable std::shared_ptr<ContractionArgs> mFoldedArgs;
+        mutable uint32_t                         mFoldedBatchCount;
+        mutable std::array<int64_t, 4>           mFoldedStrides;
+
+        std::unique_ptr<ck::tensor_operation::device::BaseInvoker> mInvokerPtr;
+    };
+
     class ContractionSolution
     {
     public:
@@ -64,55 +141,140 @@ namespace hiptensor
         ContractionSolution(ContractionSolution&& other);
         ContractionSolution& operator=(ContractionSolution&& other);
 
-        // Must specialize incoming arg handling
-        virtual bool initArgs(void const*              alpha,
-                              void const*              A,
-                              void const*              B,
-                              void const*              beta,
-                              void const*              D,
-                              void*                    E,
-                              std::vector<std::size_t> a_ms_ns_lengths,
-                              std::vector<std::size_t> a_ms_ks_strides,
-                              std::vector<int32_t>     a_ms_ks_modes,
-                              std::vector<std::size_t> b_ns_ks_lengths,
-                              std::vector<std::size_t> b_ns_ks_strides,
-                              std::vector<int32_t>     b_ns_ks_modes,
-                              std::vector<std::size_t> ds_ms_ns_lengths,
-                              std::vector<std::size_t> ds_ms_ns_strides,
-                              std::vector<int32_t>     ds_ms_ns_modes,
-                              std::vector<std::size_t> e_ms_ns_lengths,
-                              std::vector<std::size_t> e_ms_ns_strides,
-                              std::vector<int32_t>     e_ms_ns_modes,
-                              void*                    workspacePtr)
+        // Must specialize incoming arg handling.
+        // Results are written to args only: the solution itself is not modified.
+        virtual bool initArgs(ContractionArgs&                args,
+                              void const*                     alpha,
+                              void const*                     A,
+                              void const*                     B,
+                              void const*                     beta,
+                              void const*                     D,
+                              void*                           E,
+                              std::vector<std::size_t> const& a_ms_ns_lengths,
+                              std::vector<std::size_t> const& a_ms_ks_strides,
+                              std::vector<int32_t> const&     a_ms_ks_modes,
+                              std::vector<std::size_t> const& b_ns_ks_lengths,
+                              std::vector<std::size_t> const& b_ns_ks_strides,
+                              std::vector<int32_t> const&     b_ns_ks_modes,
+                              std::vector<std::size_t> const& ds_ms_ns_lengths,
+                              std::vector<std::size_t> const& ds_ms_ns_strides,
+                              std::vector<int32_t> const&     ds_ms_ns_modes,
+                              std::vector<std::size_t> const& e_ms_ns_lengths,
+                              std::vector<std::size_t> const& e_ms_ns_strides,
+                              std::vector<int32_t> const&     e_ms_ns_modes,
+                              void*                           workspacePtr) const
             = 0;
 
-        std::tuple<hiptensorStatus_t, float> operator()(void const*              alpha,
-                                                        void const*              A,
-                                                        void const*              B,
-                                                        void const*              beta,
-                                                        void const*              D,
-                                                        void*                    E,
-                                                        std::vector<std::size_t> a_ms_ns_lengths,
-                                                        std::vector<std::size_t> a_ms_ks_strides,
-                                                        std::vector<int32_t>     a_ms_ks_modes,
-                                                        std::vector<std::size_t> b_ns_ks_lengths,
-                                                        std::vector<std::size_t> b_ns_ks_strides,
-                                                        std::vector<int32_t>     b_ns_ks_modes,
-                                                        std::vector<std::size_t> ds_ms_ns_lengths,
-                                                        std::vector<std::size_t> ds_ms_ns_strides,
-                                                        std::vector<int32_t>     ds_ms_ns_modes,
-                                                        std::vector<std::size_t> e_ms_ns_lengths,
-                                                        std::vector<std::size_t> e_ms_ns_strides,
-                                                        std::vector<int32_t>     e_ms_ns_modes,
-                                                        void*                    workspacePtr,
-                                                        unsigned long            workspaceSize,
-                                                        StreamConfig const&      streamConfig
-                                                        = StreamConfig{});
+        // Makes a kernel argument for previously initialized args with new data
+        // pointers and scalars. Shapes, invoker and workspace size are re-used.
+        virtual std::unique_ptr<ck::tensor_operation::device::BaseArgument>
+            makeArgument(ContractionArgs const& args,
+                         void const*            alpha,
+                         void const*            A,
+                         void const*            B,
+                         void const*            beta,
+                         void const*            D,
+                         void*                  E,
+                         void*                  workspacePtr) const
+            = 0;
 
-        /// Accessors
+        // Launch with previously initialized arguments
+        std::tuple<hiptensorStatus_t, float> run(ContractionArgs const& args,
+                                                 unsigned long          workspaceSize,
+                                                 StreamConfig const&    streamConfig
+                                                 = StreamConfig{}) const;
+
+        // Launch previously initialized arguments with the given kernel argument
+        std::tuple<hiptensorStatus_t, float>
+            run(ContractionArgs const&                            args,
+                ck::tensor_operation::device::BaseArgument const* argument,
+                unsigned long                                     workspaceSize,
+                StreamConfig const&                               streamConfig
+                = StreamConfig{}) const;
+
+        // Patch data pointers and scalars into previously initialized args and launch.
+        // The kernel argument is only re-made if they differ from the previous launch.
+        std::tuple<hiptensorStatus_t, float> operator()(ContractionArgs const& args,
+                                                        void const*            alpha,
+                                                        void const*            A,
+                                                        void const*            B,
+                                                        void const*            beta,
+                                                        void const*            D,
+                                                        void*                  E,
+                                                        void*                  workspacePtr,
+                                                        unsigned long          workspaceSize,
+                                                        StreamConfig const&    streamConfig
+                                                        = StreamConfig{}) const;
 
-        // Problem can be solved with this kernel
-        bool isValid() const;
+        // Launch previously initialized args over batchCount problems whose data
+        // pointers {A, B, D, E} advance by batchStrides bytes per item.
+        // Items run in stream order and share the workspace, one launch each. Their
+        // kernel arguments are only re-made if the data or strides differ from the
+        // previous batch.
+        std::tuple<hiptensorStatus_t, float>
+            runStridedBatched(ContractionArgs const&        args,
+                              uint32_t                      batchCount,
+                              std::array<int64_t, 4> const& batchStrides,
+                              void const*                   alpha,
+                              void const*                   A,
+                              void const*                   B,
+                              void const*                   beta,
+                              void const*                   D,
+                              void*                         E,
+                              void*                         workspacePtr,
+                              unsigned long                 workspaceSize,
+                              StreamConfig const&           streamConfig = StreamConfig{}) const;
+
+        // Initialize args and launch
+        std::tuple<hiptensorStatus_t, float>
+            operator()(ContractionArgs&                args,
+                       void const*                     alpha,
+                       void const*                     A,
+                       void const*                     B,
+                       void const*                     beta,
+                       void const*                     D,
+                       void*                           E,
+                       std::vector<std::size_t> const& a_ms_ns_lengths,
+                       std::vector<std::size_t> const& a_ms_ks_strides,
+                       std::vector<int32_t> const&     a_ms_ks_modes,
+                       std::vector<std::size_t> const& b_ns_ks_lengths,
+                       std::vector<std::size_t> const& b_ns_ks_strides,
+                       std::vector<int32_t> const&     b_ns_ks_modes,
+                       std::vector<std::size_t> const& ds_ms_ns_lengths,
+                       std::vector<std::size_t> const& ds_ms_ns_strides,
+                       std::vector<int32_t> const&     ds_ms_ns_modes,
+                       std::vector<std::size_t> const& e_ms_ns_lengths,
+                       std::vector<std::size_t> const& e_ms_ns_strides,
+                       std::vector<int32_t> const&     e_ms_ns_modes,
+                       void*                           workspacePtr,
+                       unsigned long                   workspaceSize,
+                       StreamConfig const&             streamConfig = StreamConfig{}) const;
+
+        // Same as above, with call-local arguments
+        std::tuple<hiptensorStatus_t, float>
+            operator()(void const*                     alpha,
+                       void const*                     A,
+                       void const*                     B,
+                       void const*                     beta,
+                       void const*                     D,
+                       void*                           E,
+                       std::vector<std::size_t> const& a_ms_ns_lengths,
+                       std::vector<std::size_t> const& a_ms_ks_strides,
+                       std::vector<int32_t> const&     a_ms_ks_modes,
+                       std::vector<std::size_t> const& b_ns_ks_lengths,
+                       std::vector<std::size_t> const& b_ns_ks_strides,
+                       std::vector<int32_t> const&     b_ns_ks_modes,
+                       std::vector<std::size_t> const& ds_ms_ns_lengths,
+                       std::vector<std::size_t> const& ds_ms_ns_strides,
+                       std::vector<int32_t> const&     ds_ms_ns_modes,
+                       std::vector<std::size_t> const& e_ms_ns_lengths,
+                       std::vector<std::size_t> const& e_ms_ns_strides,
+                       std::vector<int32_t> const&     e_ms_ns_modes,
+                       void*                           workspacePtr,
+                       unsigned long                   workspaceSize,
+                       StreamConfig const&             streamConfig = StreamConfig{}) const;
+
+        /// Accessors
 
         // Run-time solution parameters
         std::unique_ptr<ContractionSolutionParams> const& params() const;
@@ -120,34 +282,13 @@ namespace hiptensor
         // Unique ID for the kernel
         size_t uid() const;
 
-        // Problem dimensions
-        std::tuple<ck::index_t, ck::index_t, ck::index_t> problemDims() const;
-
-        // Byte count
-        ck::index_t problemBytes() const;
-
         // Kernel's name encoding
         std::string kernelName() const;
 
-        // Kernel's required workspace size
-        size_t workspaceSize() const;
-
-        // Reset all arguments
-        void resetArgs();
-
     protected:
-        void resetInvokerArgs();
-
-        // Derived runtime arguments
-        ck::index_t mM, mN, mK;
-        ck::index_t mBytes;
-        bool        mValid;
-
         // Kernel Params
         std::unique_ptr<ContractionSolutionParams>                  mParams;
         std::unique_ptr<ck::tensor_operation::device::BaseOperator> mDeviceOp;
-        std::unique_ptr<ck::tensor_operation::device::BaseArgument> mInvokerArgPtr;
-        std::unique_ptr<ck::tensor_operation::device::BaseInvoker>  mInvokerPtr;
     };
 
     template <ck::index_t NumDimM,
@@ -47,7 +47,12 @@ namespace std
 
 namespace hiptensor
 {
-    std::array<std::vector<std::size_t>, 8>
+    // Normalized tensors always have MaxNumDims{M,N,K} modes per group,
+    // so their extents have a fixed rank and are kept off the heap.
+    static_assert(MaxNumDimsM == MaxNumDimsN && MaxNumDimsN == MaxNumDimsK);
+    using NormalExtents = std::array<std::size_t, MaxNumDimsM + MaxNumDimsK>;
+
+    std::array<NormalExtents, 8>
         normalizeTensorModes(std::vector<std::size_t> const& a_ms_ks_lengths,
                              std::vector<std::size_t> const& a_ms_ks_strides,
                              std::vector<int32_t> const&     a_ms_ks_modes,
@@ -77,57 +82,43 @@ namespace hiptensor
         {
         }
 
-        bool initArgs(void const*              alpha,
-                      void const*              A,
-                      void const*              B,
-                      void const*              beta,
-                      void const*              D,
-                      void*                    E,
-                      std::vector<std::size_t> a_ms_ks_lengths,
-                      std::vector<std::size_t> a_ms_ks_strides,
-                      std::vector<int32_t>     a_ms_ks_modes,
-                      std::vector<std::size_t> b_ns_ks_lengths,
-                      std::vector<std::size_t> b_ns_ks_strides,
-                      std::vector<int32_t>     b_ns_ks_modes,
-                      std::vector<std::size_t> ds_ms_ns_lengths,
-                      std::vector<std::size_t> ds_ms_ns_strides,
-                      std::vector<int32_t>     ds_ms_ns_modes,
-                      std::vector<std::size_t> e_ms_ns_lengths,
-                      std::vector<std::size_t> e_ms_ns_strides,
-                      std::vector<int32_t>     e_ms_ns_modes,
-                      void*                    workspacePtr) override
+        bool initArgs(ContractionArgs&                args,
+                      void const*                     alpha,
+                      void const*                     A,
+                      void const*                     B,
+                      void const*                     beta,
+                      void const*                     D,
+                      void*                           E,
+                      std::vector<std::size_t> const& a_ms_ks_lengths,
+                      std::vector<std::size_t> const& a_ms_ks_strides,
+                      std::vector<int32_t> const&     a_ms_ks_modes,
+                      std::vector<std::size_t> const& b_ns_ks_lengths,
+                      std::vector<std::size_t> const& b_ns_ks_strides,
+                      std::vector<int32_t> const&     b_ns_ks_modes,
+                      std::vector<std::size_t> const& ds_ms_ns_lengths,
+                      std::vector<std::size_t> const& ds_ms_ns_strides,
+                      std::vector<int32_t> const&     ds_ms_ns_modes,
+                      std::vector<std::size_t> const& e_ms_ns_lengths,
+                      std::vector<std::size_t> const& e_ms_ns_strides,
+                      std::vector<int32_t> const&     e_ms_ns_modes,
+                      void*                           workspacePtr) const override
         {
             using Base   = ContractionSolution;
             using Traits = MetaTraits<DeviceOp>;
 
             // Clear out the previous arguments
-            resetArgs();
+            args.reset();
 
             // Promote to derived class for necessary functions such as
             // MakeArgumentPointer and MakeInvokerPointer.
             auto* deviceOp = dynamic_cast<DeviceOp*>(Base::mDeviceOp.get());
 
-            // Note: CK ALWAYS uses float for alpha / beta in contraction multipleD
-            ScalarData alphaF;
-            ScalarData betaF;
-
-            if(alpha != nullptr)
-            {
-                alphaF = hiptensor::readVal<ScalarData>(
-                    alpha, convertToComputeType(HipDataType_v<typename Traits::ComputeDataT>));
-            }
-            if(beta != nullptr)
-            {
-                betaF = hiptensor::readVal<ScalarData>(
-                    beta, convertToComputeType(HipDataType_v<typename Traits::ComputeDataT>));
-            }
-
             auto [normal_a_ms_ks_lengths,
                   normal_a_ms_ks_strides,
                   normal_b_ns_ks_lengths,
                   normal_b_ns_ks_strides,
-                  normal_ds_ms_ns_lengths,
-                  normal_ds_ms_ns_strides,
+                  _1,
+                  _2,
                   normal_e_ms_ns_lengths,
                   normal_e_ms_ns_strides]
                 = normalizeTensorModes(a_ms_ks_lengths,
@@ -141,65 +132,114 @@ namespace hiptensor
                                        e_ms_ns_modes);
 
             // CK has its own format for indices...
-            auto toCKVec = [](std::vector<size_t> const& v) {
+            auto toCKVec = [](NormalExtents const& v) {
                 return std::vector<ck::index_t>(v.begin(), v.end());
             };
 
-            // Initialize the argument pointer
-            Base::mInvokerArgPtr = std::move(deviceOp->MakeArgumentPointer(
-                A,
-                B,
-                std::array<const void*, 1>{D},
-                E,
-                toCKVec(normal_a_ms_ks_lengths),
-                toCKVec(normal_a_ms_ks_strides),
-                toCKVec(normal_b_ns_ks_lengths),
-                toCKVec(normal_b_ns_ks_strides),
-                std::array<std::vector<ck::index_t>, 1>{toCKVec(normal_ds_ms_ns_lengths)},
-                std::array<std::vector<ck::index_t>, 1>{toCKVec(normal_ds_ms_ns_strides)},
-                toCKVec(normal_e_ms_ns_lengths),
-                toCKVec(normal_e_ms_ns_strides),
-                typename Traits::AOp{},
-                typename Traits::BOp{},
-                typename Traits::CDEOp(alphaF, betaF)));
+            args.mALengths = toCKVec(normal_a_ms_ks_lengths);
+            args.mAStrides = toCKVec(normal_a_ms_ks_strides);
+            args.mBLengths = toCKVec(normal_b_ns_ks_lengths);
+            args.mBStrides = toCKVec(normal_b_ns_ks_strides);
+            args.mELengths = toCKVec(normal_e_ms_ns_lengths);
+            args.mEStrides = toCKVec(normal_e_ms_ns_strides);
 
-            // Attach the workspace pointer
-            deviceOp->SetWorkSpacePointer(Base::mInvokerArgPtr.get(), workspacePtr);
+            // Initialize the argument pointer
+            args.mScalarSize    = sizeof(typename Traits::ComputeDataT);
+            args.mInvokerArgPtr = makeArgument(args, alpha, A, B, beta, D, E, workspacePtr);
+            args.mLaunchData    = args.launchData(alpha, A, B, beta, D, E, workspacePtr);
 
             // Initialize the invoker
-            Base::mInvokerPtr = std::move(deviceOp->MakeInvokerPointer());
+            args.mInvokerPtr = std::move(deviceOp->MakeInvokerPointer());
 
             // Fill problem metrics
-            Base::mM = std::accumulate(normal_a_ms_ks_lengths.begin(),
-                                       normal_a_ms_ks_lengths.begin() + MaxNumDimsM,
-                                       ck::index_t{1},
-                                       std::multiplies<ck::index_t>{});
+            args.mM = std::accumulate(normal_a_ms_ks_lengths.begin(),
+                                      normal_a_ms_ks_lengths.begin() + MaxNumDimsM,
+                                      ck::index_t{1},
+                                      std::multiplies<ck::index_t>{});
 
-            Base::mN = std::accumulate(normal_b_ns_ks_lengths.begin(),
-                                       normal_b_ns_ks_lengths.begin() + MaxNumDimsN,
-                                       ck::index_t{1},
-                                       std::multiplies<ck::index_t>{});
+            args.mN = std::accumulate(normal_b_ns_ks_lengths.begin(),
+                                      normal_b_ns_ks_lengths.begin() + MaxNumDimsN,
+                                      ck::index_t{1},
+                                      std::multiplies<ck::index_t>{});
 
-            Base::mK = std::accumulate(normal_a_ms_ks_lengths.begin() + MaxNumDimsM,
-                                       normal_a_ms_ks_lengths.end(),
-                                       ck::index_t{1},
-                                       std::multiplies<ck::index_t>{});
+            args.mK = std::accumulate(normal_a_ms_ks_lengths.begin() + MaxNumDimsM,
+                                      normal_a_ms_ks_lengths.end(),
+                                      ck::index_t{1},
+                                      std::multiplies<ck::index_t>{});
 
             // Byte count
-            Base::mBytes = sizeof(typename Traits::ADataT) * Base::mM * Base::mK
-                           + sizeof(typename Traits::BDataT) * Base::mK * Base::mN
-                           + sizeof(typename Traits::DDataT) * Base::mM * Base::mN
-                           + sizeof(typename Traits::EDataT) * Base::mM * Base::mN;
+            args.mBytes = sizeof(typename Traits::ADataT) * args.mM * args.mK
+                          + sizeof(typename Traits::BDataT) * args.mK * args.mN
+                          + sizeof(typename Traits::DDataT) * args.mM * args.mN
+                          + sizeof(typename Traits::EDataT) * args.mM * args.mN;
 
             // Arg test
-            Base::mValid = deviceOp->IsSupportedArgument(Base::mInvokerArgPtr.get());
+            args.mValid = deviceOp->IsSupportedArgument(args.mInvokerArgPtr.get());
 
-            if(!Base::mValid)
+            if(args.mValid)
             {
-                resetArgs();
+                args.mWorkspaceSize = deviceOp->GetWorkSpaceSize(args.mInvokerArgPtr.get());
+            }
+            else
+            {
+                args.reset();
             }
 
-            return Base::mValid;
+            return args.mValid;
+        }
+
+        std::unique_ptr<ck::tensor_operation::device::BaseArgument>
+            makeArgument(ContractionArgs const& args,
+                         void const*            alpha,
+                         void const*            A,
+                         void const*            B,
+                         void const*            beta,
+                         void const*            D,
+                         void*                  E,
+                         void*                  workspacePtr) const override
+        {
+            using Base   = ContractionSolution;
+            using Traits = MetaTraits<DeviceOp>;
+
+            auto* deviceOp = dynamic_cast<DeviceOp*>(Base::mDeviceOp.get());
+
+            // Note: CK ALWAYS uses float for alpha / beta in contraction multipleD
+            ScalarData alphaF;
+            ScalarData betaF;
+
+            if(alpha != nullptr)
+            {
+                alphaF = hiptensor::readVal<ScalarData>(
+                    alpha, convertToComputeType(HipDataType_v<typename Traits::ComputeDataT>));
+            }
+            if(beta != nullptr)
+            {
+                betaF = hiptensor::readVal<ScalarData>(
+                    beta, convertToComputeType(HipDataType_v<typename Traits::ComputeDataT>));
+            }
+
+            // D shares the normalized layout of E
+            auto argument = deviceOp->MakeArgumentPointer(
+                A,
+                B,
+                std::array<const void*, 1>{D},
+                E,
+                args.mALengths,
+                args.mAStrides,
+                args.mBLengths,
+                args.mBStrides,
+                std::array<std::vector<ck::index_t>, 1>{args.mELengths},
+                std::array<std::vector<ck::index_t>, 1>{args.mEStrides},
+                args.mELengths,
+                args.mEStrides,
+                typename Traits::AOp{},
+                typename Traits::BOp{},
+                typename Traits::CDEOp(alphaF, betaF));
+
+            // Attach the workspace pointer
+            deviceOp->SetWorkSpacePointer(argument.get(), workspacePtr);
+
+            return argument;
         }
     };
 
@@ -219,45 +259,37 @@ namespace hiptensor
         {
         }
 
-        bool initArgs(void const*              alpha,
-                      void const*              A,
-                      void const*              B,
-                      void const*              beta,
-                      void const*              D,
-                      void*                    E,
-                      std::vector<std::size_t> a_ms_ks_lengths,
-                      std::vector<std::size_t> a_ms_ks_strides,
-                      std::vector<int32_t>     a_ms_ks_modes,
-                      std::vector<std::size_t> b_ns_ks_lengths,
-                      std::vector<std::size_t> b_ns_ks_strides,
-                      std::vector<int32_t>     b_ns_ks_modes,
-                      std::vector<std::size_t> ds_ms_ns_lengths,
-                      std::vector<std::size_t> ds_ms_ns_strides,
-                      std::vector<int32_t>     ds_ms_ns_modes,
-                      std::vector<std::size_t> e_ms_ns_lengths,
-                      std::vector<std::size_t> e_ms_ns_strides,
-                      std::vector<int32_t>     e_ms_ns_modes,
-                      void*                    workspacePtr) override
+        bool initArgs(ContractionArgs&                args,
+                      void const*                     alpha,
+                      void const*                     A,
+                      void const*                     B,
+                      void const*                     beta,
+                      void const*                     D,
+                      void*                           E,
+                      std::vector<std::size_t> const& a_ms_ks_lengths,
+                      std::vector<std::size_t> const& a_ms_ks_strides,
+                      std::vector<int32_t> const&     a_ms_ks_modes,
+                      std::vector<std::size_t> const& b_ns_ks_lengths,
+                      std::vector<std::size_t> const& b_ns_ks_strides,
+                      std::vector<int32_t> const&     b_ns_ks_modes,
+                      std::vector<std::size_t> const& ds_ms_ns_lengths,
+                      std::vector<std::size_t> const& ds_ms_ns_strides,
+                      std::vector<int32_t> const&     ds_ms_ns_modes,
+                      std::vector<std::size_t> const& e_ms_ns_lengths,
+                      std::vector<std::size_t> const& e_ms_ns_strides,
+                      std::vector<int32_t> const&     e_ms_ns_modes,
+                      void*                           workspacePtr) const override
         {
             using Base   = ContractionSolution;
             using Traits = MetaTraits<DeviceOp>;
 
             // Clear previous data
-            resetArgs();
+            args.reset();
 
             // Promote to derived class for necessary functions such as
             // MakeArgumentPointer and MakeInvokerPointer.
             auto* deviceOp = dynamic_cast<DeviceOp*>(Base::mDeviceOp.get());
 
-            // Note: CK ALWAYS uses float for alpha / beta in contraction multipleD
-            ScalarData alphaF;
-
-            if(alpha != nullptr)
-            {
-                alphaF = hiptensor::readVal<ScalarData>(
-                    alpha, convertToComputeType(HipDataType_v<typename Traits::ComputeDataT>));
-            }
-
             auto [normal_a_ms_ks_lengths,
                   normal_a_ms_ks_strides,
                   normal_b_ns_ks_lengths,
@@ -277,64 +309,106 @@ namespace hiptensor
                                        e_ms_ns_modes);
 
             // CK has its own format for indices...
-            auto toCKVec = [](std::vector<size_t> const& v) {
+            auto toCKVec = [](NormalExtents const& v) {
                 return std::vector<ck::index_t>(v.begin(), v.end());
             };
 
-            // Initialize the argument pointer
-            Base::mInvokerArgPtr
-                = std::move(deviceOp->MakeArgumentPointer(A,
-                                                          B,
-                                                          std::array<const void*, 0>{},
-                                                          E,
-                                                          toCKVec(normal_a_ms_ks_lengths),
-                                                          toCKVec(normal_a_ms_ks_strides),
-                                                          toCKVec(normal_b_ns_ks_lengths),
-                                                          toCKVec(normal_b_ns_ks_strides),
-                                                          std::array<std::vector<ck::index_t>, 0>{},
-                                                          std::array<std::vector<ck::index_t>, 0>{},
-                                                          toCKVec(normal_e_ms_ns_lengths),
-                                                          toCKVec(normal_e_ms_ns_strides),
-                                                          typename Traits::AOp{},
-                                                          typename Traits::BOp{},
-                                                          typename Traits::CDEOp(alphaF)));
+            args.mALengths = toCKVec(normal_a_ms_ks_lengths);
+            args.mAStrides = toCKVec(normal_a_ms_ks_strides);
+            args.mBLengths = toCKVec(normal_b_ns_ks_lengths);
+            args.mBStrides = toCKVec(normal_b_ns_ks_strides);
+            args.mELengths = toCKVec(normal_e_ms_ns_lengths);
+            args.mEStrides = toCKVec(normal_e_ms_ns_strides);
 
-            // Attach the workspace pointer
-            deviceOp->SetWorkSpacePointer(Base::mInvokerArgPtr.get(), workspacePtr);
+            // Initialize the argument pointer
+            args.mScalarSize    = sizeof(typename Traits::ComputeDataT);
+            args.mInvokerArgPtr = makeArgument(args, alpha, A, B, beta, D, E, workspacePtr);
+            args.mLaunchData    = args.launchData(alpha, A, B, beta, D, E, workspacePtr);
 
             // Initialize the invoker
-            Base::mInvokerPtr = std::move(deviceOp->MakeInvokerPointer());
+            args.mInvokerPtr = std::move(deviceOp->MakeInvokerPointer());
 
             // Fill problem metrics
-            Base::mM = std::accumulate(normal_a_ms_ks_lengths.begin(),
-                                       normal_a_ms_ks_lengths.begin() + MaxNumDimsM,
-                                       ck::index_t{1},
-                                       std::multiplies<ck::index_t>{});
+            args.mM = std::accumulate(normal_a_ms_ks_lengths.begin(),
+                                      normal_a_ms_ks_lengths.begin() + MaxNumDimsM,
+                                      ck::index_t{1},
+                                      std::multiplies<ck::index_t>{});
 
-            Base::mN = std::accumulate(normal_b_ns_ks_lengths.begin(),
-                                       normal_b_ns_ks_lengths.begin() + MaxNumDimsN,
-                                       ck::index_t{1},
-                                       std::multiplies<ck::index_t>{});
+            args.mN = std::accumulate(normal_b_ns_ks_lengths.begin(),
+                                      normal_b_ns_ks_lengths.begin() + MaxNumDimsN,
+                                      ck::index_t{1},
+                                      std::multiplies<ck::index_t>{});
 
-            Base::mK = std::accumulate(normal_a_ms_ks_lengths.begin() + MaxNumDimsM,
-                                       normal_a_ms_ks_lengths.end(),
-                                       ck::index_t{1},
-                                       std::multiplies<ck::index_t>{});
+            args.mK = std::accumulate(normal_a_ms_ks_lengths.begin() + MaxNumDimsM,
+                                      normal_a_ms_ks_lengths.end(),
+                                      ck::index_t{1},
+                                      std::multiplies<ck::index_t>{});
 
             // Byte count
-            Base::mBytes = sizeof(typename Traits::ADataT) * Base::mM * Base::mK
-                           + sizeof(typename Traits::BDataT) * Base::mK * Base::mN
-                           + sizeof(typename Traits::EDataT) * Base::mM * Base::mN;
+            args.mBytes = sizeof(typename Traits::ADataT) * args.mM * args.mK
+                          + sizeof(typename Traits::BDataT) * args.mK * args.mN
+                          + sizeof(typename Traits::EDataT) * args.mM * args.mN;
 
             // Arg test
-            Base::mValid = deviceOp->IsSupportedArgument(Base::mInvokerArgPtr.get());
+            args.mValid = deviceOp->IsSupportedArgument(args.mInvokerArgPtr.get());
 
-            if(!Base::mValid)
+            if(args.mValid)
+            {
+                args.mWorkspaceSize = deviceOp->GetWorkSpaceSize(args.mInvokerArgPtr.get());
+            }
+            else
             {
-                resetArgs();
+                args.reset();
             }
 
-            return Base::mValid;
+            return args.mValid;
+        }
+
+        std::unique_ptr<ck::tensor_operation::device::BaseArgument>
+            makeArgument(ContractionArgs const& args,
+                         void const*            alpha,
+                         void const*            A,
+                         void const*            B,
+                         void const*            beta,
+                         void const*            D,
+                         void*                  E,
+                         void*                  workspacePtr) const override
+        {
+            using Base   = ContractionSolution;
+            using Traits = MetaTraits<DeviceOp>;
+
+            auto* deviceOp = dynamic_cast<DeviceOp*>(Base::mDeviceOp.get());
+
+            // Note: CK ALWAYS uses float for alpha / beta in contraction multipleD
+            ScalarData alphaF;
+
+            if(alpha != nullptr)
+            {
+                alphaF = hiptensor::readVal<ScalarData>(
+                    alpha, convertToComputeType(HipDataType_v<typename Traits::ComputeDataT>));
+            }
+
+            auto argument
+                = deviceOp->MakeArgumentPointer(A,
+                                                B,
+                                                std::array<const void*, 0>{},
+                                                E,
+                                                args.mALengths,
+                                                args.mAStrides,
+                                                args.mBLengths,
+                                                args.mBStrides,
+                                                std::array<std::vector<ck::index_t>, 0>{},
+                                                std::array<std::vector<ck::index_t>, 0>{},
+                                                args.mELengths,
+                                                args.mEStrides,
+                                                typename Traits::AOp{},
+                                                typename Traits::BOp{},
+                                                typename Traits::CDEOp(alphaF));
+
+            // Attach the workspace pointer
+            deviceOp->SetWorkSpacePointer(argument.get(), workspacePtr);
+
+            return argument;
         }
     };
 
@@ -0,0 +1,470 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef HIPTENSOR_CONTRACTION_COMPLEX_3M_HPP
+#define HIPTENSOR_CONTRACTION_COMPLEX_3M_HPP
+
+#include <tuple>
+#include <type_traits>
+
+#include "device_contraction_bilinear_complex.hpp"
+#include "device_contraction_scale_complex.hpp"
+
+namespace ck
+{
+    namespace tensor_operation
+    {
+        namespace device
+        {
+            // The following wraps a complex (4M) contraction op and replaces its decomposition
+            // with the 3M (Gauss) algorithm, which trades one of the four real sub-contractions
+            // for element-wise additions:
+            //   T1 = Ar * Br, T2 = Ai * Bi, T3 = (Ar + Ai) * (Br + Bi)
+            //   Re(AB) = T1 - T2
+            //   Im(AB) = T3 - T1 - T2
+            // The three sub-contractions are chained through the CK scale / bilinear epilogues:
+            //   E_imag = -2 * T1
+            //   E_real = -1 * T2 + (-0.5) * E_imag          = T1 - T2
+            //   E_imag =  1 * T3 +    1   * E_imag          = T3 - 2 * T1
+            // and the final combine kernel restores Im(AB) = E_imag + E_real before applying
+            // alpha / beta. The (Ar + Ai) and (Br + Bi) planes are produced by the same
+            // AOS->SOA unpack pass, at the cost of one extra workspace plane per input.
+            // Being a distinct type, the 3M op gets its own kernel uid and is offered to the
+            // selection models alongside the 4M op with the same tuning parameters.
+            template <typename ComplexOp>
+            struct DeviceContractionComplex3M : public ComplexOp
+            {
+                using DeviceOp = DeviceContractionComplex3M;
+
+                using typename ComplexOp::AElementwiseOp;
+                using typename ComplexOp::BElementwiseOp;
+                using typename ComplexOp::BilinearCDEElementwiseOperation;
+                using typename ComplexOp::BilinearDecompOp;
+                using typename ComplexOp::ComplexA;
+                using typename ComplexOp::ComplexB;
+                using typename ComplexOp::ComplexDs;
+                using typename ComplexOp::ComplexE;
+                using typename ComplexOp::DecompA;
+                using typename ComplexOp::DecompB;
+                using typename ComplexOp::DecompBilinearCDEElementwiseOperation;
+                using typename ComplexOp::DecompDs;
+                using typename ComplexOp::DecompE;
+                using typename ComplexOp::DecompScaleCDEElementwiseOperation;
+                using typename ComplexOp::ScaleCDEElementwiseOperation;
+                using typename ComplexOp::ScaleDecompOp;
+
+                static constexpr index_t NumDTensor = ComplexOp::NumDTensor;
+
+                static_assert(NumDTensor == 0 || NumDTensor == 1,
+                              "3M contractions support scale or bilinear only");
+
+                using CDEElementwiseOperation = std::conditional_t<NumDTensor == 0,
+                                                                   ScaleCDEElementwiseOperation,
+                                                                   BilinearCDEElementwiseOperation>;
+
+                // Argument
+                struct Argument : public BaseArgument
+                {
+                    using ScaleDecompArgument    = typename ScaleDecompOp::Argument;
+                    using BilinearDecompArgument = typename BilinearDecompOp::Argument;
+
+                    Argument(const void*                                         p_a_grid,
+                             const void*                                         p_b_grid,
+                             std::array<const void*, NumDTensor>                 p_ds_grid,
+                             void*                                               p_e_grid,
+                             const std::vector<index_t>&                         a_ms_ks_lengths,
+                             const std::vector<index_t>&                         a_ms_ks_strides,
+                             const std::vector<index_t>&                         b_ns_ks_lengths,
+                             const std::vector<index_t>&                         b_ns_ks_strides,
+                             const std::array<std::vector<index_t>, NumDTensor>& ds_ms_ns_lengths,
+                             const std::array<std::vector<index_t>, NumDTensor>& ds_ms_ns_strides,
+                             const std::vector<index_t>&                         e_ms_ns_lengths,
+                             const std::vector<index_t>&                         e_ms_ns_strides,
+                             AElementwiseOp                                      a_element_op,
+                             BElementwiseOp                                      b_element_op,
+                             CDEElementwiseOperation                             cde_element_op)
+                        : mA_grid(p_a_grid)
+                        , mB_grid(p_b_grid)
+                        , mD_grid(nullptr)
+                        , mE_grid(p_e_grid)
+                        , mA_ms_ks_lengths(a_ms_ks_lengths)
+                        , mA_ms_ks_strides(a_ms_ks_strides)
+                        , mB_ns_ks_lengths(b_ns_ks_lengths)
+                        , mB_ns_ks_strides(b_ns_ks_strides)
+                        , mE_ms_ns_lengths(e_ms_ns_lengths)
+                        , mE_ms_ns_strides(e_ms_ns_strides)
+                        , mA_element_op(a_element_op)
+                        , mB_element_op(b_element_op)
+                        , element_op(cde_element_op)
+                    {
+                        elementsA = elementsFromLengths(a_ms_ks_lengths);
+                        elementsB = elementsFromLengths(b_ns_ks_lengths);
+                        elementsD = 0;
+                        elementsE = elementsFromLengths(e_ms_ns_lengths);
+
+                        if constexpr(NumDTensor == 1)
+                        {
+                            mD_grid   = p_ds_grid[0];
+                            elementsD = elementsFromLengths(ds_ms_ns_lengths[0]);
+                        }
+
+                        // Until a workspace is attached the planar buffers are null, which
+                        // is enough for the support and workspace size queries.
+                        bindWorkspace(nullptr);
+                    }
+
+                    // Carves the planar (SOA) buffers out of the workspace and re-makes the
+                    // decomposed arguments on them. The remainder is left to the decomposed ops.
+                    void bindWorkspace(void* p_workspace)
+                    {
+                        auto carver = WorkspaceCarver(p_workspace);
+
+                        mA_real = carver.carve<DecompA>(elementsA);
+                        mA_imag = carver.carve<DecompA>(elementsA);
+                        mA_sum  = carver.carve<DecompA>(elementsA);
+                        mB_real = carver.carve<DecompB>(elementsB);
+                        mB_imag = carver.carve<DecompB>(elementsB);
+                        mB_sum  = carver.carve<DecompB>(elementsB);
+                        mD_real = carver.carve<DecompDs>(elementsD);
+                        mD_imag = carver.carve<DecompDs>(elementsD);
+                        mE_real = carver.carve<DecompE>(elementsE);
+                        mE_imag = carver.carve<DecompE>(elementsE);
+
+                        mPlanarBytes     = carver.size();
+                        mDecompWorkspace = carver.remainder();
+
+                        mScaleArgs = std::make_unique<ScaleDecompArgument>(
+                            mA_real,
+                            mB_real,
+                            std::array<void const*, 0>{},
+                            mE_imag,
+                            mA_ms_ks_lengths,
+                            mA_ms_ks_strides,
+                            mB_ns_ks_lengths,
+                            mB_ns_ks_strides,
+                            std::array<std::vector<index_t>, 0>{},
+                            std::array<std::vector<index_t>, 0>{},
+                            mE_ms_ns_lengths,
+                            mE_ms_ns_strides,
+                            mA_element_op,
+                            mB_element_op,
+                            DecompScaleCDEElementwiseOperation{-2.0f});
+
+                        auto makeBilinearArgs = [this](auto*       out_e,
+                                                       auto const* in_a,
+                                                       auto const* in_b,
+                                                       auto const* in_d,
+                                                       auto const& cde_element_op) {
+                            return std::make_unique<BilinearDecompArgument>(
+                                in_a,
+                                in_b,
+                                std::array<void const*, 1>{in_d},
+                                out_e,
+                                mA_ms_ks_lengths,
+                                mA_ms_ks_strides,
+                                mB_ns_ks_lengths,
+                                mB_ns_ks_strides,
+                                std::array<std::vector<index_t>, 1>{mE_ms_ns_lengths},
+                                std::array<std::vector<index_t>, 1>{mE_ms_ns_strides},
+                                mE_ms_ns_lengths,
+                                mE_ms_ns_strides,
+                                mA_element_op,
+                                mB_element_op,
+                                cde_element_op);
+                        };
+
+                        mBilinearArgs[0] = makeBilinearArgs(
+                            mE_real,
+                            mA_imag,
+                            mB_imag,
+                            mE_imag,
+                            DecompBilinearCDEElementwiseOperation{-1.0f, -0.5f});
+                        mBilinearArgs[1]
+                            = makeBilinearArgs(mE_imag,
+                                               mA_sum,
+                                               mB_sum,
+                                               mE_imag,
+                                               DecompBilinearCDEElementwiseOperation{1.0f, 1.0f});
+                    }
+
+                    void Print() const
+                    {
+                        std::cout << "ScaleArgs:" << std::endl;
+                        mScaleArgs->Print();
+                        std::cout << "BilinearArgs0:" << std::endl;
+                        mBilinearArgs[0]->Print();
+                        std::cout << "BilinearArgs1:" << std::endl;
+                        mBilinearArgs[1]->Print();
+                    }
+
+                    // Argument sets for 3M: T1, then T2 and T3 chained through E
+                    std::unique_ptr<ScaleDecompArgument>    mScaleArgs;
+                    std::unique_ptr<BilinearDecompArgument> mBilinearArgs[2];
+
+                    // AOS inputs / output given through the interface
+                    const void* mA_grid;
+                    const void* mB_grid;
+                    const void* mD_grid;
+                    void*       mE_grid;
+
+                    // SOA buffers, carved from the workspace
+                    DecompA*    mA_real;
+                    DecompA*    mA_imag;
+                    DecompA*    mA_sum;
+                    DecompB*    mB_real;
+                    DecompB*    mB_imag;
+                    DecompB*    mB_sum;
+                    DecompDs*   mD_real;
+                    DecompDs*   mD_imag;
+                    DecompE*    mE_real;
+                    DecompE*    mE_imag;
+                    void*       mDecompWorkspace;
+                    std::size_t mPlanarBytes;
+
+                    // Problem, kept to re-make the decomposed arguments
+                    std::vector<index_t>    mA_ms_ks_lengths;
+                    std::vector<index_t>    mA_ms_ks_strides;
+                    std::vector<index_t>    mB_ns_ks_lengths;
+                    std::vector<index_t>    mB_ns_ks_strides;
+                    std::vector<index_t>    mE_ms_ns_lengths;
+                    std::vector<index_t>    mE_ms_ns_strides;
+                    AElementwiseOp          mA_element_op;
+                    BElementwiseOp          mB_element_op;
+                    CDEElementwiseOperation element_op;
+                    index_t                 elementsA;
+                    index_t                 elementsB;
+                    index_t                 elementsD;
+                    index_t                 elementsE;
+                };
+
+                // Invoker
+                struct Invoker : public BaseInvoker
+                {
+                    using Argument = typename DeviceOp::Argument;
+
+                    Invoker()
+                        : mScaleInvoker(std::make_unique<typename ScaleDecompOp::Invoker>())
+                        , mBilinearInvoker(std::make_unique<typename BilinearDecompOp::Invoker>())
+                    {
+                    }
+
+                    float Run(const Argument&     arg,
+                              const StreamConfig& stream_config = StreamConfig{})
+                    {
+                        auto blockDim = dim3(1024);
+                        auto stream   = stream_config.stream_id_;
+
+                        // Decompose the incoming data from AOS->SOA, with the extra
+                        // (real + imag) plane needed for T3.
+                        auto unpackGrid3m = [blockDim, stream](auto const* input_grid,
+                                                               auto*       out_r,
+                                                               auto*       out_i,
+                                                               auto*       out_s,
+                                                               index_t     elementCount) {
+                            if(input_grid != nullptr)
+                            {
+                                auto gridDim = dim3(ceilDiv(elementCount, blockDim.x));
+                                hiptensor::unpack3m<<<gridDim, blockDim, 0, stream>>>(
+                                    input_grid, out_r, out_i, out_s, elementCount);
+                            }
+                        };
+
+                        unpackGrid3m((const ComplexA*)arg.mA_grid,
+                                     arg.mA_real,
+                                     arg.mA_imag,
+                                     arg.mA_sum,
+                                     arg.elementsA);
+                        unpackGrid3m((const ComplexB*)arg.mB_grid,
+                                     arg.mB_real,
+                                     arg.mB_imag,
+                                     arg.mB_sum,
+                                     arg.elementsB);
+
+                        if(arg.mD_grid != nullptr)
+                        {
+                            auto gridDim = dim3(ceilDiv(arg.elementsD, blockDim.x));
+                            hiptensor::unpack<<<gridDim, blockDim, 0, stream>>>(
+                                (const ComplexDs*)arg.mD_grid,
+                                arg.mD_real,
+                                arg.mD_imag,
+                                arg.elementsD);
+                        }
+
+                        // Order matters: each step consumes the E plane of the previous one.
+                        auto r0 = mScaleInvoker->Run(arg.mScaleArgs.get(), stream_config);
+                        auto r1 = mBilinearInvoker->Run(arg.mBilinearArgs[0].get(), stream_config);
+                        auto r2 = mBilinearInvoker->Run(arg.mBilinearArgs[1].get(), stream_config);
+
+                        if(arg.mE_grid != nullptr)
+                        {
+                            auto gridDim = dim3(ceilDiv(arg.elementsE, blockDim.x));
+
+                            if constexpr(NumDTensor == 1)
+                            {
+                                hiptensor::mfma3m<<<gridDim, blockDim, 0, stream>>>(
+                                    arg.mE_real,
+                                    arg.mE_imag,
+                                    arg.mD_real,
+                                    arg.mD_imag,
+                                    ((ComplexE*)arg.mE_grid),
+                                    arg.element_op.alpha_,
+                                    arg.element_op.beta_,
+                                    arg.elementsE);
+                            }
+                            else
+                            {
+                                hiptensor::multiply3m<<<gridDim, blockDim, 0, stream>>>(
+                                    arg.mE_real,
+                                    arg.mE_imag,
+                                    ((ComplexE*)arg.mE_grid),
+                                    arg.element_op.scale_,
+                                    arg.elementsE);
+                            }
+                        }
+
+                        return r0 + r1 + r2;
+                    }
+
+                    // polymorphic
+                    float Run(const BaseArgument* p_arg,
+                              const StreamConfig& stream_config = StreamConfig{}) override
+                    {
+                        return Run(*dynamic_cast<const Argument*>(p_arg), stream_config);
+                    }
+
+                    std::unique_ptr<typename ScaleDecompOp::Invoker>    mScaleInvoker;
+                    std::unique_ptr<typename BilinearDecompOp::Invoker> mBilinearInvoker;
+                };
+
+                static bool IsSupportedArgument(const Argument& arg)
+                {
+                    return ScaleDecompOp::IsSupportedArgument(*(arg.mScaleArgs.get()))
+                           && BilinearDecompOp::IsSupportedArgument(*(arg.mBilinearArgs[0].get()))
+                           && BilinearDecompOp::IsSupportedArgument(*(arg.mBilinearArgs[1].get()));
+                }
+
+                // polymorphic
+                bool IsSupportedArgument(const BaseArgument* p_arg) override
+                {
+                    return IsSupportedArgument(*dynamic_cast<const Argument*>(p_arg));
+                }
+
+                // polymorphic
+                size_t GetWorkSpaceSize(const BaseArgument* p_arg) const override
+                {
+                    // Planar buffers, followed by the workspace of the decomposed ops
+                    auto* arg = dynamic_cast<const Argument*>(p_arg);
+                    return arg->mPlanarBytes
+                           + std::max(ScaleDecompOp{}.GetWorkSpaceSize(arg->mScaleArgs.get()),
+                                      BilinearDecompOp{}.GetWorkSpaceSize(
+                                          arg->mBilinearArgs[0].get()));
+                }
+
+                // polymorphic
+                virtual void SetWorkSpacePointer(BaseArgument*       p_arg,
+                                                 void*               p_workspace,
+                                                 StreamConfig const& s
+                                                 = StreamConfig{}) const override
+                {
+                    // Call the base, carve the planar buffers, then fwd the rest to each arg.
+                    this->BaseOperator::SetWorkSpacePointer(p_arg, p_workspace, s);
+                    auto* arg = dynamic_cast<Argument*>(p_arg);
+                    arg->bindWorkspace(p_workspace);
+
+                    auto* p_decomp = arg->mDecompWorkspace;
+                    this->BaseOperator::SetWorkSpacePointer(arg->mScaleArgs.get(), p_decomp, s);
+                    this->BaseOperator::SetWorkSpacePointer(
+                        arg->mBilinearArgs[0].get(), p_decomp, s);
+                    this->BaseOperator::SetWorkSpacePointer(
+                        arg->mBilinearArgs[1].get(), p_decomp, s);
+                }
+
+                // polymorphic
+                std::unique_ptr<BaseArgument> MakeArgumentPointer(
+                    const void*                                         p_a,
+                    const void*                                         p_b,
+                    std::array<const void*, NumDTensor>                 p_ds,
+                    void*                                               p_e,
+                    const std::vector<index_t>&                         a_ms_ks_lengths,
+                    const std::vector<index_t>&                         a_ms_ks_strides,
+                    const std::vector<index_t>&                         b_ns_ks_lengths,
+                    const std::vector<index_t>&                         b_ns_ks_strides,
+                    const std::array<std::vector<index_t>, NumDTensor>& ds_ms_ns_lengths,
+                    const std::array<std::vector<index_t>, NumDTensor>& ds_ms_ns_strides,
+                    const std::vector<index_t>&                         e_ms_ns_lengths,
+                    const std::vector<index_t>&                         e_ms_ns_strides,
+                    AElementwiseOp                                      a_element_op,
+                    BElementwiseOp                                      b_element_op,
+                    CDEElementwiseOperation                             cde_element_op) override
+                {
+                    return std::make_unique<Argument>(p_a,
+                                                      p_b,
+                                                      p_ds,
+                                                      p_e,
+                                                      a_ms_ks_lengths,
+                                                      a_ms_ks_strides,
+                                                      b_ns_ks_lengths,
+                                                      b_ns_ks_strides,
+                                                      ds_ms_ns_lengths,
+                                                      ds_ms_ns_strides,
+                                                      e_ms_ns_lengths,
+                                                      e_ms_ns_strides,
+                                                      a_element_op,
+                                                      b_element_op,
+                                                      cde_element_op);
+                }
+
+                // polymorphic
+                std::unique_ptr<BaseInvoker> MakeInvokerPointer() override
+                {
+                    return std::make_unique<Invoker>();
+                }
+
+                // polymorphic
+                std::string GetTypeString() const override
+                {
+                    return ComplexOp::GetTypeString() + "_3M";
+                }
+            };
+
+            // Maps a tuple of complex (4M) instances onto their 3M counterparts
+            template <typename InstanceTuple>
+            struct Complex3MInstances;
+
+            template <typename... ComplexOps>
+            struct Complex3MInstances<std::tuple<ComplexOps...>>
+            {
+                using type = std::tuple<DeviceContractionComplex3M<ComplexOps>...>;
+            };
+
+            template <typename InstanceTuple>
+            using complex_3m_instances_t = typename Complex3MInstances<InstanceTuple>::type;
+
+        } // namespace device
+    } // namespace tensor_operation
+} // namespace ck
+
+#endif // HIPTENSOR_CONTRACTION_COMPLEX_3M_HPP
@@ -38,10 +38,9 @@ namespace ck
         namespace device
         {
 
-            using hiptensor::allocDevice;
             using hiptensor::ceilDiv;
-            using hiptensor::DeviceDeleter;
             using hiptensor::elementsFromLengths;
+            using hiptensor::WorkspaceCarver;
 
             using Bilinear        = ck::tensor_operation::element_wise::Bilinear;
             using BilinearComplex = ck::tensor_operation::element_wise::BilinearComplex;
@@ -172,6 +171,10 @@ namespace ck
                 // Complex device Op
                 using DeviceOp = DeviceContractionMultipleD_Xdl_CShuffle;
 
+                // A/B element-wise operations, exposed for derived (3M) ops
+                using AElementwiseOp = AElementwiseOperation;
+                using BElementwiseOp = BElementwiseOperation;
+
                 // CDE Operations
                 using ScaleCDEElementwiseOperation          = ScaleComplex;
                 using DecompScaleCDEElementwiseOperation    = Scale;
@@ -306,26 +309,6 @@ namespace ck
                     using ScaleDecompArgument    = typename ScaleDecompOp::Argument;
                     using BilinearDecompArgument = typename BilinearDecompOp::Argument;
 
-                    Argument(Argument&& other)
-                        : mScaleArgs(
-                            {std::move(other.mScaleArgs[0]), std::move(other.mScaleArgs[1])})
-                        , mBilinearArgs({std::move(other.mBilinearArgs[0]),
-                                         std::move(other.mBilinearArgs[1])})
-                    {
-                    }
-
-                    Argument& operator=(Argument&& other)
-                    {
-                        if(this != &other)
-                        {
-                            mScaleArgs[0]    = std::move(other.mScaleArgs[0]);
-                            mScaleArgs[1]    = std::move(other.mScaleArgs[1]);
-                            mBilinearArgs[0] = std::move(other.mBilinearArgs[0]);
-                            mBilinearArgs[1] = std::move(other.mBilinearArgs[1]);
-                        }
-                        return *this;
-                    }
-
                     Argument(const void*                                         p_a_grid,
                              const void*                                         p_b_grid,
                              std::array<const void*, NumDTensor>                 p_ds_grid,
@@ -341,127 +324,106 @@ namespace ck
                              AElementwiseOperation                               a_element_op,
                              BElementwiseOperation                               b_element_op,
                              ScaleCDEElementwiseOperation                        cde_element_op)
-                        : element_op(cde_element_op)
+                        : mA_grid(p_a_grid)
+                        , mB_grid(p_b_grid)
+                        , mE_grid(p_e_grid)
+                        , mA_ms_ks_lengths(a_ms_ks_lengths)
+                        , mA_ms_ks_strides(a_ms_ks_strides)
+                        , mB_ns_ks_lengths(b_ns_ks_lengths)
+                        , mB_ns_ks_strides(b_ns_ks_strides)
+                        , mE_ms_ns_lengths(e_ms_ns_lengths)
+                        , mE_ms_ns_strides(e_ms_ns_strides)
+                        , mA_element_op(a_element_op)
+                        , mB_element_op(b_element_op)
+                        , element_op(cde_element_op)
                     {
-                        // Take the incoming arguments, treat them as complex.
+                        elementsA = elementsFromLengths(a_ms_ks_lengths);
+                        elementsB = elementsFromLengths(b_ns_ks_lengths);
+                        elementsE = elementsFromLengths(e_ms_ns_lengths);
 
-                        // Allocate Real and Imaginary inputs
-                        auto elementsA = elementsFromLengths(a_ms_ks_lengths);
-                        auto elementsB = elementsFromLengths(b_ns_ks_lengths);
-                        elementsE      = elementsFromLengths(e_ms_ns_lengths);
-
-                        mA_real.reset(nullptr);
-                        mA_imag.reset(nullptr);
-                        mB_real.reset(nullptr);
-                        mB_imag.reset(nullptr);
-                        mE_real.reset(nullptr);
-                        mE_imag.reset(nullptr);
-
-                        mE_grid       = p_e_grid;
-                        auto blockDim = dim3(1024);
-
-                        auto decompGrid = [blockDim](auto&       out_r,
-                                                     auto&       out_i,
-                                                     auto const* input_grid,
-                                                     uint32_t    elementCount) {
-                            using DecompT = typename std::decay_t<decltype(out_r)>::element_type;
-                            static_assert(std::is_same_v<
-                                              DecompT,
-                                              typename std::decay_t<decltype(out_i)>::element_type>,
-                                          "r and i buffers must be same type");
-
-                            if(input_grid != nullptr)
-                            {
-                                out_r = std::move(allocDevice<DecompT>(elementCount));
-                                out_i = std::move(allocDevice<DecompT>(elementCount));
-
-                                auto gridDim = dim3(ceilDiv(elementCount, blockDim.x));
-                                hiptensor::unpack<<<gridDim, blockDim, 0>>>(
-                                    input_grid, out_r.get(), out_i.get(), elementCount);
-                            }
-                        };
+                        // Until a workspace is attached the planar buffers are null, which
+                        // is enough for the support and workspace size queries.
+                        bindWorkspace(nullptr);
+                    }
 
-                        // Decompose the incoming data from AOS->SOA
-                        decompGrid(mA_real, mA_imag, (const ComplexA*)p_a_grid, elementsA);
-                        decompGrid(mB_real, mB_imag, (const ComplexB*)p_b_grid, elementsB);
-                        decompGrid(mE_real, mE_imag, (const ComplexE*)p_e_grid, elementsE);
-
-                        auto allocScaleArgs = [a_ms_ks_lengths,
-                                               a_ms_ks_strides,
-                                               b_ns_ks_lengths,
-                                               b_ns_ks_strides,
-                                               e_ms_ns_lengths,
-                                               e_ms_ns_strides,
-                                               a_element_op,
-                                               b_element_op](auto&       out_e,
-                                                             auto const& in_a,
-                                                             auto const& in_b,
-                                                             auto const& cde_element_op) {
+                    // Carves the planar (SOA) buffers out of the workspace and re-makes the
+                    // decomposed arguments on them. The remainder is left to the decomposed ops.
+                    void bindWorkspace(void* p_workspace)
+                    {
+                        auto carver = WorkspaceCarver(p_workspace);
+
+                        mA_real = carver.carve<DecompA>(elementsA);
+                        mA_imag = carver.carve<DecompA>(elementsA);
+                        mB_real = carver.carve<DecompB>(elementsB);
+                        mB_imag = carver.carve<DecompB>(elementsB);
+                        mE_real = carver.carve<DecompE>(elementsE);
+                        mE_imag = carver.carve<DecompE>(elementsE);
+
+                        mPlanarBytes     = carver.size();
+                        mDecompWorkspace = carver.remainder();
+
+                        auto makeScaleArgs = [this](auto*       out_e,
+                                                    auto const* in_a,
+                                                    auto const* in_b,
+                                                    auto const& cde_element_op) {
                             return std::make_unique<ScaleDecompArgument>(
-                                in_a.get(),
-                                in_b.get(),
+                                in_a,
+                                in_b,
                                 std::array<void const*, 0>{},
-                                out_e.get(),
-                                a_ms_ks_lengths,
-                                a_ms_ks_strides,
-                                b_ns_ks_lengths,
-                                b_ns_ks_strides,
+                                out_e,
+                                mA_ms_ks_lengths,
+                                mA_ms_ks_strides,
+                                mB_ns_ks_lengths,
+                                mB_ns_ks_strides,
                                 std::array<std::vector<index_t>, 0>{},
                                 std::array<std::vector<index_t>, 0>{},
-                                e_ms_ns_lengths,
-                                e_ms_ns_strides,
-                                a_element_op,
-                                b_element_op,
+                                mE_ms_ns_lengths,
+                                mE_ms_ns_strides,
+                                mA_element_op,
+                                mB_element_op,
                                 cde_element_op);
                         };
 
-                        auto allocBilinearArgs = [a_ms_ks_lengths,
-                                                  a_ms_ks_strides,
-                                                  b_ns_ks_lengths,
-                                                  b_ns_ks_strides,
-                                                  e_ms_ns_lengths,
-                                                  e_ms_ns_strides,
-                                                  a_element_op,
-                                                  b_element_op](auto&       out_e,
-                                                                auto const& in_a,
-                                                                auto const& in_b,
-                                                                auto const& in_d,
-                                                                auto const& cde_element_op) {
+                        auto makeBilinearArgs = [this](auto*       out_e,
+                                                       auto const* in_a,
+                                                       auto const* in_b,
+                                                       auto const* in_d,
+                                                       auto const& cde_element_op) {
                             return std::make_unique<BilinearDecompArgument>(
-                                in_a.get(),
-                                in_b.get(),
-                                std::array<void const*, 1>{in_d.get()},
-                                out_e.get(),
-                                a_ms_ks_lengths,
-                                a_ms_ks_strides,
-                                b_ns_ks_lengths,
-                                b_ns_ks_strides,
-                                std::array<std::vector<index_t>, 1>{e_ms_ns_lengths},
-                                std::array<std::vector<index_t>, 1>{e_ms_ns_strides},
-                                e_ms_ns_lengths,
-                                e_ms_ns_strides,
-                                a_element_op,
-                                b_element_op,
+                                in_a,
+                                in_b,
+                                std::array<void const*, 1>{in_d},
+                                out_e,
+                                mA_ms_ks_lengths,
+                                mA_ms_ks_strides,
+                                mB_ns_ks_lengths,
+                                mB_ns_ks_strides,
+                                std::array<std::vector<index_t>, 1>{mE_ms_ns_lengths},
+                                std::array<std::vector<index_t>, 1>{mE_ms_ns_strides},
+                                mE_ms_ns_lengths,
+                                mE_ms_ns_strides,
+                                mA_element_op,
+                                mB_element_op,
                                 cde_element_op);
                         };
 
-                        mScaleArgs[0] = allocScaleArgs(
+                        mScaleArgs[0] = makeScaleArgs(
                             mE_real, mA_real, mB_real, DecompScaleCDEElementwiseOperation{1.0f});
                         mBilinearArgs[0]
-                            = allocBilinearArgs(mE_real,
-                                                mA_imag,
-                                                mB_imag,
-                                                mE_real,
-                                                DecompBilinearCDEElementwiseOperation{-1.0f, 1.0f});
+                            = makeBilinearArgs(mE_real,
+                                               mA_imag,
+                                               mB_imag,
+                                               mE_real,
+                                               DecompBilinearCDEElementwiseOperation{-1.0f, 1.0f});
 
-                        mScaleArgs[1] = allocScaleArgs(
+                        mScaleArgs[1] = makeScaleArgs(
                             mE_imag, mA_real, mB_imag, DecompScaleCDEElementwiseOperation{1.0f});
                         mBilinearArgs[1]
-                            = allocBilinearArgs(mE_imag,
-                                                mA_imag,
-                                                mB_real,
-                                                mE_imag,
-                                                DecompBilinearCDEElementwiseOperation{1.0f, 1.0f});
+                            = makeBilinearArgs(mE_imag,
+                                               mA_imag,
+                                               mB_real,
+                                               mE_imag,
+                                               DecompBilinearCDEElementwiseOperation{1.0f, 1.0f});
                     }
 
                     void Print() const
@@ -481,19 +443,33 @@ namespace ck
                     std::unique_ptr<ScaleDecompArgument>    mScaleArgs[2];
                     std::unique_ptr<BilinearDecompArgument> mBilinearArgs[2];
 
-                    template <typename DataT>
-                    using DeviceArray = std::unique_ptr<DataT, DeviceDeleter>;
-
-                    // Manage extra memory for AOS->SOA
-                    DeviceArray<DecompA> mA_real;
-                    DeviceArray<DecompA> mA_imag;
-                    DeviceArray<DecompB> mB_real;
-                    DeviceArray<DecompB> mB_imag;
-                    DeviceArray<DecompE> mE_real;
-                    DeviceArray<DecompE> mE_imag;
-
+                    // AOS inputs / output given through the interface
+                    const void* mA_grid;
+                    const void* mB_grid;
+                    void*       mE_grid;
+
+                    // SOA buffers, carved from the workspace
+                    DecompA*    mA_real;
+                    DecompA*    mA_imag;
+                    DecompB*    mB_real;
+                    DecompB*    mB_imag;
+                    DecompE*    mE_real;
+                    DecompE*    mE_imag;
+                    void*       mDecompWorkspace;
+                    std::size_t mPlanarBytes;
+
+                    // Problem, kept to re-make the decomposed arguments
+                    std::vector<index_t>         mA_ms_ks_lengths;
+                    std::vector<index_t>         mA_ms_ks_strides;
+                    std::vector<index_t>         mB_ns_ks_lengths;
+                    std::vector<index_t>         mB_ns_ks_strides;
+                    std::vector<index_t>         mE_ms_ns_lengths;
+                    std::vector<index_t>         mE_ms_ns_strides;
+                    AElementwiseOperation        mA_element_op;
+                    BElementwiseOperation        mB_element_op;
                     ScaleCDEElementwiseOperation element_op;
-                    void*                        mE_grid;
+                    index_t                      elementsA;
+                    index_t                      elementsB;
                     index_t                      elementsE;
                 };
 
@@ -527,6 +503,31 @@ namespace ck
                     float Run(const Argument&     arg,
                               const StreamConfig& stream_config = StreamConfig{})
                     {
+                        auto blockDim = dim3(1024);
+
+                        // Decompose the incoming data from AOS->SOA
+                        auto stream     = stream_config.stream_id_;
+                        auto unpackGrid = [blockDim, stream](auto const* input_grid,
+                                                             auto*       out_r,
+                                                             auto*       out_i,
+                                                             index_t     elementCount) {
+                            if(input_grid != nullptr)
+                            {
+                                auto gridDim = dim3(ceilDiv(elementCount, blockDim.x));
+                                hiptensor::unpack<<<gridDim, blockDim, 0, stream>>>(
+                                    input_grid, out_r, out_i, elementCount);
+                            }
+                        };
+
+                        unpackGrid((const ComplexA*)arg.mA_grid,
+                                   arg.mA_real,
+                                   arg.mA_imag,
+                                   arg.elementsA);
+                        unpackGrid((const ComplexB*)arg.mB_grid,
+                                   arg.mB_real,
+                                   arg.mB_imag,
+                                   arg.elementsB);
+
                         auto r0 = mScaleInvoker->Run(arg.mScaleArgs[0].get(), stream_config);
                         auto r1 = mScaleInvoker->Run(arg.mScaleArgs[1].get(), stream_config);
                         auto r2 = mBilinearInvoker->Run(arg.mBilinearArgs[0].get(), stream_config);
@@ -534,14 +535,13 @@ namespace ck
 
                         if(arg.mE_grid != nullptr)
                         {
-                            auto blockDim = dim3(1024);
-                            auto gridDim  = dim3(ceilDiv(arg.elementsE, blockDim.x));
-
-                            hiptensor::multiply<<<gridDim, blockDim, 0>>>(arg.mE_real.get(),
-                                                                          arg.mE_imag.get(),
-                                                                          ((ComplexE*)arg.mE_grid),
-                                                                          arg.element_op.scale_,
-                                                                          arg.elementsE);
+                            auto gridDim = dim3(ceilDiv(arg.elementsE, blockDim.x));
+                            hiptensor::multiply<<<gridDim, blockDim, 0, stream>>>(
+                                arg.mE_real,
+                                arg.mE_imag,
+                                ((ComplexE*)arg.mE_grid),
+                                arg.element_op.scale_,
+                                arg.elementsE);
                         }
 
                         return r0 + r1 + r2 + r3;
@@ -572,23 +572,35 @@ namespace ck
                     return IsSupportedArgument(*dynamic_cast<const Argument*>(p_arg));
                 }
 
+                // polymorphic
+                size_t GetWorkSpaceSize(const BaseArgument* p_arg) const override
+                {
+                    // Planar buffers, followed by the workspace of the decomposed ops
+                    auto* arg = dynamic_cast<const Argument*>(p_arg);
+                    return arg->mPlanarBytes
+                           + std::max(ScaleDecompOp{}.GetWorkSpaceSize(arg->mScaleArgs[0].get()),
+                                      BilinearDecompOp{}.GetWorkSpaceSize(
+                                          arg->mBilinearArgs[0].get()));
+                }
+
                 // polymorphic
                 virtual void SetWorkSpacePointer(BaseArgument*       p_arg,
                                                  void*               p_workspace,
                                                  StreamConfig const& s
                                                  = StreamConfig{}) const override
                 {
-                    // Call the base, then fwd to each arg.
+                    // Call the base, carve the planar buffers, then fwd the rest to each arg.
                     this->BaseOperator::SetWorkSpacePointer(p_arg, p_workspace, s);
                     auto* arg = dynamic_cast<Argument*>(p_arg);
+                    arg->bindWorkspace(p_workspace);
+
+                    auto* p_decomp = arg->mDecompWorkspace;
+                    this->BaseOperator::SetWorkSpacePointer(arg->mScaleArgs[0].get(), p_decomp, s);
+                    this->BaseOperator::SetWorkSpacePointer(arg->mScaleArgs[1].get(), p_decomp, s);
                     this->BaseOperator::SetWorkSpacePointer(
-                        arg->mScaleArgs[0].get(), p_workspace, s);
-                    this->BaseOperator::SetWorkSpacePointer(
-                        arg->mScaleArgs[1].get(), p_workspace, s);
-                    this->BaseOperator::SetWorkSpacePointer(
-                        arg->mBilinearArgs[0].get(), p_workspace, s);
+                        arg->mBilinearArgs[0].get(), p_decomp, s);
                     this->BaseOperator::SetWorkSpacePointer(
-                        arg->mBilinearArgs[1].get(), p_workspace, s);
+                        arg->mBilinearArgs[1].get(), p_decomp, s);
                 }
 
                 static auto MakeArgument(
@@ -23,15 +23,27 @@
  * THE SOFTWARE.
  *
  *******************************************************************************/
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <unordered_map>
+
 #include <hiptensor/hiptensor.hpp>
 
+#include "contraction_cpu_reference_instances.hpp"
+#include "contraction_dispatch.hpp"
 #include "contraction_selection.hpp"
+#include "contraction_selection_cache.hpp"
 #include "contraction_solution.hpp"
 #include "contraction_solution_instances.hpp"
 #include "contraction_solution_registry.hpp"
+#include "data_types.hpp"
 #include "handle.hpp"
 #include "hip_device.hpp"
 #include "logger.hpp"
+#include "mode_coalescing.hpp"
+#include "perf_stats.hpp"
+#include "plan_cache.hpp"
 
 // Convert between vectors of void ptrs stored in opaque API objects
 // to vectors of ContractionSolution ptrs with simple cast.
@@ -66,6 +78,171 @@ inline auto toVoidVec(std::unordered_map<std::size_t, hiptensor::ContractionSolu
     return result;
 }
 
+// Device backend calls need a device, and the current one must be the handle's.
+// Only compares ids: the device properties are queried once per process.
+inline bool isHandleDeviceCurrent(hiptensor::Handle* handle)
+{
+    auto handleDeviceId = handle->getDevice().getDeviceId();
+    return handleDeviceId >= 0 && hiptensor::HipDevice::currentDeviceId() == handleDeviceId;
+}
+
+// Number of sub-problems the plan runs, one per iteration of its split
+inline std::size_t splitCount(hiptensorContractionPlan_t const& plan)
+{
+    auto* split = (hiptensor::ModeSplit const*)(plan.mSplit.get());
+    return split == nullptr ? 1u : split->count();
+}
+
+// Runs the launch on the operands of every iteration of the plan's split, or once on
+// the operands themselves if there is none. Returns the first failing status, and the
+// total time of the launches.
+template <typename Launch>
+inline std::pair<hiptensorStatus_t, float> forEachSplit(hiptensorContractionPlan_t const& plan,
+                                                        const void*                       A,
+                                                        const void*                       B,
+                                                        const void*                       C,
+                                                        void*                             D,
+                                                        Launch&&                          launch)
+{
+    auto* split = (hiptensor::ModeSplit const*)(plan.mSplit.get());
+    if(split == nullptr)
+    {
+        return launch(A, B, C, D);
+    }
+
+    // C is not an operand of scale contractions
+    auto  hasC      = split->mStrides.size() > 3;
+    float totalTime = 0.0f;
+    for(std::size_t i = 0; i < split->count(); i++)
+    {
+        auto [errorCode, time] = launch(split->at(A, 0, i),
+                                        split->at(B, 1, i),
+                                        hasC ? split->at(C, 3, i) : C,
+                                        split->at(D, 2, i));
+        if(errorCode != HIPTENSOR_STATUS_SUCCESS)
+        {
+            return {errorCode, totalTime};
+        }
+        totalTime += time;
+    }
+
+    return {HIPTENSOR_STATUS_SUCCESS, totalTime};
+}
+
+// Normalize and validate the plan's problem once, so that execution
+// only needs to patch in data pointers and scalars.
+inline std::shared_ptr<hiptensor::ContractionArgs>
+    makePlanArgs(hiptensor::ContractionSolution const*   solution,
+                 hiptensorContractionDescriptor_t const& desc)
+{
+    auto args = std::make_shared<hiptensor::ContractionArgs>();
+    if(!solution->initArgs(*args,
+                           nullptr,
+                           nullptr,
+                           nullptr,
+                           nullptr,
+                           nullptr,
+                           nullptr,
+                           desc.mTensorDesc[0].mLengths,
+                           desc.mTensorDesc[0].mStrides,
+                           desc.mTensorMode[0],
+                           desc.mTensorDesc[1].mLengths,
+                           desc.mTensorDesc[1].mStrides,
+                           desc.mTensorMode[1],
+                           desc.mTensorDesc[2].mLengths,
+                           desc.mTensorDesc[2].mStrides,
+                           desc.mTensorMode[2],
+                           desc.mTensorDesc[3].mLengths,
+                           desc.mTensorDesc[3].mStrides,
+                           desc.mTensorMode[2],
+                           nullptr))
+    {
+        return nullptr;
+    }
+
+    return args;
+}
+
+// A batch that shares B is a single contraction with the batch as an extra
+// M mode, and one that shares A with the batch as an extra N mode.
+// Returns nullptr if the batch cannot be folded or the solution does not
+// support the folded problem.
+inline std::shared_ptr<hiptensor::ContractionArgs>
+    makeFoldedBatchArgs(hiptensor::ContractionSolution const*   solution,
+                        hiptensorContractionDescriptor_t const& desc,
+                        uint32_t                                batchCount,
+                        std::array<int64_t, 4> const&           strides)
+{
+    // Exactly one of A and B carries the batch, and C shares the layout of D
+    auto hasC = desc.mTensorDesc[2].mType != hiptensor::NONE_TYPE;
+    if((strides[0] == 0) == (strides[1] == 0) || (hasC && strides[2] != strides[3]))
+    {
+        return nullptr;
+    }
+
+    // Modes of the batched operand that appear in D are its M (or N) modes
+    auto        operand = strides[1] == 0 ? 0 : 1;
+    auto const& dModes  = desc.mTensorMode[2];
+    auto        numDims = 0;
+    for(auto mode : desc.mTensorMode[operand])
+    {
+        numDims += std::find(dModes.begin(), dModes.end(), mode) != dModes.end();
+    }
+    if(numDims >= MaxNumDimsM)
+    {
+        return nullptr;
+    }
+
+    // Any mode id that is not in use
+    int32_t batchMode = 0;
+    for(auto const& modes : desc.mTensorMode)
+    {
+        for(auto mode : modes)
+        {
+            batchMode = std::max(batchMode, mode + 1);
+        }
+    }
+
+    auto folded = desc;
+    auto append = [batchCount](hiptensorTensorDescriptor_t& tensor, int64_t stride) {
+        tensor.mLengths.push_back(batchCount);
+        tensor.mStrides.push_back(stride);
+    };
+
+    append(folded.mTensorDesc[operand], strides[operand]);
+    folded.mTensorMode[operand].push_back(batchMode);
+    if(hasC)
+    {
+        append(folded.mTensorDesc[2], strides[2]);
+    }
+    append(folded.mTensorDesc[3], strides[3]);
+    for(auto i = 2u; i < folded.mTensorMode.size(); i++)
+    {
+        folded.mTensorMode[i].push_back(batchMode);
+    }
+
+    return makePlanArgs(solution, folded);
+}
+
+// The plan's args keep the folded args of their last batch, so that repeated
+// batches of the same shape do not re-validate the folded problem.
+inline std::shared_ptr<hiptensor::ContractionArgs>
+    foldedBatchArgs(hiptensor::ContractionSolution const*   solution,
+                    hiptensor::ContractionArgs const&       args,
+                    hiptensorContractionDescriptor_t const& desc,
+                    uint32_t                                batchCount,
+                    std::array<int64_t, 4> const&           strides)
+{
+    std::lock_guard<std::mutex> lock(args.mLaunchMutex);
+    if(args.mFoldedBatchCount != batchCount || args.mFoldedStrides != strides)
+    {
+        args.mFoldedArgs       = makeFoldedBatchArgs(solution, desc, batchCount, strides);
+        args.mFoldedBatchCount = batchCount;
+        args.mFoldedStrides    = strides;
+    }
+    return args.mFoldedArgs;
+}
+
 hiptensorStatus_t hiptensorInitContractionDescriptor(const hiptensorHandle_t*           handle,
                                                      hiptensorContractionDescriptor_t*  desc,
                                                      const hiptensorTensorDescriptor_t* descA,
@@ -88,9 +265,8 @@ hiptensorStatus_t hiptensorInitContractionDescriptor(const hiptensorHandle_t*
 
     // Log API access
     char msg[2048];
-    snprintf(
-        msg,
-        sizeof(msg),
+    logger->logAPITrace(
+        "hiptensorInitContractionDescriptor",
         "handle=0x%0*llX, desc=0x%llX, descA=0x%llX, modeA=0x%llX, alignmentRequirementA=0x%02X, "
         "descB=0x%llX, modeB=0x%llX, alignmentRequirementB=0x%02X, descC=0x%llX, modeC=0x%llX, "
         "alignmentRequirementC=0x%02X, descD=0x%llX, modeD=0x%llX, alignmentRequirementD=0x%02X, "
@@ -112,8 +288,6 @@ hiptensorStatus_t hiptensorInitContractionDescriptor(const hiptensorHandle_t*
         (unsigned int)alignmentRequirementD,
         (unsigned int)typeCompute);
 
-    logger->logAPITrace("hiptensorInitContractionDescriptor", msg);
-
     if(!handle || !desc || !descA || !descB || !descD)
     {
         auto errorCode = HIPTENSOR_STATUS_NOT_INITIALIZED;
@@ -225,15 +399,12 @@ hiptensorStatus_t hiptensorInitContractionFind(const hiptensorHandle_t*    handl
 
     // Log API access
     char msg[256];
-    snprintf(msg,
-             sizeof(msg),
-             "handle=0x%0*llX, find=0x%llX, algo=0x%02X",
-             2 * (int)sizeof(void*),
-             (unsigned long long)handle,
-             (unsigned long long)find,
-             (int)algo);
-
-    logger->logAPITrace("hiptensorInitContractionFind", msg);
+    logger->logAPITrace("hiptensorInitContractionFind",
+                        "handle=0x%0*llX, find=0x%llX, algo=0x%02X",
+                        2 * (int)sizeof(void*),
+                        (unsigned long long)handle,
+                        (unsigned long long)find,
+                        (int)algo);
 
     if(handle == nullptr || find == nullptr)
     {
@@ -257,16 +428,16 @@ hiptensorStatus_t hiptensorInitContractionFind(const hiptensorHandle_t*    handl
     }
 
     auto realHandle = hiptensor::Handle::toHandle((int64_t*)handle->fields);
+    auto backend    = realHandle->getBackend();
 
     // Ensure current HIP device is same as the handle.
-    hiptensor::HipDevice currentDevice;
-    if((int)currentDevice.getDeviceId() != realHandle->getDevice().getDeviceId())
+    if(backend == HIPTENSOR_BACKEND_DEVICE && !isHandleDeviceCurrent(realHandle))
     {
         auto errorCode = HIPTENSOR_STATUS_ARCH_MISMATCH;
         snprintf(msg,
                  sizeof(msg),
                  "Device mismatch error: current device id: %d, handle device id: %d (%s)",
-                 (int)currentDevice.getDeviceId(),
+                 (int)hiptensor::HipDevice::currentDeviceId(),
                  (int)realHandle->getDevice().getDeviceId(),
                  hiptensorGetErrorString(errorCode));
 
@@ -280,10 +451,11 @@ hiptensorStatus_t hiptensorInitContractionFind(const hiptensorHandle_t*    handl
         // Update the stored selection algorithm
         find->mSelectionAlgorithm = algo;
 
-        // For now, enumerate all known contraction kernels.
+        // For now, enumerate all known contraction kernels of the backend.
         // Using the hipDevice, determine if the device supports F64
-        auto& instances = hiptensor::ContractionSolutionInstances::instance();
-        auto  solnQ     = instances->allSolutions();
+        auto solnQ = backend == HIPTENSOR_BACKEND_HOST
+                         ? hiptensor::ContractionCpuReferenceInstances::instance()->allSolutions()
+                         : hiptensor::ContractionSolutionInstances::instance()->allSolutions();
 
         // Can do more checking for scale / bilinear, etc. if we need to.
 
@@ -324,16 +496,15 @@ hiptensorStatus_t hiptensorContractionGetWorkspaceSize(const hiptensorHandle_t*
 
     // Log API access
     char msg[512];
-    snprintf(msg,
-             sizeof(msg),
-             "handle=0x%0*llX, desc=0x%llX, find=0x%llX, pref=0x%02X, workspaceSize=0x%04lX",
-             2 * (int)sizeof(void*),
-             (unsigned long long)handle,
-             (unsigned long long)desc,
-             (unsigned long long)find,
-             (unsigned int)pref,
-             (unsigned long)*workspaceSize);
-    logger->logAPITrace("hiptensorContractionGetWorkspaceSize", msg);
+    logger->logAPITrace(
+        "hiptensorContractionGetWorkspaceSize",
+        "handle=0x%0*llX, desc=0x%llX, find=0x%llX, pref=0x%02X, workspaceSize=0x%04lX",
+        2 * (int)sizeof(void*),
+        (unsigned long long)handle,
+        (unsigned long long)desc,
+        (unsigned long long)find,
+        (unsigned int)pref,
+        (unsigned long)*workspaceSize);
 
     if(handle == nullptr || desc == nullptr || find == nullptr || workspaceSize == nullptr)
     {
@@ -372,10 +543,22 @@ hiptensorStatus_t hiptensorContractionGetWorkspaceSize(const hiptensorHandle_t*
 
     *workspaceSize = 0u;
 
+    // Kernels are dispatched on the coalesced problem, or on its splits
+    hiptensorContractionDescriptor_t dispatch;
+    hiptensor::ModeSplit             split;
+    if(hiptensor::makeDispatchProblem(*desc, dispatch, split) != HIPTENSOR_STATUS_SUCCESS)
+    {
+        // Reported by hiptensorInitContractionPlan
+        return HIPTENSOR_STATUS_SUCCESS;
+    }
+    desc = &dispatch;
+
     for(auto* candidate : find->mCandidates)
     {
-        auto* solution = (hiptensor::ContractionSolution*)candidate;
-        if(solution->initArgs(nullptr,
+        auto*                      solution = (hiptensor::ContractionSolution*)candidate;
+        hiptensor::ContractionArgs args;
+        if(solution->initArgs(args,
+                              nullptr,
                               nullptr,
                               nullptr,
                               nullptr,
@@ -397,17 +580,17 @@ hiptensorStatus_t hiptensorContractionGetWorkspaceSize(const hiptensorHandle_t*
         {
             if(*workspaceSize == 0)
             {
-                *workspaceSize = solution->workspaceSize();
+                *workspaceSize = args.mWorkspaceSize;
             }
             else
             {
                 if(pref == HIPTENSOR_WORKSPACE_MIN)
                 {
-                    *workspaceSize = std::min(*workspaceSize, solution->workspaceSize());
+                    *workspaceSize = std::min(*workspaceSize, args.mWorkspaceSize);
                 }
                 else
                 {
-                    *workspaceSize = std::max(*workspaceSize, solution->workspaceSize());
+                    *workspaceSize = std::max(*workspaceSize, args.mWorkspaceSize);
                 }
             }
         }
@@ -428,16 +611,15 @@ hiptensorStatus_t hiptensorInitContractionPlan(const hiptensorHandle_t*
     // Log API access
 
     char msg[256];
-    snprintf(msg,
-             sizeof(msg),
-             "handle=0x%0*llX, plan=0x%llX, desc=0x%llX, find=0x%llX, workspaceSize=0x%04lX",
-             2 * (int)sizeof(void*),
-             (unsigned long long)handle,
-             (unsigned long long)plan,
-             (unsigned long long)desc,
-             (unsigned long long)find,
-             (unsigned long)workspaceSize);
-    logger->logAPITrace("hiptensorInitContractionPlan", msg);
+    logger->logAPITrace(
+        "hiptensorInitContractionPlan",
+        "handle=0x%0*llX, plan=0x%llX, desc=0x%llX, find=0x%llX, workspaceSize=0x%04lX",
+        2 * (int)sizeof(void*),
+        (unsigned long long)handle,
+        (unsigned long long)plan,
+        (unsigned long long)desc,
+        (unsigned long long)find,
+        (unsigned long)workspaceSize);
 
     if(handle == nullptr || plan == nullptr || desc == nullptr || find == nullptr)
     {
@@ -474,23 +656,99 @@ hiptensorStatus_t hiptensorInitContractionPlan(const hiptensorHandle_t*
         return HIPTENSOR_STATUS_NOT_INITIALIZED;
     }
 
+    // Kernels are dispatched on the coalesced problem, or on its splits
+    hiptensorContractionDescriptor_t dispatch;
+    auto                             split = std::make_shared<hiptensor::ModeSplit>();
+    if(auto errorCode = hiptensor::makeDispatchProblem(*desc, dispatch, *split);
+       errorCode != HIPTENSOR_STATUS_SUCCESS)
+    {
+        snprintf(msg,
+                 sizeof(msg),
+                 "Unsupported Data Error : more than %d contracted modes (%s)",
+                 MaxNumDimsK,
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorInitContractionPlan", msg);
+        return errorCode;
+    }
+    desc = &dispatch;
+    if(split->mLengths.empty())
+    {
+        split = nullptr;
+    }
+
     auto realHandle = hiptensor::Handle::toHandle((int64_t*)handle->fields);
+    auto backend    = realHandle->getBackend();
 
     // Ensure current HIP device is same as the handle.
-    hiptensor::HipDevice currentDevice;
-    if((int)currentDevice.getDeviceId() != realHandle->getDevice().getDeviceId())
+    if(backend == HIPTENSOR_BACKEND_DEVICE && !isHandleDeviceCurrent(realHandle))
     {
         auto errorCode = HIPTENSOR_STATUS_ARCH_MISMATCH;
         snprintf(msg,
                  sizeof(msg),
                  "Device mismatch error: current device id: %d, handle device id: %d (%s)",
-                 (int)currentDevice.getDeviceId(),
+                 (int)hiptensor::HipDevice::currentDeviceId(),
                  (int)realHandle->getDevice().getDeviceId(),
                  hiptensorGetErrorString(errorCode));
         logger->logError("hiptensorInitContractionPlan", msg);
         return HIPTENSOR_STATUS_ARCH_MISMATCH;
     }
 
+    // Re-planning a known problem re-uses its previous winner
+    auto& planCache     = realHandle->getContractionPlanCache();
+    auto  planSignature = hiptensor::PlanCache::Signature{
+        *desc, (int32_t)find->mSelectionAlgorithm, workspaceSize, (int32_t)backend};
+    auto  planKey       = hiptensor::PlanCache::hash(planSignature);
+    if(void* cachedSolution = nullptr; planCache.lookup(planKey, planSignature, &cachedSolution))
+    {
+        if(auto args = makePlanArgs((hiptensor::ContractionSolution*)cachedSolution, *desc))
+        {
+            plan->mContractionDesc = *desc;
+            plan->mSolution        = cachedSolution;
+            plan->mArgs            = std::move(args);
+            plan->mSplit           = split;
+            plan->mBackend         = backend;
+
+            return HIPTENSOR_STATUS_SUCCESS;
+        }
+    }
+
+    // Host solutions are not timed: the first one able to solve the problem is used.
+    if(backend == HIPTENSOR_BACKEND_HOST)
+    {
+        auto& instances = hiptensor::ContractionCpuReferenceInstances::instance();
+        auto  solutionQ = instances->allSolutions()
+                             .query((hiptensor::ContractionOpId_t)desc->mContractionOpId)
+                             .query(desc->mTensorDesc[0].mType,
+                                    desc->mTensorDesc[1].mType,
+                                    desc->mTensorDesc[2].mType,
+                                    desc->mTensorDesc[3].mType,
+                                    desc->mComputeType);
+
+        for(auto* candidate : toContractionSolutionVec(solutionQ.solutions()))
+        {
+            auto args = makePlanArgs(candidate, *desc);
+            if(args != nullptr && args->mWorkspaceSize <= workspaceSize)
+            {
+                plan->mContractionDesc = *desc;
+                plan->mSolution        = candidate;
+                plan->mArgs            = std::move(args);
+                plan->mSplit           = split;
+                plan->mBackend         = backend;
+
+                planCache.insert(planKey, planSignature, candidate);
+                return HIPTENSOR_STATUS_SUCCESS;
+            }
+        }
+
+        auto errorCode = HIPTENSOR_STATUS_NOT_SUPPORTED;
+        snprintf(msg,
+                 sizeof(msg),
+                 "No host solution is able to solve the problem (%s)",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorInitContractionPlan", msg);
+        return errorCode;
+    }
+
     // At this point, we need to format inputs for kernels as they will be tested via selection model.
     // Brute force method currently uses CK kernel format, so we will adjust inputs to that style.
 
@@ -523,31 +781,106 @@ hiptensorStatus_t hiptensorInitContractionPlan(const hiptensorHandle_t*
     if(find->mSelectionAlgorithm == HIPTENSOR_ALGO_DEFAULT
        || find->mSelectionAlgorithm == HIPTENSOR_ALGO_DEFAULT_PATIENT)
     {
-        result = hiptensor::bruteForceModel(&winner,
-                                            candidates,
-                                            ADataType,
-                                            desc->mTensorDesc[0].mLengths,
-                                            desc->mTensorDesc[0].mStrides,
-                                            desc->mTensorMode[0],
-                                            BDataType,
-                                            desc->mTensorDesc[1].mLengths,
-                                            desc->mTensorDesc[1].mStrides,
-                                            desc->mTensorMode[1],
-                                            DDataType,
-                                            desc->mTensorDesc[2].mLengths,
-                                            desc->mTensorDesc[2].mStrides,
-                                            desc->mTensorMode[2],
-                                            EDataType,
-                                            desc->mTensorDesc[3].mLengths,
-                                            desc->mTensorDesc[3].mStrides,
-                                            desc->mTensorMode[2],
-                                            desc->mComputeType,
-                                            workspaceSize);
+        // Consult previous selections before timing all candidates
+        auto& cache    = hiptensor::ContractionSelectionCache::instance();
+        auto  cacheKey = hiptensor::ContractionSelectionCache::hashProblem(
+            desc->mContractionOpId,
+            ADataType,
+            BDataType,
+            DDataType,
+            EDataType,
+            computeType,
+            desc->mTensorDesc[0].mLengths,
+            desc->mTensorDesc[0].mStrides,
+            desc->mTensorMode[0],
+            desc->mTensorDesc[1].mLengths,
+            desc->mTensorDesc[1].mStrides,
+            desc->mTensorMode[1],
+            desc->mTensorDesc[2].mLengths,
+            desc->mTensorDesc[2].mStrides,
+            desc->mTensorMode[2],
+            desc->mTensorDesc[3].mLengths,
+            desc->mTensorDesc[3].mStrides,
+            desc->mTensorMode[2],
+            (uint32_t)realHandle->getDevice().getGcnArch());
+
+        hiptensor::ContractionSelectionCache::Uid cachedUid;
+        if(cache->lookup(cacheKey, &cachedUid))
+        {
+            auto const& solutions = solutionQ.solutions();
+            if(auto it = solutions.find(cachedUid); it != solutions.end())
+            {
+                auto*                      candidate = it->second;
+                hiptensor::ContractionArgs args;
+                if(candidate->initArgs(args,
+                                       nullptr,
+                                       nullptr,
+                                       nullptr,
+                                       nullptr,
+                                       nullptr,
+                                       nullptr,
+                                       desc->mTensorDesc[0].mLengths,
+                                       desc->mTensorDesc[0].mStrides,
+                                       desc->mTensorMode[0],
+                                       desc->mTensorDesc[1].mLengths,
+                                       desc->mTensorDesc[1].mStrides,
+                                       desc->mTensorMode[1],
+                                       desc->mTensorDesc[2].mLengths,
+                                       desc->mTensorDesc[2].mStrides,
+                                       desc->mTensorMode[2],
+                                       desc->mTensorDesc[3].mLengths,
+                                       desc->mTensorDesc[3].mStrides,
+                                       desc->mTensorMode[2],
+                                       nullptr)
+                   && args.mWorkspaceSize <= workspaceSize)
+                {
+                    winner = candidate;
+                    result = HIPTENSOR_STATUS_SUCCESS;
+                }
+            }
+
+            if(winner == nullptr)
+            {
+                // Stale entry, e.g. the kernel set has changed.
+                cache->erase(cacheKey);
+            }
+        }
+
+        if(winner == nullptr)
+        {
+            result = hiptensor::bruteForceModel(&winner,
+                                                candidates,
+                                                ADataType,
+                                                desc->mTensorDesc[0].mLengths,
+                                                desc->mTensorDesc[0].mStrides,
+                                                desc->mTensorMode[0],
+                                                BDataType,
+                                                desc->mTensorDesc[1].mLengths,
+                                                desc->mTensorDesc[1].mStrides,
+                                                desc->mTensorMode[1],
+                                                DDataType,
+                                                desc->mTensorDesc[2].mLengths,
+                                                desc->mTensorDesc[2].mStrides,
+                                                desc->mTensorMode[2],
+                                                EDataType,
+                                                desc->mTensorDesc[3].mLengths,
+                                                desc->mTensorDesc[3].mStrides,
+                                                desc->mTensorMode[2],
+                                                desc->mComputeType,
+                                                workspaceSize,
+                                                realHandle->getAllocator());
+
+            if(result == HIPTENSOR_STATUS_SUCCESS)
+            {
+                cache->insert(cacheKey, winner->uid());
+            }
+        }
     }
     else if(find->mSelectionAlgorithm == HIPTENSOR_ALGO_ACTOR_CRITIC)
     {
         result = hiptensor::actorCriticModel(&winner,
                                              solutionQ.solutions(),
+                                             desc->mContractionOpId,
                                              ADataType,
                                              desc->mTensorDesc[0].mLengths,
                                              desc->mTensorDesc[0].mStrides,
@@ -565,7 +898,37 @@ hiptensorStatus_t hiptensorInitContractionPlan(const hiptensorHandle_t*
                                              desc->mTensorDesc[3].mStrides,
                                              desc->mTensorMode[2],
                                              desc->mComputeType,
-                                             workspaceSize);
+                                             workspaceSize,
+                                             (uint32_t)realHandle->getDevice().getGcnArch());
+
+        // Problems the selection model does not resolve are timed
+        if(result != HIPTENSOR_STATUS_SUCCESS)
+        {
+            logger->logHeuristics("hiptensorInitContractionPlan",
+                                  "Selection model miss, timing all candidates");
+
+            result = hiptensor::bruteForceModel(&winner,
+                                                candidates,
+                                                ADataType,
+                                                desc->mTensorDesc[0].mLengths,
+                                                desc->mTensorDesc[0].mStrides,
+                                                desc->mTensorMode[0],
+                                                BDataType,
+                                                desc->mTensorDesc[1].mLengths,
+                                                desc->mTensorDesc[1].mStrides,
+                                                desc->mTensorMode[1],
+                                                DDataType,
+                                                desc->mTensorDesc[2].mLengths,
+                                                desc->mTensorDesc[2].mStrides,
+                                                desc->mTensorMode[2],
+                                                EDataType,
+                                                desc->mTensorDesc[3].mLengths,
+                                                desc->mTensorDesc[3].mStrides,
+                                                desc->mTensorMode[2],
+                                                desc->mComputeType,
+                                                workspaceSize,
+                                                realHandle->getAllocator());
+        }
     }
 
     CHECK_HIP_ERROR(hipEventRecord(stopEvent));
@@ -594,9 +957,26 @@ hiptensorStatus_t hiptensorInitContractionPlan(const hiptensorHandle_t*
              elapsedTimeMs);
     logger->logPerformanceTrace("hiptensorInitContractionPlan", msg);
 
+    auto args = makePlanArgs(winner, *desc);
+    if(args == nullptr)
+    {
+        auto errorCode = HIPTENSOR_STATUS_INTERNAL_ERROR;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Selected kernel is unable to solve the problem (%s)",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorInitContractionPlan", msg);
+        return errorCode;
+    }
+
     // Assign the contraction descriptor
     plan->mContractionDesc = *desc;
     plan->mSolution        = winner;
+    plan->mArgs            = std::move(args);
+    plan->mSplit           = split;
+    plan->mBackend         = backend;
+
+    planCache.insert(planKey, planSignature, winner);
 
     return HIPTENSOR_STATUS_SUCCESS;
 }
@@ -618,12 +998,14 @@ hiptensorStatus_t hiptensorContraction(const hiptensorHandle_t*          handle,
 
     // Log API access
     char msg[512];
-    char alphaMsg[32];
-    char betaMsg[32];
 
-    if(plan != nullptr)
+    // Scalar formatting allocates, so skip it unless the trace is logged
+    if(logger->isLogged(HIPTENSOR_LOG_LEVEL_API_TRACE))
     {
-        if(alpha == nullptr)
+        char alphaMsg[32];
+        char betaMsg[32];
+
+        if(plan == nullptr || alpha == nullptr)
         {
             snprintf(alphaMsg, sizeof(alphaMsg), "alpha=NULL");
         }
@@ -634,7 +1016,7 @@ hiptensorStatus_t hiptensorContraction(const hiptensorHandle_t*          handle,
             snprintf(alphaMsg, sizeof(alphaMsg), "alpha=%s", std::to_string(alphaValue).c_str());
         }
 
-        if(beta == nullptr)
+        if(plan == nullptr || beta == nullptr)
         {
             snprintf(betaMsg, sizeof(betaMsg), "beta=NULL");
         }
@@ -644,31 +1026,24 @@ hiptensorStatus_t hiptensorContraction(const hiptensorHandle_t*          handle,
                 beta, plan->mContractionDesc.mComputeType);
             snprintf(betaMsg, sizeof(betaMsg), "beta=%s", std::to_string(betaValue).c_str());
         }
-    }
-    else
-    {
-        snprintf(alphaMsg, sizeof(alphaMsg), "alpha=NULL");
-        snprintf(betaMsg, sizeof(betaMsg), "beta=NULL");
-    }
 
-    snprintf(msg,
-             sizeof(msg),
-             "handle=0x%0*llX, plan=0x%llX, %s, A=0x%llX, B=0x%llX, %s, "
-             "C=0x%llX, D=0x%llX, workspace=0x%llX, workspaceSize=0x%04lX, stream=0x%llX",
-             2 * (int)sizeof(void*),
-             (unsigned long long)handle,
-             (unsigned long long)plan,
-             alphaMsg,
-             (unsigned long long)A,
-             (unsigned long long)B,
-             betaMsg,
-             (unsigned long long)C,
-             (unsigned long long)D,
-             (unsigned long long)workspace,
-             (unsigned long)workspaceSize,
-             (unsigned long long)stream);
-
-    logger->logAPITrace("hiptensorContraction", msg);
+        logger->logAPITrace(
+            "hiptensorContraction",
+            "handle=0x%0*llX, plan=0x%llX, %s, A=0x%llX, B=0x%llX, %s, "
+            "C=0x%llX, D=0x%llX, workspace=0x%llX, workspaceSize=0x%04lX, stream=0x%llX",
+            2 * (int)sizeof(void*),
+            (unsigned long long)handle,
+            (unsigned long long)plan,
+            alphaMsg,
+            (unsigned long long)A,
+            (unsigned long long)B,
+            betaMsg,
+            (unsigned long long)C,
+            (unsigned long long)D,
+            (unsigned long long)workspace,
+            (unsigned long)workspaceSize,
+            (unsigned long long)stream);
+    }
 
     if(handle == nullptr || plan == nullptr)
     {
@@ -712,75 +1087,101 @@ hiptensorStatus_t hiptensorContraction(const hiptensorHandle_t*          handle,
         return errorCode;
     }
 
-    if(plan->mSolution == nullptr)
+    if(plan->mSolution == nullptr || plan->mArgs == nullptr)
     {
         auto errorCode = HIPTENSOR_STATUS_INTERNAL_ERROR;
         snprintf(msg,
                  sizeof(msg),
-                 "Internal Error : solution = nullptr (%s)",
+                 "Internal Error : %s = nullptr (%s)",
+                 plan->mSolution == nullptr ? "solution" : "args",
                  hiptensorGetErrorString(errorCode));
         logger->logError("hiptensorContraction", msg);
         return errorCode;
     }
 
     auto realHandle = hiptensor::Handle::toHandle((int64_t*)handle->fields);
+    auto backend    = realHandle->getBackend();
+
+    if(plan->mBackend != backend)
+    {
+        auto errorCode = HIPTENSOR_STATUS_INVALID_VALUE;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Backend mismatch error: plan backend: %d, handle backend: %d (%s)",
+                 (int)plan->mBackend,
+                 (int)backend,
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorContraction", msg);
+        return errorCode;
+    }
 
     // Ensure current HIP device is same as the handle.
-    hiptensor::HipDevice currentDevice;
-    if((int)currentDevice.getDeviceId() != realHandle->getDevice().getDeviceId())
+    if(backend == HIPTENSOR_BACKEND_DEVICE && !isHandleDeviceCurrent(realHandle))
     {
         auto errorCode = HIPTENSOR_STATUS_ARCH_MISMATCH;
         snprintf(msg,
                  sizeof(msg),
                  "Device mismatch error: current device id: %d, handle device id: %d (%s)",
-                 (int)currentDevice.getDeviceId(),
+                 (int)hiptensor::HipDevice::currentDeviceId(),
                  (int)realHandle->getDevice().getDeviceId(),
                  hiptensorGetErrorString(errorCode));
         logger->logError("hiptensorContraction", msg);
         return errorCode;
     }
 
+    // The plan holds the normalized and validated arguments: only the data
+    // pointers and scalars are patched in, and only when they have changed.
     auto*             cSolution = (hiptensor::ContractionSolution*)(plan->mSolution);
+    auto const&       args      = *(hiptensor::ContractionArgs const*)(plan->mArgs.get());
     hiptensorStatus_t errorCode = HIPTENSOR_STATUS_SUCCESS;
     float             time      = 0.0f;
 
+    auto& perfStats   = hiptensor::PerfStats::instance();
+    auto  splits      = splitCount(*plan);
+    auto  statsSample = [cSolution, &args, splits]() {
+        int32_t m, n, k;
+        std::tie(m, n, k) = args.problemDims();
+
+        char problem[64];
+        snprintf(problem, sizeof(problem), "m=%d,n=%d,k=%d", m, n, k);
+        return hiptensor::PerfStats::Sample{"hiptensorContraction",
+                                            cSolution->uid(),
+                                            cSolution->kernelName(),
+                                            problem,
+                                            2.0 * m * n * k * splits,
+                                            static_cast<double>(args.mBytes * splits)};
+    };
+
     // Perform contraction with timing if LOG_LEVEL_PERF_TRACE
     if(logger->getLogMask() & HIPTENSOR_LOG_LEVEL_PERF_TRACE)
     {
-        std::tie(errorCode, time) = (*cSolution)(alpha,
-                                                 A,
-                                                 B,
-                                                 beta,
-                                                 C,
-                                                 D,
-                                                 plan->mContractionDesc.mTensorDesc[0].mLengths,
-                                                 plan->mContractionDesc.mTensorDesc[0].mStrides,
-                                                 plan->mContractionDesc.mTensorMode[0],
-                                                 plan->mContractionDesc.mTensorDesc[1].mLengths,
-                                                 plan->mContractionDesc.mTensorDesc[1].mStrides,
-                                                 plan->mContractionDesc.mTensorMode[1],
-                                                 plan->mContractionDesc.mTensorDesc[2].mLengths,
-                                                 plan->mContractionDesc.mTensorDesc[2].mStrides,
-                                                 plan->mContractionDesc.mTensorMode[2],
-                                                 plan->mContractionDesc.mTensorDesc[3].mLengths,
-                                                 plan->mContractionDesc.mTensorDesc[3].mStrides,
-                                                 plan->mContractionDesc.mTensorMode[2],
-                                                 workspace,
-                                                 workspaceSize,
-                                                 StreamConfig{
-                                                     stream, // stream id
-                                                     true, // time_kernel
-                                                     0, // log_level
-                                                     0, // cold_niters
-                                                     1, // nrepeat
-                                                 });
+        auto start  = std::chrono::steady_clock::now();
+        auto config = StreamConfig{
+            stream, // stream id
+            true, // time_kernel
+            0, // log_level
+            0, // cold_niters
+            1, // nrepeat
+        };
+        std::tie(errorCode, time) = forEachSplit(
+            *plan, A, B, C, D, [&](auto const* a, auto const* b, auto const* c, auto* d) {
+                return (*cSolution)(
+                    args, alpha, a, b, beta, c, d, workspace, workspaceSize, config);
+            });
+
+        // Host solutions run synchronously and are not timed by the invoker
+        if(backend == HIPTENSOR_BACKEND_HOST)
+        {
+            auto elapsed = std::chrono::steady_clock::now() - start;
+            time         = std::chrono::duration<float, std::milli>(elapsed).count();
+        }
 
         if(errorCode == HIPTENSOR_STATUS_SUCCESS)
         {
             int32_t m, n, k;
-            std::tie(m, n, k) = cSolution->problemDims();
-            auto flops        = std::size_t(2) * m * n * k;
-            auto bytes        = cSolution->problemBytes();
+            std::tie(m, n, k) = args.problemDims();
+            auto flops        = std::size_t(2) * m * n * k * splits;
+            auto bytes        = args.mBytes * splits;
 
             hiptensor::PerfMetrics metrics = {
                 cSolution->uid(), // id
@@ -800,31 +1201,27 @@ hiptensorStatus_t hiptensorContraction(const hiptensorHandle_t*          handle,
                      metrics.mTflops,
                      metrics.mBandwidth);
             logger->logPerformanceTrace("hiptensorContraction", msg);
+
+            perfStats->record(statsSample(), time);
         }
     }
-    else // Perform contraction without timing
-    {
-        std::tie(errorCode, time) = (*cSolution)(alpha,
-                                                 A,
-                                                 B,
-                                                 beta,
-                                                 C,
-                                                 D,
-                                                 plan->mContractionDesc.mTensorDesc[0].mLengths,
-                                                 plan->mContractionDesc.mTensorDesc[0].mStrides,
-                                                 plan->mContractionDesc.mTensorMode[0],
-                                                 plan->mContractionDesc.mTensorDesc[1].mLengths,
-                                                 plan->mContractionDesc.mTensorDesc[1].mStrides,
-                                                 plan->mContractionDesc.mTensorMode[1],
-                                                 plan->mContractionDesc.mTensorDesc[2].mLengths,
-                                                 plan->mContractionDesc.mTensorDesc[2].mStrides,
-                                                 plan->mContractionDesc.mTensorMode[2],
-                                                 plan->mContractionDesc.mTensorDesc[3].mLengths,
-                                                 plan->mContractionDesc.mTensorDesc[3].mStrides,
-                                                 plan->mContractionDesc.mTensorMode[2],
-                                                 workspace,
-                                                 workspaceSize,
-                                                 StreamConfig{stream, false});
+    else // Perform contraction without synchronous timing
+    {
+        auto timer  = perfStats->startTimer(stream, backend == HIPTENSOR_BACKEND_HOST);
+        auto config = StreamConfig{stream, false};
+        std::tie(errorCode, time) = forEachSplit(
+            *plan, A, B, C, D, [&](auto const* a, auto const* b, auto const* c, auto* d) {
+                return (*cSolution)(
+                    args, alpha, a, b, beta, c, d, workspace, workspaceSize, config);
+            });
+        if(timer.mActive && errorCode == HIPTENSOR_STATUS_SUCCESS)
+        {
+            perfStats->stopTimer(timer, stream, statsSample());
+        }
+        else
+        {
+            perfStats->cancelTimer(timer);
+        }
     }
 
     if(errorCode == HIPTENSOR_STATUS_INSUFFICIENT_WORKSPACE)
@@ -832,7 +1229,7 @@ hiptensorStatus_t hiptensorContraction(const hiptensorHandle_t*          handle,
         snprintf(msg,
                  sizeof(msg),
                  "Insufficient workspace: req: %lu alloc: %lu (%s)",
-                 cSolution->workspaceSize(),
+                 args.mWorkspaceSize,
                  workspaceSize,
                  hiptensorGetErrorString(errorCode));
         logger->logError("hiptensorContraction", msg);
@@ -848,3 +1245,617 @@ hiptensorStatus_t hiptensorContraction(const hiptensorHandle_t*          handle,
 
     return errorCode;
 }
+
+hiptensorStatus_t hiptensorContractionStridedBatched(const hiptensorHandle_t*          handle,
+                                                     const hiptensorContractionPlan_t* plan,
+                                                     const void*                       alpha,
+                                                     const void*                       A,
+                                                     const void*                       B,
+                                                     const void*                       beta,
+                                                     const void*                       C,
+                                                     void*                             D,
+                                                     uint32_t                          batchCount,
+                                                     int64_t                           strideA,
+                                                     int64_t                           strideB,
+                                                     int64_t                           strideC,
+                                                     int64_t                           strideD,
+                                                     void*                             workspace,
+                                                     uint64_t workspaceSize,
+                                                     hipStream_t                       stream)
+{
+    using hiptensor::Logger;
+    auto& logger = Logger::instance();
+
+    // Log API access
+    char msg[512];
+    logger->logAPITrace("hiptensorContractionStridedBatched",
+                        "handle=0x%0*llX, plan=0x%llX, A=0x%llX, B=0x%llX, C=0x%llX, D=0x%llX, "
+                        "batchCount=%u, strideA=%lld, strideB=%lld, strideC=%lld, strideD=%lld, "
+                        "workspace=0x%llX, workspaceSize=0x%04lX, stream=0x%llX",
+                        2 * (int)sizeof(void*),
+                        (unsigned long long)handle,
+                        (unsigned long long)plan,
+                        (unsigned long long)A,
+                        (unsigned long long)B,
+                        (unsigned long long)C,
+                        (unsigned long long)D,
+                        batchCount,
+                        (long long)strideA,
+                        (long long)strideB,
+                        (long long)strideC,
+                        (long long)strideD,
+                        (unsigned long long)workspace,
+                        (unsigned long)workspaceSize,
+                        (unsigned long long)stream);
+
+    if(handle == nullptr || plan == nullptr)
+    {
+        auto errorCode = HIPTENSOR_STATUS_NOT_INITIALIZED;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Initialization Error : %s = nullptr (%s)",
+                 handle == nullptr ? "handle" : "plan",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorContractionStridedBatched", msg);
+        return errorCode;
+    }
+
+    if(alpha == nullptr || A == nullptr || B == nullptr || D == nullptr)
+    {
+        auto errorCode = HIPTENSOR_STATUS_INVALID_VALUE;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Input Parameter Error : %s = nullptr (%s)",
+                 alpha == nullptr ? "alpha" : "A/B/D",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorContractionStridedBatched", msg);
+        return errorCode;
+    }
+
+    // Items must not write to the same output
+    if(batchCount == 0 || strideA < 0 || strideB < 0 || strideC < 0 || strideD < 0
+       || (batchCount > 1 && strideD == 0))
+    {
+        auto errorCode = HIPTENSOR_STATUS_INVALID_VALUE;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Input Parameter Error : invalid batch count or strides (%s)",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorContractionStridedBatched", msg);
+        return errorCode;
+    }
+
+    if(plan->mSolution == nullptr || plan->mArgs == nullptr)
+    {
+        auto errorCode = HIPTENSOR_STATUS_INTERNAL_ERROR;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Internal Error : %s = nullptr (%s)",
+                 plan->mSolution == nullptr ? "solution" : "args",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorContractionStridedBatched", msg);
+        return errorCode;
+    }
+
+    auto realHandle = hiptensor::Handle::toHandle((int64_t*)handle->fields);
+    auto backend    = realHandle->getBackend();
+
+    if(plan->mBackend != backend)
+    {
+        auto errorCode = HIPTENSOR_STATUS_INVALID_VALUE;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Backend mismatch error: plan backend: %d, handle backend: %d (%s)",
+                 (int)plan->mBackend,
+                 (int)backend,
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorContractionStridedBatched", msg);
+        return errorCode;
+    }
+
+    // Ensure current HIP device is same as the handle.
+    if(backend == HIPTENSOR_BACKEND_DEVICE && !isHandleDeviceCurrent(realHandle))
+    {
+        auto errorCode = HIPTENSOR_STATUS_ARCH_MISMATCH;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Device mismatch error: current device id: %d, handle device id: %d (%s)",
+                 (int)hiptensor::HipDevice::currentDeviceId(),
+                 (int)realHandle->getDevice().getDeviceId(),
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorContractionStridedBatched", msg);
+        return errorCode;
+    }
+
+    auto*       cSolution = (hiptensor::ContractionSolution*)(plan->mSolution);
+    auto const& args      = *(hiptensor::ContractionArgs const*)(plan->mArgs.get());
+    auto const& desc      = plan->mContractionDesc;
+
+    hiptensorStatus_t errorCode = HIPTENSOR_STATUS_SUCCESS;
+    float             time      = 0.0f;
+    bool              folded    = false;
+
+    auto& perfStats   = hiptensor::PerfStats::instance();
+    auto  splits      = splitCount(*plan);
+    auto  statsSample = [cSolution, &args, splits, batchCount]() {
+        int32_t m, n, k;
+        std::tie(m, n, k) = args.problemDims();
+
+        char problem[80];
+        snprintf(problem, sizeof(problem), "m=%d,n=%d,k=%d,batch=%u", m, n, k, batchCount);
+        return hiptensor::PerfStats::Sample{
+            "hiptensorContractionStridedBatched",
+            cSolution->uid(),
+            cSolution->kernelName(),
+            problem,
+            2.0 * m * n * k * batchCount * splits,
+            static_cast<double>(args.mBytes) * batchCount * splits};
+    };
+
+    auto timeKernel   = (logger->getLogMask() & HIPTENSOR_LOG_LEVEL_PERF_TRACE) != 0;
+    auto streamConfig = StreamConfig{
+        stream, // stream id
+        timeKernel, // time_kernel
+        0, // log_level
+        0, // cold_niters
+        1, // nrepeat
+    };
+    // Untimed launches are measured by the stats without synchronizing
+    auto timer = timeKernel ? hiptensor::PerfStats::Timer{}
+                            : perfStats->startTimer(stream, backend == HIPTENSOR_BACKEND_HOST);
+    auto start = std::chrono::steady_clock::now();
+
+    // Single launch of the folded problem if its workspace fits
+    std::array<int64_t, 4> strides = {strideA, strideB, strideC, strideD};
+    if(batchCount > 1)
+    {
+        auto foldedArgs = foldedBatchArgs(cSolution, args, desc, batchCount, strides);
+        if(foldedArgs != nullptr && foldedArgs->mWorkspaceSize <= workspaceSize)
+        {
+            std::tie(errorCode, time) = forEachSplit(
+                *plan, A, B, C, D, [&](auto const* a, auto const* b, auto const* c, auto* d) {
+                    return (*cSolution)(*foldedArgs,
+                                        alpha,
+                                        a,
+                                        b,
+                                        beta,
+                                        c,
+                                        d,
+                                        workspace,
+                                        workspaceSize,
+                                        streamConfig);
+                });
+            folded = true;
+        }
+    }
+
+    if(!folded && batchCount == 1)
+    {
+        // Re-uses the plan's cached kernel argument
+        std::tie(errorCode, time) = forEachSplit(
+            *plan, A, B, C, D, [&](auto const* a, auto const* b, auto const* c, auto* d) {
+                return (*cSolution)(
+                    args, alpha, a, b, beta, c, d, workspace, workspaceSize, streamConfig);
+            });
+    }
+    else if(!folded)
+    {
+        // Batch strides of the solution are in bytes
+        for(int i = 0; i < 4; i++)
+        {
+            strides[i] *= hiptensor::hipDataTypeSize(desc.mTensorDesc[i].mType);
+        }
+        std::tie(errorCode, time) = forEachSplit(
+            *plan, A, B, C, D, [&](auto const* a, auto const* b, auto const* c, auto* d) {
+                return cSolution->runStridedBatched(args,
+                                                    batchCount,
+                                                    strides,
+                                                    alpha,
+                                                    a,
+                                                    b,
+                                                    beta,
+                                                    c,
+                                                    d,
+                                                    workspace,
+                                                    workspaceSize,
+                                                    streamConfig);
+            });
+    }
+
+    if(errorCode == HIPTENSOR_STATUS_SUCCESS && timeKernel)
+    {
+        // Host solutions run synchronously and are not timed by the invoker
+        if(backend == HIPTENSOR_BACKEND_HOST)
+        {
+            auto elapsed = std::chrono::steady_clock::now() - start;
+            time         = std::chrono::duration<float, std::milli>(elapsed).count();
+        }
+
+        int32_t m, n, k;
+        std::tie(m, n, k) = args.problemDims();
+        auto flops        = std::size_t(2) * m * n * k * batchCount * splits;
+        auto bytes        = std::size_t(args.mBytes) * batchCount * splits;
+
+        snprintf(msg,
+                 sizeof(msg),
+                 "KernelId: %lu KernelName: %s, BatchCount: %u, Folded: %d, %0.3f ms, %0.3f "
+                 "TFlops, %0.3f GB/s",
+                 cSolution->uid(),
+                 cSolution->kernelName().c_str(),
+                 batchCount,
+                 (int)folded,
+                 time,
+                 static_cast<float>(flops) / static_cast<float>(1.E9) / time,
+                 static_cast<float>(bytes) / static_cast<float>(1.E6) / time);
+        logger->logPerformanceTrace("hiptensorContractionStridedBatched", msg);
+
+        perfStats->record(statsSample(), time);
+    }
+    else if(timer.mActive && errorCode == HIPTENSOR_STATUS_SUCCESS)
+    {
+        perfStats->stopTimer(timer, stream, statsSample());
+    }
+    else
+    {
+        perfStats->cancelTimer(timer);
+    }
+
+    if(errorCode == HIPTENSOR_STATUS_INSUFFICIENT_WORKSPACE)
+    {
+        snprintf(msg,
+                 sizeof(msg),
+                 "Insufficient workspace: req: %lu alloc: %lu (%s)",
+                 args.mWorkspaceSize,
+                 workspaceSize,
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorContractionStridedBatched", msg);
+    }
+    else if(errorCode == HIPTENSOR_STATUS_INTERNAL_ERROR)
+    {
+        snprintf(msg,
+                 sizeof(msg),
+                 "Selected kernel is unable to solve the problem (%s)",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorContractionStridedBatched", msg);
+    }
+
+    return errorCode;
+}
+
+hiptensorStatus_t hiptensorContractionGrouped(const hiptensorHandle_t*                handle,
+                                              const hiptensorContractionGroupEntry_t* entries,
+                                              uint32_t                                numEntries,
+                                              void*                                   workspace,
+                                              uint64_t                                workspaceSize,
+                                              hipStream_t                             stream)
+{
+    using hiptensor::Logger;
+    auto& logger = Logger::instance();
+
+    // Log API access
+    char msg[512];
+    logger->logAPITrace("hiptensorContractionGrouped",
+                        "handle=0x%0*llX, entries=0x%llX, numEntries=%u, workspace=0x%llX, "
+                        "workspaceSize=0x%04lX, stream=0x%llX",
+                        2 * (int)sizeof(void*),
+                        (unsigned long long)handle,
+                        (unsigned long long)entries,
+                        numEntries,
+                        (unsigned long long)workspace,
+                        (unsigned long)workspaceSize,
+                        (unsigned long long)stream);
+
+    if(handle == nullptr)
+    {
+        auto errorCode = HIPTENSOR_STATUS_NOT_INITIALIZED;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Initialization Error : handle = nullptr (%s)",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorContractionGrouped", msg);
+        return errorCode;
+    }
+
+    if(entries == nullptr && numEntries > 0)
+    {
+        auto errorCode = HIPTENSOR_STATUS_INVALID_VALUE;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Input Parameter Error : entries = nullptr (%s)",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorContractionGrouped", msg);
+        return errorCode;
+    }
+
+    auto realHandle = hiptensor::Handle::toHandle((int64_t*)handle->fields);
+    auto backend    = realHandle->getBackend();
+
+    // Ensure current HIP device is same as the handle.
+    if(backend == HIPTENSOR_BACKEND_DEVICE && !isHandleDeviceCurrent(realHandle))
+    {
+        auto errorCode = HIPTENSOR_STATUS_ARCH_MISMATCH;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Device mismatch error: current device id: %d, handle device id: %d (%s)",
+                 (int)hiptensor::HipDevice::currentDeviceId(),
+                 (int)realHandle->getDevice().getDeviceId(),
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorContractionGrouped", msg);
+        return errorCode;
+    }
+
+    // Validate every entry before anything is launched
+    auto requiredWorkspace = [](hiptensorContractionGroupEntry_t const& entry) {
+        return ((hiptensor::ContractionArgs const*)entry.mPlan->mArgs.get())->mWorkspaceSize;
+    };
+
+    for(uint32_t i = 0; i < numEntries; i++)
+    {
+        auto const& entry     = entries[i];
+        auto        errorCode = HIPTENSOR_STATUS_SUCCESS;
+
+        if(entry.mPlan == nullptr)
+        {
+            errorCode = HIPTENSOR_STATUS_NOT_INITIALIZED;
+            snprintf(msg,
+                     sizeof(msg),
+                     "Initialization Error : entry %u: plan = nullptr (%s)",
+                     i,
+                     hiptensorGetErrorString(errorCode));
+        }
+        else if(entry.mAlpha == nullptr || entry.mA == nullptr || entry.mB == nullptr
+                || entry.mD == nullptr)
+        {
+            errorCode = HIPTENSOR_STATUS_INVALID_VALUE;
+            snprintf(msg,
+                     sizeof(msg),
+                     "Input Parameter Error : entry %u: %s = nullptr (%s)",
+                     i,
+                     entry.mAlpha == nullptr ? "alpha" : "A/B/D",
+                     hiptensorGetErrorString(errorCode));
+        }
+        else if(entry.mPlan->mSolution == nullptr || entry.mPlan->mArgs == nullptr)
+        {
+            errorCode = HIPTENSOR_STATUS_INTERNAL_ERROR;
+            snprintf(msg,
+                     sizeof(msg),
+                     "Internal Error : entry %u: %s = nullptr (%s)",
+                     i,
+                     entry.mPlan->mSolution == nullptr ? "solution" : "args",
+                     hiptensorGetErrorString(errorCode));
+        }
+        else if(entry.mPlan->mBackend != backend)
+        {
+            errorCode = HIPTENSOR_STATUS_INVALID_VALUE;
+            snprintf(msg,
+                     sizeof(msg),
+                     "Backend mismatch error: entry %u: plan backend: %d, handle backend: %d (%s)",
+                     i,
+                     (int)entry.mPlan->mBackend,
+                     (int)backend,
+                     hiptensorGetErrorString(errorCode));
+        }
+        else if(requiredWorkspace(entry) > workspaceSize)
+        {
+            errorCode = HIPTENSOR_STATUS_INSUFFICIENT_WORKSPACE;
+            snprintf(msg,
+                     sizeof(msg),
+                     "Insufficient workspace: entry %u: req: %lu alloc: %lu (%s)",
+                     i,
+                     requiredWorkspace(entry),
+                     workspaceSize,
+                     hiptensorGetErrorString(errorCode));
+        }
+
+        if(errorCode != HIPTENSOR_STATUS_SUCCESS)
+        {
+            logger->logError("hiptensorContractionGrouped", msg);
+            return errorCode;
+        }
+    }
+
+    auto& perfStats = hiptensor::PerfStats::instance();
+
+    auto timeKernel   = (logger->getLogMask() & HIPTENSOR_LOG_LEVEL_PERF_TRACE) != 0;
+    auto streamConfig = StreamConfig{
+        stream, // stream id
+        timeKernel, // time_kernel
+        0, // log_level
+        0, // cold_niters
+        1, // nrepeat
+    };
+
+    // Entries run in submission order, since a later entry may read the output of an
+    // earlier one. Each run of consecutive entries sharing a solution is timed and
+    // reported as one group.
+    for(uint32_t first = 0; first < numEntries;)
+    {
+        auto* solution = (hiptensor::ContractionSolution*)entries[first].mPlan->mSolution;
+        auto  last     = first + 1;
+        while(last < numEntries && entries[last].mPlan->mSolution == solution)
+        {
+            last++;
+        }
+
+        auto groupTime = 0.0f;
+        auto flops     = std::size_t(0);
+        auto bytes     = std::size_t(0);
+        auto timer     = timeKernel
+                             ? hiptensor::PerfStats::Timer{}
+                             : perfStats->startTimer(stream, backend == HIPTENSOR_BACKEND_HOST);
+        auto start     = std::chrono::steady_clock::now();
+
+        for(auto i = first; i < last; i++)
+        {
+            auto const& entry = entries[i];
+            auto const& args  = *(hiptensor::ContractionArgs const*)(entry.mPlan->mArgs.get());
+
+            // Plans re-use their kernel argument while the pointers and scalars match
+            auto [errorCode, time] = forEachSplit(
+                *entry.mPlan,
+                entry.mA,
+                entry.mB,
+                entry.mC,
+                entry.mD,
+                [&](auto const* a, auto const* b, auto const* c, auto* d) {
+                    return (*solution)(args,
+                                       entry.mAlpha,
+                                       a,
+                                       b,
+                                       entry.mBeta,
+                                       c,
+                                       d,
+                                       workspace,
+                                       workspaceSize,
+                                       streamConfig);
+                });
+            if(errorCode != HIPTENSOR_STATUS_SUCCESS)
+            {
+                perfStats->cancelTimer(timer);
+                snprintf(msg,
+                         sizeof(msg),
+                         "Entry %u: selected kernel is unable to solve the problem (%s)",
+                         i,
+                         hiptensorGetErrorString(errorCode));
+                logger->logError("hiptensorContractionGrouped", msg);
+                return errorCode;
+            }
+
+            int32_t m, n, k;
+            std::tie(m, n, k) = args.problemDims();
+            flops += std::size_t(2) * m * n * k * splitCount(*entry.mPlan);
+            bytes += args.mBytes * splitCount(*entry.mPlan);
+            groupTime += time;
+        }
+
+        char problem[32];
+        snprintf(problem, sizeof(problem), "problems=%u", last - first);
+        auto statsSample = hiptensor::PerfStats::Sample{"hiptensorContractionGrouped",
+                                                        solution->uid(),
+                                                        solution->kernelName(),
+                                                        problem,
+                                                        static_cast<double>(flops),
+                                                        static_cast<double>(bytes)};
+
+        if(timeKernel)
+        {
+            // Host solutions run synchronously and are not timed by the invoker
+            if(backend == HIPTENSOR_BACKEND_HOST)
+            {
+                auto elapsed = std::chrono::steady_clock::now() - start;
+                groupTime    = std::chrono::duration<float, std::milli>(elapsed).count();
+            }
+
+            hiptensor::PerfMetrics metrics = {
+                solution->uid(), // id
+                solution->kernelName(), // name
+                groupTime, // total time of the group
+                static_cast<float>(flops) / static_cast<float>(1.E9) / groupTime, // tflops
+                static_cast<float>(bytes) / static_cast<float>(1.E6) / groupTime // BW
+            };
+
+            snprintf(msg,
+                     sizeof(msg),
+                     "KernelId: %lu KernelName: %s, Problems: %u, %0.3f ms, %0.3f TFlops, "
+                     "%0.3f GB/s",
+                     metrics.mKernelUid,
+                     metrics.mKernelName.c_str(),
+                     last - first,
+                     metrics.mAvgTimeMs,
+                     metrics.mTflops,
+                     metrics.mBandwidth);
+            logger->logPerformanceTrace("hiptensorContractionGrouped", msg);
+
+            perfStats->record(std::move(statsSample), groupTime);
+        }
+        else if(timer.mActive)
+        {
+            perfStats->stopTimer(timer, stream, std::move(statsSample));
+        }
+
+        first = last;
+    }
+
+    return HIPTENSOR_STATUS_SUCCESS;
+}
+
+hiptensorStatus_t hiptensorContractionSelectionCacheLoad(const hiptensorHandle_t* handle,
+                                                         const char*              filename)
+{
+    using hiptensor::Logger;
+    auto& logger = Logger::instance();
+
+    // Log API access
+    char msg[512];
+    logger->logAPITrace("hiptensorContractionSelectionCacheLoad",
+                        "handle=0x%0*llX, filename=%s",
+                        2 * (int)sizeof(void*),
+                        (unsigned long long)handle,
+                        filename == nullptr ? "NULL" : filename);
+
+    if(handle == nullptr || filename == nullptr)
+    {
+        auto errorCode = HIPTENSOR_STATUS_NOT_INITIALIZED;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Initialization Error : %s = nullptr (%s)",
+                 handle == nullptr ? "handle" : "filename",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorContractionSelectionCacheLoad", msg);
+        return errorCode;
+    }
+
+    auto& cache     = hiptensor::ContractionSelectionCache::instance();
+    auto  errorCode = cache->load(filename);
+    if(errorCode != HIPTENSOR_STATUS_SUCCESS)
+    {
+        snprintf(msg,
+                 sizeof(msg),
+                 "Unable to load selection cache %s (%s)",
+                 filename,
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorContractionSelectionCacheLoad", msg);
+    }
+
+    return errorCode;
+}
+
+hiptensorStatus_t hiptensorContractionSelectionCacheWrite(const hiptensorHandle_t* handle,
+                                                          const char*              filename)
+{
+    using hiptensor::Logger;
+    auto& logger = Logger::instance();
+
+    // Log API access
+    char msg[512];
+    logger->logAPITrace("hiptensorContractionSelectionCacheWrite",
+                        "handle=0x%0*llX, filename=%s",
+                        2 * (int)sizeof(void*),
+                        (unsigned long long)handle,
+                        filename == nullptr ? "NULL" : filename);
+
+    if(handle == nullptr)
+    {
+        auto errorCode = HIPTENSOR_STATUS_NOT_INITIALIZED;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Initialization Error : handle = nullptr (%s)",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorContractionSelectionCacheWrite", msg);
+        return errorCode;
+    }
+
+    auto& cache     = hiptensor::ContractionSelectionCache::instance();
+    auto  errorCode = cache->write(filename == nullptr ? "" : filename);
+    if(errorCode != HIPTENSOR_STATUS_SUCCESS)
+    {
+        snprintf(msg,
+                 sizeof(msg),
+                 "Unable to write selection cache %s (%s)",
+                 filename == nullptr ? cache->fileName().c_str() : filename,
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorContractionSelectionCacheWrite", msg);
+    }
+
+    return errorCode;
+}
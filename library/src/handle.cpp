@@ -24,16 +24,30 @@
  *
  *******************************************************************************/
 
+#include <cstdlib>
+#include <cstring>
+
 #include "handle.hpp"
 
 namespace hiptensor
 {
-    Handle Handle::createHandle(int64_t* buff)
+    // Handle is constructed in-place in the opaque API fields
+    static_assert(sizeof(Handle) <= sizeof(hiptensorHandle_t::fields),
+                  "Handle does not fit in hiptensorHandle_t");
+
+    Handle::Handle()
+        : mBackend(defaultBackend())
+        , mDevicePool(mDeviceAllocator)
+        , mAllocator(&mDevicePool)
+    {
+    }
+
+    Handle* Handle::createHandle(int64_t* buff)
     {
         auto handle = toHandle(buff);
         new(handle) Handle();
 
-        return *handle;
+        return handle;
     }
 
     void Handle::destroyHandle(int64_t* buff)
@@ -47,9 +61,55 @@ namespace hiptensor
         return reinterpret_cast<Handle*>(buff);
     }
 
-    HipDevice Handle::getDevice()
+    HipDevice const& Handle::getDevice() const
     {
         return mDevice;
     }
 
+    PlanCache& Handle::getContractionPlanCache()
+    {
+        return mContractionPlanCache;
+    }
+
+    hiptensorBackend_t Handle::getBackend() const
+    {
+        return mBackend;
+    }
+
+    void Handle::setBackend(hiptensorBackend_t backend)
+    {
+        mBackend = backend;
+    }
+
+    hiptensorBackend_t Handle::defaultBackend()
+    {
+        auto* backend = std::getenv("HIPTENSOR_BACKEND");
+        if(backend != nullptr && std::strcmp(backend, "host") == 0)
+        {
+            return HIPTENSOR_BACKEND_HOST;
+        }
+        return HIPTENSOR_BACKEND_DEVICE;
+    }
+
+    Allocator& Handle::getAllocator()
+    {
+        return *mAllocator;
+    }
+
+    void Handle::setAllocator(hiptensorAllocFunc_t allocFunc,
+                              hiptensorFreeFunc_t  freeFunc,
+                              void*                userData)
+    {
+        if(allocFunc == nullptr && freeFunc == nullptr)
+        {
+            mAllocator = &mDevicePool;
+            return;
+        }
+
+        // Release what the pool holds so that the user allocator has it available
+        mDevicePool.trim();
+        mUserAllocator = CallbackAllocator(allocFunc, freeFunc, userData);
+        mAllocator     = &mUserAllocator;
+    }
+
 } // namespace hiptensor
@@ -24,43 +24,81 @@
  *
  *******************************************************************************/
 
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+
 #include "hip_device.hpp"
 #include <hiptensor/internal/hiptensor_utility.hpp>
 
 namespace hiptensor
 {
     HipDevice::HipDevice()
+        : HipDevice(fromId(currentDeviceId()))
+    {
+    }
+
+    HipDevice const& HipDevice::fromId(hipDevice_t deviceId)
+    {
+        static std::mutex                                                  sMutex;
+        static std::unordered_map<hipDevice_t, std::unique_ptr<HipDevice>> sDevices;
+
+        std::lock_guard<std::mutex> lock(sMutex);
+
+        auto& device = sDevices[deviceId];
+        if(device == nullptr)
+        {
+            device = std::unique_ptr<HipDevice>(new HipDevice(deviceId));
+        }
+        return *device;
+    }
+
+    hipDevice_t HipDevice::currentDeviceId()
+    {
+        hipDevice_t deviceId;
+        return hipGetDevice(&deviceId) == hipSuccess ? deviceId : -1;
+    }
+
+    HipDevice::HipDevice(hipDevice_t deviceId)
         : mDeviceId(-1)
+        , mProps{}
+        , mArch{}
         , mGcnArch(hipGcnArch_t::UNSUPPORTED_ARCH)
         , mWarpSize(hipWarpSize_t::UNSUPPORTED_WARP_SIZE)
         , mSharedMemSize(0)
         , mCuCount(0)
         , mMaxFreqMhz(0)
     {
-        CHECK_HIP_ERROR(hipGetDevice(&mDeviceId));
-        CHECK_HIP_ERROR(hipGetDeviceProperties(&mProps, mDeviceId));
+        // No usable device, e.g. on hosts that only run the host backend
+        if(deviceId < 0 || hipGetDeviceProperties(&mProps, deviceId) != hipSuccess)
+        {
+            return;
+        }
+        mDeviceId = deviceId;
 
         mArch = mProps.arch;
 
-        std::string deviceName(mProps.gcnArchName);
+        // Matched in place, without copying to the heap
+        std::string_view deviceName(mProps.gcnArchName);
 
-        if(deviceName.find("gfx908") != std::string::npos)
+        if(deviceName.find("gfx908") != std::string_view::npos)
         {
             mGcnArch = hipGcnArch_t::GFX908;
         }
-        else if(deviceName.find("gfx90a") != std::string::npos)
+        else if(deviceName.find("gfx90a") != std::string_view::npos)
         {
             mGcnArch = hipGcnArch_t::GFX90A;
         }
-        else if(deviceName.find("gfx940") != std::string::npos)
+        else if(deviceName.find("gfx940") != std::string_view::npos)
         {
             mGcnArch = hipGcnArch_t::GFX940;
         }
-        else if(deviceName.find("gfx941") != std::string::npos)
+        else if(deviceName.find("gfx941") != std::string_view::npos)
         {
             mGcnArch = hipGcnArch_t::GFX941;
         }
-        else if(deviceName.find("gfx942") != std::string::npos)
+        else if(deviceName.find("gfx942") != std::string_view::npos)
         {
             mGcnArch = hipGcnArch_t::GFX942;
         }
@@ -133,6 +171,12 @@ namespace hiptensor
         {
             auto device = HipDevice();
 
+            // Without a device only the host backend can be used
+            if(device.getDeviceId() < 0)
+            {
+                return false;
+            }
+
             if((device.getGcnArch() == HipDevice::hipGcnArch_t::UNSUPPORTED_ARCH)
                || (device.warpSize() == HipDevice::hipWarpSize_t::UNSUPPORTED_WARP_SIZE))
             {
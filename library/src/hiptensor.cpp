@@ -23,13 +23,19 @@
  * THE SOFTWARE.
  *
  *******************************************************************************/
+#include <cstdlib>
+#include <cstring>
+
 #include <hip/hip_runtime_api.h>
 
 #include <hiptensor/hiptensor.hpp>
 
+#include "contraction/contraction_selection_cache.hpp"
+#include "contraction/contraction_selection_model.hpp"
 #include "data_types.hpp"
 #include "handle.hpp"
 #include "logger.hpp"
+#include "perf_stats.hpp"
 #include "util.hpp"
 
 hiptensorStatus_t hiptensorCreate(hiptensorHandle_t** handle)
@@ -39,9 +45,10 @@ hiptensorStatus_t hiptensorCreate(hiptensorHandle_t** handle)
 
     // Log API access
     char msg[128];
-    snprintf(
-        msg, sizeof(msg), "handle=0x%0*llX", 2 * (int)sizeof(void*), (unsigned long long)handle);
-    logger->logAPITrace("hiptensorCreate", msg);
+    logger->logAPITrace("hiptensorCreate",
+                        "handle=0x%0*llX",
+                        2 * (int)sizeof(void*),
+                        (unsigned long long)handle);
 
     (*handle) = new hiptensorHandle_t;
 
@@ -56,7 +63,9 @@ hiptensorStatus_t hiptensorCreate(hiptensorHandle_t** handle)
         return HIPTENSOR_STATUS_ALLOC_FAILED;
     }
 
-    auto hip_status = hipInit(0);
+    // The host backend runs without a HIP device
+    auto hip_status = hiptensor::Handle::defaultBackend() == HIPTENSOR_BACKEND_HOST ? hipSuccess
+                                                                                     : hipInit(0);
 
     if(hip_status == hipErrorInvalidDevice)
     {
@@ -81,6 +90,33 @@ hiptensorStatus_t hiptensorCreate(hiptensorHandle_t** handle)
     // Get the current device (handled by the Handle class)
     auto realHandle = hiptensor::Handle::createHandle((*handle)->fields);
 
+    // Load previous kernel selections, once per process.
+    if(auto* cacheFile = std::getenv("HIPTENSOR_SELECTION_CACHE"))
+    {
+        auto& cache = hiptensor::ContractionSelectionCache::instance();
+        if(cache->fileName() != cacheFile
+           && cache->load(cacheFile) != HIPTENSOR_STATUS_SUCCESS)
+        {
+            snprintf(msg, sizeof(msg), "Selection cache not loaded, will create: %s", cacheFile);
+            logger->logHeuristics("hiptensorCreate", msg);
+        }
+    }
+
+    // Replace the built-in kernel selection model, once per process.
+    if(auto* modelFile = std::getenv("HIPTENSOR_SELECTION_MODEL"))
+    {
+        auto& model = hiptensor::ContractionSelectionModel::instance();
+        if(model->fileName() != modelFile
+           && model->load(modelFile) != HIPTENSOR_STATUS_SUCCESS)
+        {
+            snprintf(msg,
+                     sizeof(msg),
+                     "Failed to load selection model, using built-in: %s",
+                     modelFile);
+            logger->logError("hiptensorCreate", msg);
+        }
+    }
+
     return HIPTENSOR_STATUS_SUCCESS;
 }
 
@@ -90,10 +126,10 @@ hiptensorStatus_t hiptensorDestroy(hiptensorHandle_t* handle)
     auto& logger = Logger::instance();
 
     // Log API access
-    char msg[128];
-    snprintf(
-        msg, sizeof(msg), "handle=0x%0*llX", 2 * (int)sizeof(void*), (unsigned long long)handle);
-    logger->logAPITrace("hiptensorDestroy", msg);
+    logger->logAPITrace("hiptensorDestroy",
+                        "handle=0x%0*llX",
+                        2 * (int)sizeof(void*),
+                        (unsigned long long)handle);
 
     hiptensor::Handle::destroyHandle(handle->fields);
 
@@ -103,6 +139,192 @@ hiptensorStatus_t hiptensorDestroy(hiptensorHandle_t* handle)
     return HIPTENSOR_STATUS_SUCCESS;
 }
 
+hiptensorStatus_t hiptensorHandleResizePlanCache(hiptensorHandle_t* handle,
+                                                 const uint32_t     numEntries)
+{
+    using hiptensor::Logger;
+    auto& logger = Logger::instance();
+
+    // Log API access
+    char msg[128];
+    logger->logAPITrace("hiptensorHandleResizePlanCache",
+                        "handle=0x%0*llX, numEntries=%u",
+                        2 * (int)sizeof(void*),
+                        (unsigned long long)handle,
+                        (unsigned int)numEntries);
+
+    if(handle == nullptr)
+    {
+        auto errorCode = HIPTENSOR_STATUS_NOT_INITIALIZED;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Initialization Error : handle = nullptr (%s)",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorHandleResizePlanCache", msg);
+        return errorCode;
+    }
+
+    auto realHandle = hiptensor::Handle::toHandle(handle->fields);
+    realHandle->getContractionPlanCache().resize(numEntries);
+
+    return HIPTENSOR_STATUS_SUCCESS;
+}
+
+hiptensorStatus_t hiptensorHandleGetPlanCacheStats(const hiptensorHandle_t*   handle,
+                                                   hiptensorPlanCacheStats_t* stats)
+{
+    using hiptensor::Logger;
+    auto& logger = Logger::instance();
+
+    // Log API access
+    char msg[128];
+    logger->logAPITrace("hiptensorHandleGetPlanCacheStats",
+                        "handle=0x%0*llX, stats=0x%llX",
+                        2 * (int)sizeof(void*),
+                        (unsigned long long)handle,
+                        (unsigned long long)stats);
+
+    if(handle == nullptr || stats == nullptr)
+    {
+        auto errorCode = HIPTENSOR_STATUS_NOT_INITIALIZED;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Initialization Error : %s = nullptr (%s)",
+                 handle == nullptr ? "handle" : "stats",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorHandleGetPlanCacheStats", msg);
+        return errorCode;
+    }
+
+    auto realHandle = hiptensor::Handle::toHandle((int64_t*)handle->fields);
+    *stats          = realHandle->getContractionPlanCache().stats();
+
+    return HIPTENSOR_STATUS_SUCCESS;
+}
+
+hiptensorStatus_t hiptensorHandleSetBackend(hiptensorHandle_t* handle, hiptensorBackend_t backend)
+{
+    using hiptensor::Logger;
+    auto& logger = Logger::instance();
+
+    // Log API access
+    char msg[128];
+    logger->logAPITrace("hiptensorHandleSetBackend",
+                        "handle=0x%0*llX, backend=0x%02X",
+                        2 * (int)sizeof(void*),
+                        (unsigned long long)handle,
+                        (unsigned int)backend);
+
+    if(handle == nullptr)
+    {
+        auto errorCode = HIPTENSOR_STATUS_NOT_INITIALIZED;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Initialization Error : handle = nullptr (%s)",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorHandleSetBackend", msg);
+        return errorCode;
+    }
+
+    if(backend != HIPTENSOR_BACKEND_DEVICE && backend != HIPTENSOR_BACKEND_HOST)
+    {
+        auto errorCode = HIPTENSOR_STATUS_INVALID_VALUE;
+        snprintf(
+            msg, sizeof(msg), "Invalid Backend Value (%s)", hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorHandleSetBackend", msg);
+        return errorCode;
+    }
+
+    auto realHandle = hiptensor::Handle::toHandle(handle->fields);
+    if(realHandle->getBackend() != backend)
+    {
+        // Cached plans refer to solutions of the previous backend
+        realHandle->getContractionPlanCache().clear();
+        realHandle->setBackend(backend);
+    }
+
+    return HIPTENSOR_STATUS_SUCCESS;
+}
+
+hiptensorStatus_t hiptensorHandleGetBackend(const hiptensorHandle_t* handle,
+                                            hiptensorBackend_t*      backend)
+{
+    using hiptensor::Logger;
+    auto& logger = Logger::instance();
+
+    // Log API access
+    char msg[128];
+    logger->logAPITrace("hiptensorHandleGetBackend",
+                        "handle=0x%0*llX, backend=0x%llX",
+                        2 * (int)sizeof(void*),
+                        (unsigned long long)handle,
+                        (unsigned long long)backend);
+
+    if(handle == nullptr || backend == nullptr)
+    {
+        auto errorCode = HIPTENSOR_STATUS_NOT_INITIALIZED;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Initialization Error : %s = nullptr (%s)",
+                 handle == nullptr ? "handle" : "backend",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorHandleGetBackend", msg);
+        return errorCode;
+    }
+
+    auto realHandle = hiptensor::Handle::toHandle((int64_t*)handle->fields);
+    *backend        = realHandle->getBackend();
+
+    return HIPTENSOR_STATUS_SUCCESS;
+}
+
+hiptensorStatus_t hiptensorSetAllocator(hiptensorHandle_t*   handle,
+                                        hiptensorAllocFunc_t allocFunc,
+                                        hiptensorFreeFunc_t  freeFunc,
+                                        void*                userData)
+{
+    using hiptensor::Logger;
+    auto& logger = Logger::instance();
+
+    // Log API access
+    char msg[128];
+    logger->logAPITrace("hiptensorSetAllocator",
+                        "handle=0x%0*llX, allocFunc=0x%llX, freeFunc=0x%llX, userData=0x%llX",
+                        2 * (int)sizeof(void*),
+                        (unsigned long long)handle,
+                        (unsigned long long)allocFunc,
+                        (unsigned long long)freeFunc,
+                        (unsigned long long)userData);
+
+    if(handle == nullptr)
+    {
+        auto errorCode = HIPTENSOR_STATUS_NOT_INITIALIZED;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Initialization Error : handle = nullptr (%s)",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorSetAllocator", msg);
+        return errorCode;
+    }
+
+    if((allocFunc == nullptr) != (freeFunc == nullptr))
+    {
+        auto errorCode = HIPTENSOR_STATUS_INVALID_VALUE;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Invalid Allocator : %s = nullptr (%s)",
+                 allocFunc == nullptr ? "allocFunc" : "freeFunc",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorSetAllocator", msg);
+        return errorCode;
+    }
+
+    auto realHandle = hiptensor::Handle::toHandle(handle->fields);
+    realHandle->setAllocator(allocFunc, freeFunc, userData);
+
+    return HIPTENSOR_STATUS_SUCCESS;
+}
+
 hiptensorStatus_t hiptensorInitTensorDescriptor(const hiptensorHandle_t*     handle,
                                                 hiptensorTensorDescriptor_t* desc,
                                                 const uint32_t               numModes,
@@ -116,19 +338,18 @@ hiptensorStatus_t hiptensorInitTensorDescriptor(const hiptensorHandle_t*     han
 
     // Log API access
     char msg[256];
-    snprintf(msg,
-             sizeof(msg),
-             "handle=0x%0*llX, desc=0x%llX, numModes=0x%02X, lens=0x%llX, strides=0x%llX,"
-             "dataType=0x%02X, unaryOp=0x%02X",
-             2 * (int)sizeof(void*),
-             (unsigned long long)handle,
-             (unsigned long long)desc,
-             (unsigned int)numModes,
-             (unsigned long long)lens,
-             (unsigned long long)strides,
-             (unsigned int)dataType,
-             (unsigned int)unaryOp);
-    logger->logAPITrace("hiptensorInitTensorDescriptor", msg);
+    logger->logAPITrace(
+        "hiptensorInitTensorDescriptor",
+        "handle=0x%0*llX, desc=0x%llX, numModes=0x%02X, lens=0x%llX, strides=0x%llX,"
+        "dataType=0x%02X, unaryOp=0x%02X",
+        2 * (int)sizeof(void*),
+        (unsigned long long)handle,
+        (unsigned long long)desc,
+        (unsigned int)numModes,
+        (unsigned long long)lens,
+        (unsigned long long)strides,
+        (unsigned int)dataType,
+        (unsigned int)unaryOp);
 
     if(handle == nullptr || desc == nullptr)
     {
@@ -198,11 +419,13 @@ hiptensorStatus_t hiptensorInitTensorDescriptor(const hiptensorHandle_t*     han
     }
     else
     {
-        // Re-construct strides from lengths, assuming packed.
+        // Re-construct strides from lengths, assuming packed in the library's layout.
         if(numModes > 0)
         {
             auto lensVector = std::vector<std::size_t>(lens, lens + numModes);
-            *desc = {dataType, lensVector, hiptensor::stridesFromLengths(lensVector), unaryOp};
+            auto packedStrides
+                = hiptensor::stridesFromLengths(lensVector, HIPTENSOR_DATA_LAYOUT_COL_MAJOR);
+            *desc = {dataType, lensVector, packedStrides, unaryOp};
         }
         else
         {
@@ -219,9 +442,10 @@ const char* hiptensorGetErrorString(const hiptensorStatus_t error)
     auto& logger = Logger::instance();
 
     // Log API access
-    char msg[128];
-    snprintf(msg, sizeof(msg), "error=0x%0*llX", 2 * (int)sizeof(void*), (unsigned long long)error);
-    logger->logAPITrace("hiptensorGetErrorString", msg);
+    logger->logAPITrace("hiptensorGetErrorString",
+                        "error=0x%0*llX",
+                        2 * (int)sizeof(void*),
+                        (unsigned long long)error);
 
     if(error == HIPTENSOR_STATUS_SUCCESS)
         return "HIPTENSOR_STATUS_SUCCESS";
@@ -263,16 +487,13 @@ hiptensorStatus_t hiptensorGetAlignmentRequirement(const hiptensorHandle_t*
 
     // Log API access
     char msg[256];
-    snprintf(msg,
-             sizeof(msg),
-             "handle=0x%0*llX, ptr=0x%llX, desc=0x%llX, alignmentRequirement=0x%02X",
-             2 * (int)sizeof(void*),
-             (unsigned long long)handle,
-             (unsigned long long)ptr,
-             (unsigned long long)desc,
-             (unsigned int)*alignmentRequirement);
-
-    logger->logAPITrace("hiptensorGetAlignmentRequirement", msg);
+    logger->logAPITrace("hiptensorGetAlignmentRequirement",
+                        "handle=0x%0*llX, ptr=0x%llX, desc=0x%llX, alignmentRequirement=0x%02X",
+                        2 * (int)sizeof(void*),
+                        (unsigned long long)handle,
+                        (unsigned long long)ptr,
+                        (unsigned long long)desc,
+                        (unsigned int)*alignmentRequirement);
 
     if(!handle || !desc)
     {
@@ -320,6 +541,58 @@ hiptensorStatus_t hiptensorGetAlignmentRequirement(const hiptensorHandle_t*
     }
 }
 
+hiptensorStatus_t hiptensorGetPerfStats(char* json, uint64_t* jsonSize)
+{
+    using hiptensor::Logger;
+    auto& logger = Logger::instance();
+
+    // Log API access
+    logger->logAPITrace("hiptensorGetPerfStats",
+                        "json=0x%0*llX, jsonSize=0x%llX",
+                        2 * (int)sizeof(void*),
+                        (unsigned long long)json,
+                        (unsigned long long)jsonSize);
+
+    if(jsonSize == nullptr)
+    {
+        auto errorCode = HIPTENSOR_STATUS_INVALID_VALUE;
+        char msg[128];
+        snprintf(msg,
+                 sizeof(msg),
+                 "Invalid argument: jsonSize = nullptr (%s)",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorGetPerfStats", msg);
+        return errorCode;
+    }
+
+    auto document = hiptensor::PerfStats::instance()->toJson();
+    auto capacity = *jsonSize;
+    *jsonSize     = document.size() + 1;
+
+    if(json == nullptr)
+    {
+        return HIPTENSOR_STATUS_SUCCESS;
+    }
+
+    if(capacity < document.size() + 1)
+    {
+        return HIPTENSOR_STATUS_INSUFFICIENT_WORKSPACE;
+    }
+
+    memcpy(json, document.c_str(), document.size() + 1);
+    return HIPTENSOR_STATUS_SUCCESS;
+}
+
+hiptensorStatus_t hiptensorResetPerfStats()
+{
+    // Log API trace
+    auto& logger = hiptensor::Logger::instance();
+    logger->logAPITrace("hiptensorResetPerfStats", "");
+
+    hiptensor::PerfStats::instance()->reset();
+    return HIPTENSOR_STATUS_SUCCESS;
+}
+
 hiptensorStatus_t hiptensorLoggerSetCallback(hiptensorLoggerCallback_t callback)
 {
     using hiptensor::Logger;
@@ -327,12 +600,10 @@ hiptensorStatus_t hiptensorLoggerSetCallback(hiptensorLoggerCallback_t callback)
 
     // Log API access
     char msg[128];
-    snprintf(msg,
-             sizeof(msg),
-             "callback=0x%0*llX",
-             2 * (int)sizeof(void*),
-             (unsigned long long)callback);
-    logger->logAPITrace("hiptensorLoggerSetCallback", msg);
+    logger->logAPITrace("hiptensorLoggerSetCallback",
+                        "callback=0x%0*llX",
+                        2 * (int)sizeof(void*),
+                        (unsigned long long)callback);
 
     // Check logger callback result
     auto loggerResult = logger->setCallback(callback);
@@ -356,8 +627,10 @@ hiptensorStatus_t hiptensorLoggerSetFile(FILE* file)
 
     // Log API access
     char msg[128];
-    snprintf(msg, sizeof(msg), "file=0x%0*llX", 2 * (int)sizeof(void*), (unsigned long long)file);
-    logger->logAPITrace("hiptensorLoggerSetFile", msg);
+    logger->logAPITrace("hiptensorLoggerSetFile",
+                        "file=0x%0*llX",
+                        2 * (int)sizeof(void*),
+                        (unsigned long long)file);
 
     // Check logger callback result
     auto loggerResult = logger->writeToStream(file);
@@ -381,8 +654,7 @@ hiptensorStatus_t hiptensorLoggerOpenFile(const char* logFile)
 
     // Log API trace
     char msg[2048];
-    snprintf(msg, sizeof(msg), "logFile=%s", logFile);
-    logger->logAPITrace("hiptensorLoggerOpenFile", msg);
+    logger->logAPITrace("hiptensorLoggerOpenFile", "logFile=%s", logFile);
 
     // Check logger open file result
     auto loggerResult = logger->openFileStream(logFile);
@@ -403,8 +675,7 @@ hiptensorStatus_t hiptensorLoggerSetLevel(hiptensorLogLevel_t level)
 
     // Log API trace
     char msg[128];
-    snprintf(msg, sizeof(msg), "log level=0x%02X", (unsigned int)level);
-    logger->logAPITrace("hiptensorLoggerSetLevel", msg);
+    logger->logAPITrace("hiptensorLoggerSetLevel", "log level=0x%02X", (unsigned int)level);
 
     // Check logger level
     auto loggerResult = logger->setLogLevel(Logger::LogLevel_t(level));
@@ -429,8 +700,7 @@ hiptensorStatus_t hiptensorLoggerSetMask(int32_t mask)
 
     // Log API trace
     char msg[128];
-    snprintf(msg, sizeof(msg), "mask=0x%02X", (unsigned int)mask);
-    logger->logAPITrace("hiptensorLoggerSetMask", msg);
+    logger->logAPITrace("hiptensorLoggerSetMask", "mask=0x%02X", (unsigned int)mask);
 
     // Check for logger error
     auto loggerResult = logger->setLogMask(mask);
@@ -448,6 +718,40 @@ hiptensorStatus_t hiptensorLoggerSetMask(int32_t mask)
     return HIPTENSOR_STATUS_SUCCESS;
 }
 
+hiptensorStatus_t hiptensorLoggerSetMode(hiptensorLogMode_t mode)
+{
+    using hiptensor::Logger;
+    auto& logger = Logger::instance();
+
+    // Log API trace
+    char msg[128];
+    logger->logAPITrace("hiptensorLoggerSetMode", "mode=0x%02X", (unsigned int)mode);
+
+    // Check for logger error
+    auto loggerResult = logger->setMode(Logger::Mode_t(mode));
+    if(loggerResult != Logger::Status_t::SUCCESS)
+    {
+        snprintf(msg,
+                 sizeof(msg),
+                 "mode=0x%02X (%s)",
+                 (unsigned int)mode,
+                 logger->statusString(loggerResult));
+        logger->logError("hiptensorLoggerSetMode", msg);
+        return HIPTENSOR_STATUS_INVALID_VALUE;
+    }
+
+    return HIPTENSOR_STATUS_SUCCESS;
+}
+
+hiptensorStatus_t hiptensorLoggerFlush()
+{
+    // Log API trace
+    auto& logger = hiptensor::Logger::instance();
+    logger->logAPITrace("hiptensorLoggerFlush", "");
+    logger->flush();
+    return HIPTENSOR_STATUS_SUCCESS;
+}
+
 hiptensorStatus_t hiptensorLoggerForceDisable()
 {
     // Log API trace
@@ -31,7 +31,11 @@
 
 #include <hip/hip_runtime_api.h>
 
+#include <hiptensor/hiptensor_types.hpp>
+
 #include "hip_device.hpp"
+#include "memory_pool.hpp"
+#include "plan_cache.hpp"
 
 namespace hiptensor
 {
@@ -39,17 +43,41 @@ namespace hiptensor
     struct Handle
     {
     public:
-        Handle()  = default;
-        ~Handle() = default;
+        Handle();
+        ~Handle()                        = default;
+        Handle(Handle const&)            = delete;
+        Handle& operator=(Handle const&) = delete;
 
-        static Handle  createHandle(int64_t* buff); // Calls constructor for all member variables
+        static Handle* createHandle(int64_t* buff); // Calls constructor for all member variables
         static void    destroyHandle(int64_t* buff); // Calls destructor for all member variables
         static Handle* toHandle(int64_t* buff); // Reinterprets input buffer as Handle class
 
-        HipDevice getDevice();
+        HipDevice const& getDevice() const;
+        PlanCache&       getContractionPlanCache();
+
+        hiptensorBackend_t getBackend() const;
+        void               setBackend(hiptensorBackend_t backend);
+
+        // From HIPTENSOR_BACKEND ("device" or "host"), device otherwise
+        static hiptensorBackend_t defaultBackend();
+
+        // Source of every internal device allocation made on behalf of the handle
+        Allocator& getAllocator();
+
+        // User callbacks replace the caching pool; both nullptr restores it
+        void setAllocator(hiptensorAllocFunc_t allocFunc,
+                          hiptensorFreeFunc_t  freeFunc,
+                          void*                userData);
 
     private:
-        HipDevice mDevice;
+        HipDevice          mDevice;
+        PlanCache          mContractionPlanCache;
+        hiptensorBackend_t mBackend;
+
+        HipAllocator      mDeviceAllocator;
+        CachingPool       mDevicePool;
+        CallbackAllocator mUserAllocator;
+        Allocator*        mAllocator;
     };
 } // namespace hiptensor
 
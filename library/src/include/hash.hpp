@@ -27,7 +27,9 @@
 #ifndef HIPTENSOR_HASH_HPP
 #define HIPTENSOR_HASH_HPP
 
+#include <array>
 #include <functional>
+#include <vector>
 
 namespace hiptensor
 {
@@ -50,13 +52,39 @@ namespace hiptensor
         template <typename T, typename... Ts>
         void operator()(std::size_t& seed, T const& t, Ts const&... ts) const
         {
-            seed ^= std::hash<T>{}(t) + 0x9e3779b9 + (seed * 64) + (seed / 4);
+            combine(seed, t);
             if constexpr(sizeof...(ts) > 0)
             {
                 operator()(seed, ts...);
             }
         }
 
+        template <typename T>
+        static void combine(std::size_t& seed, T const& t)
+        {
+            seed ^= std::hash<T>{}(t) + 0x9e3779b9 + (seed * 64) + (seed / 4);
+        }
+
+        // Containers are folded element-wise
+        template <typename T>
+        static void combine(std::size_t& seed, std::vector<T> const& v)
+        {
+            combine(seed, v.size());
+            for(auto const& t : v)
+            {
+                combine(seed, t);
+            }
+        }
+
+        template <typename T, std::size_t N>
+        static void combine(std::size_t& seed, std::array<T, N> const& a)
+        {
+            for(auto const& t : a)
+            {
+                combine(seed, t);
+            }
+        }
+
         template <typename T, typename... Ts>
         void printArgs(T const& t, Ts const&... ts) const
         {
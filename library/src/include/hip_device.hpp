@@ -50,9 +50,17 @@ namespace hiptensor
             UNSUPPORTED_WARP_SIZE = 0u,
         };
 
+        // Properties of the calling thread's current device
         HipDevice();
         ~HipDevice() = default;
 
+        // Properties of the given device, queried once per process
+        static HipDevice const& fromId(hipDevice_t deviceId);
+
+        // Current device of the calling thread, -1 if there is none.
+        // Only calls hipGetDevice, so it is cheap enough for every API call.
+        static hipDevice_t currentDeviceId();
+
         hipDevice_t     getDeviceId() const;
         hipDeviceProp_t getDeviceProps() const;
         hipDeviceArch_t getDeviceArch() const;
@@ -66,6 +74,8 @@ namespace hiptensor
         bool supportsF64() const;
 
     private:
+        explicit HipDevice(hipDevice_t deviceId);
+
         hipDevice_t     mDeviceId;
         hipDeviceProp_t mProps;
         hipDeviceArch_t mArch;
@@ -27,9 +27,15 @@
 #ifndef HIPTENSOR_LOGGER_HPP
 #define HIPTENSOR_LOGGER_HPP
 
+#include "mpsc_ring_buffer.hpp"
 #include "singleton.hpp"
 
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <ctime>
 #include <mutex>
+#include <thread>
 
 namespace hiptensor
 {
@@ -48,6 +54,7 @@ namespace hiptensor
             INVALID_LOG_MASK,
             INVALID_LOG_LEVEL,
             FILE_OPEN_FAILED,
+            INVALID_LOG_MODE,
         };
 
         enum struct LogLevel_t : int32_t
@@ -60,6 +67,14 @@ namespace hiptensor
             LOG_LEVEL_API_TRACE        = 16,
         };
 
+        // NOTE: MUST align with hiptensorLogMode_t
+        enum struct Mode_t : int32_t
+        {
+            SYNC        = 0,
+            ASYNC_DROP  = 1,
+            ASYNC_BLOCK = 2,
+        };
+
         // For static initialization
         friend std::unique_ptr<Logger> std::make_unique<Logger>();
 
@@ -70,35 +85,100 @@ namespace hiptensor
         Status_t setCallback(Callback_t callbackFunc);
         int32_t  getLogMask() const;
         Status_t setLogMask(int32_t mask);
+        bool     isLogged(int32_t context) const;
         Status_t setLogLevel(LogLevel_t level);
         void     disable();
         void     enable();
 
+        // Async mode queues records for a background writer thread.
+        // flush() returns once every record queued before the call is written.
+        Status_t setMode(Mode_t mode);
+        Mode_t   getMode() const;
+        Status_t flush();
+        uint64_t droppedCount() const;
+
         Status_t logMessage(int32_t context, const char* apiFuncName, const char* message);
         Status_t logError(const char* apiFuncName, const char* message);
         Status_t logPerformanceTrace(const char* apiFuncName, const char* message);
         Status_t logHeuristics(const char* apiFuncName, const char* message);
         Status_t logAPITrace(const char* apiFuncName, const char* message);
 
+        // printf-style API trace: the message is only formatted
+        // when the API trace context is logged.
+        template <typename... Ts>
+        Status_t logAPITrace(const char* apiFuncName, const char* format, Ts... args);
+
         static const char* statusString(Status_t status);
 
     private:
         Logger();
-        static const char* timeStamp();
+        static void        timeStamp(time_t t, char* buff, size_t size);
         static int32_t     appPid();
         static const char* contextString(LogLevel_t context);
 
+        // Fixed-size queue record; longer messages are truncated
+        struct Record
+        {
+            int32_t mContext;
+            time_t  mTime;
+            char    mFuncName[64];
+            char    mMessage[960];
+        };
+
+        // Caller must hold mMutex
+        void writeMessage(int32_t context, time_t t, const char* apiFuncName, const char* message);
+
+        void enqueue(Mode_t mode, int32_t context, const char* apiFuncName, const char* message);
+        void drainQueue();
+        void asyncWorker();
+        void stopWorker();
+
     private:
-        bool mEnabled;
-        bool mOwnsStream;
+        // Read without locking on every API call
+        std::atomic<bool>    mEnabled;
+        std::atomic<int32_t> mLogMask;
 
-        int32_t    mLogMask;
+        bool       mOwnsStream;
         FILE*      mWriteStream;
         Callback_t mCallback;
 
         mutable std::mutex mMutex;
+
+        // Async mode state. The queue is created on first use and kept
+        // until destruction so producers racing a mode change stay valid.
+        std::atomic<Mode_t>                     mMode;
+        std::unique_ptr<MpscRingBuffer<Record>> mQueue;
+        std::thread                             mWorker;
+        bool                                    mStopWorker;
+        std::atomic<uint64_t>                   mDropped;
+        uint64_t                                mDroppedReported;
+
+        std::mutex              mModeMutex;
+        std::mutex              mQueueMutex;
+        std::condition_variable mQueueWake;
+        std::condition_variable mQueueDrained;
     };
 
+    inline bool Logger::isLogged(int32_t context) const
+    {
+        return (context & mLogMask.load(std::memory_order_relaxed)) > 0
+               && mEnabled.load(std::memory_order_relaxed);
+    }
+
+    template <typename... Ts>
+    Logger::Status_t Logger::logAPITrace(const char* apiFuncName, const char* format, Ts... args)
+    {
+        auto context = static_cast<int32_t>(LogLevel_t::LOG_LEVEL_API_TRACE);
+        if(!isLogged(context))
+        {
+            return Status_t::SUCCESS;
+        }
+
+        char message[2048];
+        snprintf(message, sizeof(message), format, args...);
+        return logMessage(context, apiFuncName, message);
+    }
+
 } // namespace hiptensor
 
 #endif // HIPTENSOR_LOGGER_HPP
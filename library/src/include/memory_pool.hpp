@@ -0,0 +1,157 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef HIPTENSOR_MEMORY_POOL_HPP
+#define HIPTENSOR_MEMORY_POOL_HPP
+
+#include <cstddef>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <hiptensor/hiptensor_types.hpp>
+
+namespace hiptensor
+{
+    // Source of the memory that the library allocates internally.
+    // Implementations return nullptr on failure and for zero-sized requests.
+    class Allocator
+    {
+    public:
+        virtual ~Allocator() = default;
+
+        virtual void* allocate(std::size_t bytes)              = 0;
+        virtual void  deallocate(void* ptr, std::size_t bytes) = 0;
+    };
+
+    // hipMalloc / hipFree
+    class HipAllocator : public Allocator
+    {
+    public:
+        void* allocate(std::size_t bytes) override;
+        void  deallocate(void* ptr, std::size_t bytes) override;
+    };
+
+    // malloc / free, so that allocation paths can be exercised without a device
+    class HostAllocator : public Allocator
+    {
+    public:
+        void* allocate(std::size_t bytes) override;
+        void  deallocate(void* ptr, std::size_t bytes) override;
+    };
+
+    // Forwards to the callbacks registered with hiptensorSetAllocator
+    class CallbackAllocator : public Allocator
+    {
+    public:
+        CallbackAllocator(hiptensorAllocFunc_t allocFunc = nullptr,
+                          hiptensorFreeFunc_t  freeFunc  = nullptr,
+                          void*                userData  = nullptr);
+
+        void* allocate(std::size_t bytes) override;
+        void  deallocate(void* ptr, std::size_t bytes) override;
+
+    private:
+        hiptensorAllocFunc_t mAllocFunc;
+        hiptensorFreeFunc_t  mFreeFunc;
+        void*                mUserData;
+    };
+
+    // Keeps released blocks in size classes and hands them back to later
+    // requests of the same class, so that repeated planning does not
+    // round-trip through the upstream allocator. Requests larger than the
+    // cache limit are never cached and go upstream at their exact size.
+    class CachingPool : public Allocator
+    {
+    public:
+        static constexpr std::size_t MinBlockSize          = 256u;
+        static constexpr std::size_t DefaultMaxCachedBytes = std::size_t(256u) << 20;
+
+        CachingPool(Allocator& upstream, std::size_t maxCachedBytes = DefaultMaxCachedBytes);
+        ~CachingPool() override;
+        CachingPool(CachingPool const&)            = delete;
+        CachingPool& operator=(CachingPool const&) = delete;
+
+        void* allocate(std::size_t bytes) override;
+
+        // Blocks are cached until maxCachedBytes is reached, then returned upstream
+        void deallocate(void* ptr, std::size_t bytes) override;
+
+        // Returns every cached block to the upstream allocator
+        void trim();
+
+        std::size_t cachedBytes() const;
+        uint64_t    hits() const;
+        uint64_t    misses() const;
+
+        // Size class that serves a request of the given size. Each power of
+        // two is split into four classes, so rounding adds less than 25%.
+        static std::size_t blockSize(std::size_t bytes);
+
+    private:
+        bool isCached(std::size_t bytes) const;
+
+        Allocator&  mUpstream;
+        std::size_t mMaxCachedBytes;
+        std::size_t mCachedBytes;
+
+        // Free blocks keyed by block size
+        std::unordered_map<std::size_t, std::vector<void*>> mFreeBlocks;
+
+        // Blocks that were allocated at the exact requested size, when the
+        // rounded size could not be served. They are never cached.
+        std::unordered_set<void*> mExactBlocks;
+
+        uint64_t mHits;
+        uint64_t mMisses;
+
+        mutable std::mutex mMutex;
+    };
+
+    // Scoped ownership of a single allocation
+    class ScopedBuffer
+    {
+    public:
+        ScopedBuffer(Allocator& allocator, std::size_t bytes);
+        ~ScopedBuffer();
+        ScopedBuffer(ScopedBuffer const&)            = delete;
+        ScopedBuffer& operator=(ScopedBuffer const&) = delete;
+
+        void* get() const;
+
+        // False if a non-empty request could not be served
+        bool valid() const;
+
+    private:
+        Allocator&  mAllocator;
+        void*       mPtr;
+        std::size_t mBytes;
+    };
+
+} // namespace hiptensor
+
+#endif // HIPTENSOR_MEMORY_POOL_HPP
@@ -0,0 +1,116 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef HIPTENSOR_MODE_COALESCING_HPP
+#define HIPTENSOR_MODE_COALESCING_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <hiptensor/hiptensor_types.hpp>
+
+namespace hiptensor
+{
+    // One operand of a problem: its descriptor and the mode ids bound to it
+    struct TensorOperand
+    {
+        hiptensorTensorDescriptor_t mDesc;
+        std::vector<int32_t>        mModes;
+    };
+
+    // Folds adjacent modes into one wherever every operand holding either of them holds
+    // both, in the same order and contiguous in memory, the first mode varying fastest in
+    // all of them or the second one in all of them. Since operands holding only one
+    // of the modes keep them apart, each fold stays within a single role, e.g. M, N, K or
+    // batch modes of a contraction, or kept or reduced modes of a reduction. The folded
+    // mode keeps the id of the first one. Empty strides are taken as packed.
+    //
+    // Folding stops at minRank modes per operand, for kernels that need a minimum rank.
+    // Operands with inconsistent lengths, strides and modes are left as they are.
+    // Returns the number of folds.
+    std::size_t coalesceModes(std::vector<TensorOperand>& tensors, std::size_t minRank = 1u);
+
+    // Modes looped over outside of the kernels, for problems of higher rank than the
+    // kernels hold even once coalesced. Each iteration runs the remaining problem on
+    // the operands offset to the iteration's index in the looped modes.
+    struct ModeSplit
+    {
+        // Extents of the looped modes
+        std::vector<std::size_t> mLengths;
+
+        // Strides in bytes of the looped modes per operand, 0 if the operand does not
+        // hold the mode
+        std::vector<std::vector<std::size_t>> mStrides;
+
+        // Number of iterations
+        std::size_t count() const;
+
+        // Offset in bytes of the operand in the given iteration
+        std::size_t offset(std::size_t operand, std::size_t iteration) const;
+
+        // Data of the operand in the given iteration
+        template <typename T>
+        T* at(T* ptr, std::size_t operand, std::size_t iteration) const
+        {
+            if(ptr == nullptr)
+            {
+                return ptr;
+            }
+            return reinterpret_cast<T*>(reinterpret_cast<std::uintptr_t>(ptr)
+                                        + offset(operand, iteration));
+        }
+    };
+
+    // Moves the mode out of every operand holding it, and into the split.
+    // Strides must be set, as coalesceModes leaves them.
+    void splitMode(std::vector<TensorOperand>& tensors, ModeSplit& split, int32_t mode);
+
+    // Position of the mode of largest stride in the tensor among those the filter
+    // accepts, or -1 if there is none. Looping over outer modes keeps the inner,
+    // contiguous ones in the kernels.
+    template <typename Filter>
+    int outermostMode(TensorOperand const& tensor, Filter&& filter)
+    {
+        auto const& strides = tensor.mDesc.mStrides;
+        if(strides.size() != tensor.mModes.size())
+        {
+            return -1;
+        }
+
+        int outermost = -1;
+        for(int i = 0; i < int(tensor.mModes.size()); i++)
+        {
+            if(filter(tensor.mModes[i]) && (outermost < 0 || strides[i] > strides[outermost]))
+            {
+                outermost = i;
+            }
+        }
+        return outermost;
+    }
+} // namespace hiptensor
+
+#endif // HIPTENSOR_MODE_COALESCING_HPP
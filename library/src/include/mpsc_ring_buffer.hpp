@@ -0,0 +1,149 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef HIPTENSOR_MPSC_RING_BUFFER_HPP
+#define HIPTENSOR_MPSC_RING_BUFFER_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+namespace hiptensor
+{
+    // Bounded multi-producer / single-consumer queue of fixed-size records.
+    // Each slot carries a sequence number: producers claim a slot by advancing
+    // the tail with a CAS and publish it by bumping the slot sequence, so
+    // neither side ever takes a lock. Records are filled and consumed in place.
+    template <typename T>
+    class MpscRingBuffer
+    {
+    public:
+        // Capacity is rounded up to a power of two
+        explicit MpscRingBuffer(uint32_t capacity)
+        {
+            mCapacity = 1u;
+            while(mCapacity < capacity)
+            {
+                mCapacity <<= 1;
+            }
+            mMask  = mCapacity - 1u;
+            mSlots = std::make_unique<Slot[]>(mCapacity);
+            for(uint32_t i = 0; i < mCapacity; i++)
+            {
+                mSlots[i].mSequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        MpscRingBuffer(MpscRingBuffer const&)            = delete;
+        MpscRingBuffer& operator=(MpscRingBuffer const&) = delete;
+
+        // Producer side: fill(T&) is called on a claimed slot.
+        // Returns false without calling fill if the buffer is full.
+        template <typename Fill>
+        bool tryPush(Fill&& fill)
+        {
+            auto  pos  = mTail.load(std::memory_order_relaxed);
+            Slot* slot = nullptr;
+            while(true)
+            {
+                slot      = &mSlots[pos & mMask];
+                auto seq  = slot->mSequence.load(std::memory_order_acquire);
+                auto diff = static_cast<int64_t>(seq) - static_cast<int64_t>(pos);
+                if(diff == 0)
+                {
+                    if(mTail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+                else if(diff < 0)
+                {
+                    return false;
+                }
+                else
+                {
+                    pos = mTail.load(std::memory_order_relaxed);
+                }
+            }
+
+            fill(slot->mData);
+            slot->mSequence.store(pos + 1, std::memory_order_release);
+            return true;
+        }
+
+        // Consumer side: consume(T&) is called on the oldest published slot.
+        // Returns false if no record is ready. Must only be called by one thread.
+        template <typename Consume>
+        bool tryPop(Consume&& consume)
+        {
+            auto  pos  = mHead.load(std::memory_order_relaxed);
+            Slot& slot = mSlots[pos & mMask];
+            if(slot.mSequence.load(std::memory_order_acquire) != pos + 1)
+            {
+                return false;
+            }
+
+            consume(slot.mData);
+            slot.mSequence.store(pos + mCapacity, std::memory_order_release);
+            mHead.store(pos + 1, std::memory_order_release);
+            return true;
+        }
+
+        // Number of records claimed / consumed so far
+        uint64_t pushed() const
+        {
+            return mTail.load(std::memory_order_acquire);
+        }
+
+        uint64_t popped() const
+        {
+            return mHead.load(std::memory_order_acquire);
+        }
+
+        uint32_t capacity() const
+        {
+            return mCapacity;
+        }
+
+    private:
+        struct Slot
+        {
+            std::atomic<uint64_t> mSequence;
+            T                     mData;
+        };
+
+        uint32_t                mCapacity;
+        uint32_t                mMask;
+        std::unique_ptr<Slot[]> mSlots;
+
+        // Keep producer and consumer counters on separate cache lines
+        alignas(64) std::atomic<uint64_t> mTail{0};
+        alignas(64) std::atomic<uint64_t> mHead{0};
+    };
+
+} // namespace hiptensor
+
+#endif // HIPTENSOR_MPSC_RING_BUFFER_HPP
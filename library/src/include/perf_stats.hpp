@@ -0,0 +1,140 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef HIPTENSOR_PERF_STATS_HPP
+#define HIPTENSOR_PERF_STATS_HPP
+
+#include <atomic>
+#include <chrono>
+#include <list>
+#include <map>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <hip/hip_runtime_api.h>
+
+#include "singleton.hpp"
+
+namespace hiptensor
+{
+    // Aggregates execution statistics per API, kernel uid and problem signature.
+    // Collection is enabled by HIPTENSOR_PERF_STATS=1; calls already timed under
+    // LOG_LEVEL_PERF_TRACE are always recorded.
+    class PerfStats : public LazySingleton<PerfStats>
+    {
+    public:
+        // For static initialization
+        friend std::unique_ptr<PerfStats> std::make_unique<PerfStats>();
+
+        // Releases the pooled and pending events
+        ~PerfStats();
+
+        struct Sample
+        {
+            const char* mApiName;
+            std::size_t mKernelUid;
+            std::string mKernelName;
+            std::string mProblem;
+            double      mFlops;
+            double      mBytes;
+        };
+
+        // Times one untimed launch: wall clock on host, stream events on device
+        struct Timer
+        {
+            bool                                  mActive = false;
+            bool                                  mHost   = false;
+            std::chrono::steady_clock::time_point mStart;
+            hipEvent_t                            mStartEvent = nullptr;
+            hipEvent_t                            mStopEvent  = nullptr;
+        };
+
+        bool isEnabled() const;
+        void setEnabled(bool enabled);
+
+        // Record a call whose duration is already known
+        void record(Sample&& sample, float timeMs);
+
+        // Returns an inactive timer when collection is disabled. Device timings
+        // are resolved later from the events, without synchronizing the caller.
+        Timer startTimer(hipStream_t stream, bool isHost);
+        void  stopTimer(Timer& timer, hipStream_t stream, Sample&& sample);
+        void  cancelTimer(Timer& timer);
+
+        // Waits for outstanding device timings
+        std::string toJson();
+        void        reset();
+
+        // Problem signature helper, e.g. "8x16x32"
+        static std::string lengthsString(std::vector<std::size_t> const& lengths);
+
+    private:
+        PerfStats();
+
+        struct Entry
+        {
+            std::string        mKernelName;
+            uint64_t           mCalls   = 0;
+            double             mTotalMs = 0.0;
+            float              mMinMs   = 0.0f;
+            float              mMaxMs   = 0.0f;
+            double             mFlops   = 0.0;
+            double             mBytes   = 0.0;
+            std::vector<float> mReservoir;
+        };
+
+        struct Pending
+        {
+            hipEvent_t mStartEvent;
+            hipEvent_t mStopEvent;
+            Sample     mSample;
+        };
+
+        using Key_t = std::tuple<std::string, std::size_t, std::string>;
+
+        // Caller must hold mMutex
+        void       recordLocked(Sample&& sample, float timeMs);
+        void       collectPending(bool wait);
+        hipEvent_t acquireEvent();
+        void       releaseEvents(hipEvent_t startEvent, hipEvent_t stopEvent, bool reuse);
+
+        // Stats are optional: a HIP failure is logged and disables collection
+        // rather than failing the call being measured.
+        bool checkHip(hipError_t status, const char* what);
+
+        std::atomic<bool>       mEnabled;
+        std::map<Key_t, Entry>  mEntries;
+        std::list<Pending>      mPending;
+        std::vector<hipEvent_t> mEventPool;
+        uint64_t                mRandState;
+        std::mutex              mMutex;
+    };
+
+} // namespace hiptensor
+
+#endif // HIPTENSOR_PERF_STATS_HPP
@@ -0,0 +1,138 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef HIPTENSOR_PLAN_CACHE_HPP
+#define HIPTENSOR_PLAN_CACHE_HPP
+
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+#include <hiptensor/hiptensor_types.hpp>
+
+#include "hash.hpp"
+
+namespace std
+{
+    template <>
+    struct hash<hiptensorTensorDescriptor_t>
+    {
+        size_t operator()(hiptensorTensorDescriptor_t const& desc) const noexcept
+        {
+            return hiptensor::Hash{}(
+                (int32_t)desc.mType, desc.mLengths, desc.mStrides, (int32_t)desc.mUnaryOp);
+        }
+    };
+
+    template <>
+    struct hash<hiptensorContractionDescriptor_t>
+    {
+        size_t operator()(hiptensorContractionDescriptor_t const& desc) const noexcept
+        {
+            return hiptensor::Hash{}(desc.mContractionOpId,
+                                     (int32_t)desc.mComputeType,
+                                     desc.mTensorDesc,
+                                     desc.mAlignmentReq,
+                                     desc.mTensorMode);
+        }
+    };
+} // namespace std
+
+namespace hiptensor
+{
+    // Bounded LRU map of problem hash to selected solution.
+    // Lives in the handle so that re-planning the same problem
+    // skips the registry queries and the selection model.
+    class PlanCache
+    {
+    public:
+        using Key = std::size_t;
+
+        // Everything the selection depends on. Stored with each entry and
+        // compared on lookup, so that colliding hashes never hand out a
+        // solution selected for another problem.
+        struct Signature
+        {
+            hiptensorContractionDescriptor_t mDesc;
+            int32_t                          mAlgo;
+            uint64_t                         mWorkspaceSize;
+            int32_t                          mBackend;
+
+            bool operator==(Signature const& other) const;
+        };
+
+        static Key hash(Signature const& signature);
+
+        static constexpr uint32_t DefaultCapacity = 64u;
+
+        PlanCache(uint32_t capacity = DefaultCapacity);
+        ~PlanCache()                           = default;
+        PlanCache(PlanCache const&)            = delete;
+        PlanCache& operator=(PlanCache const&) = delete;
+
+        // Returns the cached solution and marks it as most recently used.
+        // An entry under the same key with a different signature is a miss.
+        bool lookup(Key key, Signature const& signature, void** solution);
+
+        // Inserts or refreshes an entry, evicting the least recently used one if full
+        void insert(Key key, Signature const& signature, void* solution);
+
+        void clear();
+
+        // A capacity of 0 disables caching
+        void     resize(uint32_t capacity);
+        uint32_t capacity() const;
+        uint32_t size() const;
+
+        hiptensorPlanCacheStats_t stats() const;
+        void                      resetStats();
+
+    private:
+        void evict(uint32_t capacity);
+
+    private:
+        struct Entry
+        {
+            Key       mKey;
+            Signature mSignature;
+            void*     mSolution;
+        };
+
+        // Most recently used entries at the front
+        std::list<Entry>                                    mEntries;
+        std::unordered_map<Key, std::list<Entry>::iterator> mLookup;
+        uint32_t                                            mCapacity;
+
+        uint64_t mHits;
+        uint64_t mMisses;
+        uint64_t mEvictions;
+
+        mutable std::mutex mMutex;
+    };
+
+} // namespace hiptensor
+
+#endif // HIPTENSOR_PLAN_CACHE_HPP
@@ -0,0 +1,88 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef HIPTENSOR_THREAD_POOL_HPP
+#define HIPTENSOR_THREAD_POOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "singleton.hpp"
+
+namespace hiptensor
+{
+    // Fixed set of host worker threads for data-parallel loops such as
+    // the CPU contraction engine. Sized by HIPTENSOR_CPU_THREADS, otherwise
+    // by the hardware concurrency. The calling thread always takes part.
+    class ThreadPool : public LazySingleton<ThreadPool>
+    {
+    public:
+        // For static initialization
+        friend std::unique_ptr<ThreadPool> std::make_unique<ThreadPool>();
+
+        ~ThreadPool();
+        ThreadPool(ThreadPool const&)            = delete;
+        ThreadPool& operator=(ThreadPool const&) = delete;
+
+        // Calls func(i) for every i in [0, count) and returns when all calls are done.
+        // Only one loop is spread over the workers at a time: concurrent or nested
+        // callers run their loop on the calling thread instead of waiting.
+        void parallelFor(std::size_t count, std::function<void(std::size_t)> const& func);
+
+        // Number of threads a loop may run on, including the caller
+        uint32_t threadCount() const;
+
+    protected:
+        ThreadPool();
+
+    private:
+        void workerLoop();
+        void runTasks();
+
+        std::vector<std::thread> mWorkers;
+
+        // Current loop, guarded by mMutex
+        std::mutex                              mMutex;
+        std::condition_variable                 mWake;
+        std::condition_variable                 mDone;
+        std::function<void(std::size_t)> const* mFunc;
+        std::size_t                             mCount;
+        std::atomic<std::size_t>                mNext;
+        std::size_t                             mActive;
+        uint64_t                                mGeneration;
+        bool                                    mStop;
+
+        // Owned by the thread whose loop is on the workers
+        std::mutex mBatchMutex;
+    };
+
+} // namespace hiptensor
+
+#endif // HIPTENSOR_THREAD_POOL_HPP
@@ -68,6 +68,24 @@ namespace hiptensor
         return strides;
     }
 
+    // Get count of elements spanned by a strided tensor, padding included.
+    // Note that the count is 1 if the rank of tensor is 0, and 0 if any length is 0.
+    template <typename T>
+    static inline T elementSpaceFromLengths(std::vector<T> const& lengths,
+                                            std::vector<T> const& strides)
+    {
+        T space = 1;
+        for(std::size_t i = 0; i < lengths.size(); i++)
+        {
+            if(lengths[i] == 0)
+            {
+                return 0;
+            }
+            space += (lengths[i] - 1) * strides[i];
+        }
+        return space;
+    }
+
     // Get count of element of a tensor. Note that the count is 1 if the rank of tensor is 0.
     template <typename T>
     static inline T elementsFromLengths(std::vector<T> const& lengths)
@@ -30,21 +30,41 @@
 #include <time.h>
 #include <unistd.h>
 
+#include <chrono>
 #include <mutex>
 
 namespace hiptensor
 {
+    // Queue depth used by the async modes
+    static constexpr uint32_t AsyncQueueCapacity = 1024u;
+
+    // How often the writer thread polls an idle queue
+    static constexpr auto AsyncPollInterval = std::chrono::milliseconds(5);
+
+    // Set on the async writer thread
+    static thread_local bool sIsWriterThread = false;
+
     Logger::Logger()
         : mEnabled(true)
-        , mOwnsStream(false)
         , mLogMask(0)
+        , mOwnsStream(false)
         , mWriteStream(stdout)
         , mCallback(nullptr)
+        , mMode(Mode_t::SYNC)
+        , mStopWorker(false)
+        , mDropped(0)
+        , mDroppedReported(0)
     {
     }
 
     Logger::~Logger()
     {
+        {
+            std::scoped_lock modeLock(mModeMutex);
+            mMode.store(Mode_t::SYNC, std::memory_order_release);
+            stopWorker();
+        }
+
         std::scoped_lock lock(mMutex);
         if(mOwnsStream && mWriteStream != nullptr)
         {
@@ -54,6 +74,9 @@ namespace hiptensor
 
     Logger::Status_t Logger::writeToStream(FILE* stream)
     {
+        // Queued records belong to the previous sink
+        flush();
+
         std::scoped_lock lock(mMutex);
         if(stream != nullptr)
         {
@@ -71,6 +94,8 @@ namespace hiptensor
 
     Logger::Status_t Logger::openFileStream(const char* fileName)
     {
+        flush();
+
         std::scoped_lock lock(mMutex);
         if(fileName != nullptr && strcmp(fileName, "") != 0)
         {
@@ -99,6 +124,8 @@ namespace hiptensor
 
     Logger::Status_t Logger::setCallback(Callback_t callbackFunc)
     {
+        flush();
+
         std::scoped_lock lock(mMutex);
 
         mCallback = callbackFunc;
@@ -107,8 +134,7 @@ namespace hiptensor
 
     int32_t Logger::getLogMask() const
     {
-        std::scoped_lock lock(mMutex);
-        return mLogMask;
+        return mLogMask.load(std::memory_order_relaxed);
     }
 
     Logger::Status_t Logger::setLogLevel(LogLevel_t level)
@@ -157,34 +183,231 @@ namespace hiptensor
         mEnabled = true;
     }
 
+    Logger::Status_t Logger::setMode(Mode_t mode)
+    {
+        switch(mode)
+        {
+        case Mode_t::SYNC:
+        case Mode_t::ASYNC_DROP:
+        case Mode_t::ASYNC_BLOCK:
+            break;
+        default:
+            return Status_t::INVALID_LOG_MODE;
+        }
+
+        std::scoped_lock lock(mModeMutex);
+        if(mode == Mode_t::SYNC)
+        {
+            // New records go straight to the sink; the worker drains the rest.
+            // Producers that read the async mode before the store may still
+            // push after the worker's last pass, see enqueue().
+            mMode.store(mode, std::memory_order_seq_cst);
+            stopWorker();
+            if(mQueue)
+            {
+                drainQueue();
+            }
+            return Status_t::SUCCESS;
+        }
+
+        if(!mQueue)
+        {
+            mQueue = std::make_unique<MpscRingBuffer<Record>>(AsyncQueueCapacity);
+        }
+
+        mMode.store(mode, std::memory_order_release);
+        if(!mWorker.joinable())
+        {
+            mStopWorker = false;
+            mWorker     = std::thread(&Logger::asyncWorker, this);
+        }
+        return Status_t::SUCCESS;
+    }
+
+    Logger::Mode_t Logger::getMode() const
+    {
+        return mMode.load(std::memory_order_acquire);
+    }
+
+    Logger::Status_t Logger::flush()
+    {
+        {
+            std::scoped_lock modeLock(mModeMutex);
+            if(mWorker.joinable())
+            {
+                auto target = mQueue->pushed();
+
+                std::unique_lock<std::mutex> lock(mQueueMutex);
+                mQueueWake.notify_one();
+                mQueueDrained.wait(lock, [this, target]() { return mQueue->popped() >= target; });
+            }
+        }
+
+        std::scoped_lock lock(mMutex);
+        fflush(mWriteStream);
+        return Status_t::SUCCESS;
+    }
+
+    uint64_t Logger::droppedCount() const
+    {
+        return mDropped.load(std::memory_order_relaxed);
+    }
+
     Logger::Status_t
         Logger::logMessage(int32_t context, const char* apiFuncName, const char* message)
     {
+        // Skip the lock entirely for contexts that are not logged
+        if(!isLogged(context))
+        {
+            return Status_t::SUCCESS;
+        }
+
+        auto mode = mMode.load(std::memory_order_acquire);
+        if(mode != Mode_t::SYNC)
+        {
+            enqueue(mode, context, apiFuncName, message);
+            return Status_t::SUCCESS;
+        }
+
         std::scoped_lock lock(mMutex);
-        if((context & mLogMask) > 0 && mEnabled)
+        if(isLogged(context))
+        {
+            writeMessage(context, time(nullptr), apiFuncName, message);
+        }
+
+        return Status_t::SUCCESS;
+    }
+
+    void Logger::writeMessage(int32_t     context,
+                              time_t      t,
+                              const char* apiFuncName,
+                              const char* message)
+    {
+        // Init message
+        char ts[32];
+        char buff[2048];
+        timeStamp(t, ts, sizeof(ts));
+        snprintf(buff,
+                 sizeof(buff),
+                 "[%d][%s][hipTensor][%s][%s] %s\n",
+                 appPid(),
+                 ts,
+                 contextString((LogLevel_t)context),
+                 apiFuncName,
+                 message);
+
+        // Invoke logger callback
+        if(mCallback != nullptr)
+        {
+            (*mCallback)(context, apiFuncName, buff);
+        }
+
+        // Log to stream
+        fprintf(mWriteStream, "%s", buff);
+    }
+
+    void Logger::enqueue(Mode_t mode, int32_t context, const char* apiFuncName, const char* message)
+    {
+        auto copyString = [](char* dst, size_t size, const char* src) {
+            auto len = strnlen(src, size - 1);
+            memcpy(dst, src, len);
+            dst[len] = '\0';
+        };
+
+        auto fill = [&](Record& record) {
+            record.mContext = context;
+            record.mTime    = time(nullptr);
+            copyString(record.mFuncName, sizeof(record.mFuncName), apiFuncName);
+            copyString(record.mMessage, sizeof(record.mMessage), message);
+        };
+
+        while(!mQueue->tryPush(fill))
         {
-            // Init message
-            char buff[2048];
-            snprintf(buff,
-                     sizeof(buff),
-                     "[%d][%s][hipTensor][%s][%s] %s\n",
-                     appPid(),
-                     timeStamp(),
-                     contextString((LogLevel_t)context),
-                     apiFuncName,
-                     message);
-
-            // Invoke logger callback
-            if(mCallback != nullptr)
+            // Never block the writer thread on its own queue (e.g. from a callback)
+            if(mode == Mode_t::ASYNC_DROP || sIsWriterThread)
             {
-                (*mCallback)(context, apiFuncName, buff);
+                mDropped.fetch_add(1, std::memory_order_relaxed);
+                return;
             }
 
-            // Log to stream
-            fprintf(mWriteStream, "%s", buff);
+            mQueueWake.notify_one();
+            std::this_thread::yield();
         }
 
-        return Status_t::SUCCESS;
+        // Raced a switch to synchronous mode: the worker may already be gone,
+        // so write out what is left rather than leave it queued.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if(mMode.load(std::memory_order_relaxed) == Mode_t::SYNC && !sIsWriterThread)
+        {
+            drainQueue();
+        }
+    }
+
+    void Logger::drainQueue()
+    {
+        std::scoped_lock lock(mMutex);
+        while(mQueue->tryPop([this](Record& record) {
+            writeMessage(record.mContext, record.mTime, record.mFuncName, record.mMessage);
+        }))
+        {
+        }
+
+        // The drop report is a performance hint like any other
+        auto dropped = mDropped.load(std::memory_order_relaxed);
+        auto context = static_cast<int32_t>(LogLevel_t::LOG_LEVEL_PERF_HINT);
+        if(dropped != mDroppedReported && isLogged(context))
+        {
+            char msg[128];
+            snprintf(msg,
+                     sizeof(msg),
+                     "%llu log messages dropped (async queue full)",
+                     (unsigned long long)(dropped - mDroppedReported));
+            writeMessage(context, time(nullptr), "Logger", msg);
+        }
+        mDroppedReported = dropped;
+    }
+
+    void Logger::asyncWorker()
+    {
+        sIsWriterThread = true;
+        while(true)
+        {
+            // Read the stop flag first so records queued before stopWorker() are drained
+            bool stop = false;
+            {
+                std::scoped_lock lock(mQueueMutex);
+                stop = mStopWorker;
+            }
+
+            drainQueue();
+
+            std::unique_lock<std::mutex> lock(mQueueMutex);
+            mQueueDrained.notify_all();
+            if(stop)
+            {
+                break;
+            }
+            mQueueWake.wait_for(lock, AsyncPollInterval);
+        }
+
+        std::scoped_lock lock(mMutex);
+        fflush(mWriteStream);
+    }
+
+    // Caller must hold mModeMutex
+    void Logger::stopWorker()
+    {
+        if(!mWorker.joinable())
+        {
+            return;
+        }
+
+        {
+            std::scoped_lock lock(mQueueMutex);
+            mStopWorker = true;
+        }
+        mQueueWake.notify_one();
+        mWorker.join();
     }
 
     Logger::Status_t Logger::logError(const char* apiFuncName, const char* message)
@@ -212,26 +435,14 @@ namespace hiptensor
     }
 
     /* static */
-    const char* Logger::timeStamp()
+    void Logger::timeStamp(time_t t, char* buff, size_t size)
     {
-        static std::mutex tsMutex;
-        std::scoped_lock  lock(tsMutex);
-
-        // Statically allocate buffer.
-        // Beware thread concurrency.
-        static char buff[32];
-
-        time_t     t;
-        struct tm* tInfo;
-
-        // Retrieve the time information
-        time(&t);
-        tInfo = localtime(&t);
+        struct tm tInfo;
+        localtime_r(&t, &tInfo);
 
         // Format the timestamp string
         // YYYY-MM-DD HH:MM:SS
-        strftime(buff, 32, "%F %T", tInfo);
-        return buff;
+        strftime(buff, size, "%F %T", &tInfo);
     }
 
     /* static */
@@ -253,6 +464,8 @@ namespace hiptensor
             return "INVALID_LOG_LEVEL";
         case Status_t::FILE_OPEN_FAILED:
             return "FILE_OPEN_FAILED";
+        case Status_t::INVALID_LOG_MODE:
+            return "INVALID_LOG_MODE";
         default:
             return "STATUS_UNKNOWN";
         }
@@ -0,0 +1,265 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <cstdlib>
+
+#include <hip/hip_runtime_api.h>
+
+#include "memory_pool.hpp"
+
+namespace hiptensor
+{
+    void* HipAllocator::allocate(std::size_t bytes)
+    {
+        void* ptr = nullptr;
+        if(bytes == 0 || hipMalloc(&ptr, bytes) != hipSuccess)
+        {
+            return nullptr;
+        }
+        return ptr;
+    }
+
+    void HipAllocator::deallocate(void* ptr, std::size_t /*bytes*/)
+    {
+        if(ptr != nullptr)
+        {
+            (void)hipFree(ptr);
+        }
+    }
+
+    void* HostAllocator::allocate(std::size_t bytes)
+    {
+        return bytes == 0 ? nullptr : std::malloc(bytes);
+    }
+
+    void HostAllocator::deallocate(void* ptr, std::size_t /*bytes*/)
+    {
+        std::free(ptr);
+    }
+
+    CallbackAllocator::CallbackAllocator(hiptensorAllocFunc_t allocFunc /*= nullptr*/,
+                                         hiptensorFreeFunc_t  freeFunc /*= nullptr*/,
+                                         void*                userData /*= nullptr*/)
+        : mAllocFunc(allocFunc)
+        , mFreeFunc(freeFunc)
+        , mUserData(userData)
+    {
+    }
+
+    void* CallbackAllocator::allocate(std::size_t bytes)
+    {
+        if(bytes == 0 || mAllocFunc == nullptr)
+        {
+            return nullptr;
+        }
+        return mAllocFunc(bytes, mUserData);
+    }
+
+    void CallbackAllocator::deallocate(void* ptr, std::size_t bytes)
+    {
+        if(ptr != nullptr && mFreeFunc != nullptr)
+        {
+            mFreeFunc(ptr, bytes, mUserData);
+        }
+    }
+
+    CachingPool::CachingPool(Allocator&  upstream,
+                             std::size_t maxCachedBytes /*= DefaultMaxCachedBytes*/)
+        : mUpstream(upstream)
+        , mMaxCachedBytes(maxCachedBytes)
+        , mCachedBytes(0)
+        , mHits(0)
+        , mMisses(0)
+    {
+    }
+
+    CachingPool::~CachingPool()
+    {
+        trim();
+    }
+
+    void* CachingPool::allocate(std::size_t bytes)
+    {
+        if(bytes == 0)
+        {
+            return nullptr;
+        }
+
+        if(!isCached(bytes))
+        {
+            return mUpstream.allocate(bytes);
+        }
+
+        auto size = blockSize(bytes);
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+
+            auto it = mFreeBlocks.find(size);
+            if(it != mFreeBlocks.end() && !it->second.empty())
+            {
+                auto* ptr = it->second.back();
+                it->second.pop_back();
+                mCachedBytes -= size;
+                mHits++;
+                return ptr;
+            }
+            mMisses++;
+        }
+
+        auto* ptr = mUpstream.allocate(size);
+        if(ptr == nullptr)
+        {
+            // Cached blocks of other classes may be what is holding the memory
+            trim();
+            ptr = mUpstream.allocate(size);
+        }
+
+        if(ptr == nullptr && size != bytes)
+        {
+            // The rounding may be all that doesn't fit
+            ptr = mUpstream.allocate(bytes);
+            if(ptr != nullptr)
+            {
+                std::lock_guard<std::mutex> lock(mMutex);
+                mExactBlocks.insert(ptr);
+            }
+        }
+        return ptr;
+    }
+
+    void CachingPool::deallocate(void* ptr, std::size_t bytes)
+    {
+        if(ptr == nullptr)
+        {
+            return;
+        }
+
+        if(!isCached(bytes))
+        {
+            mUpstream.deallocate(ptr, bytes);
+            return;
+        }
+
+        auto size = blockSize(bytes);
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+
+            if(mExactBlocks.erase(ptr) > 0)
+            {
+                size = bytes;
+            }
+            else if(mCachedBytes + size <= mMaxCachedBytes)
+            {
+                mFreeBlocks[size].push_back(ptr);
+                mCachedBytes += size;
+                return;
+            }
+        }
+
+        mUpstream.deallocate(ptr, size);
+    }
+
+    void CachingPool::trim()
+    {
+        decltype(mFreeBlocks) blocks;
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            blocks.swap(mFreeBlocks);
+            mCachedBytes = 0;
+        }
+
+        for(auto& [size, ptrs] : blocks)
+        {
+            for(auto* ptr : ptrs)
+            {
+                mUpstream.deallocate(ptr, size);
+            }
+        }
+    }
+
+    std::size_t CachingPool::cachedBytes() const
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return mCachedBytes;
+    }
+
+    uint64_t CachingPool::hits() const
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return mHits;
+    }
+
+    uint64_t CachingPool::misses() const
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return mMisses;
+    }
+
+    std::size_t CachingPool::blockSize(std::size_t bytes)
+    {
+        if(bytes <= MinBlockSize)
+        {
+            return MinBlockSize;
+        }
+
+        // bytes is in (base, 2 * base], rounded up to a quarter of base
+        auto base = MinBlockSize;
+        while(base < bytes - base)
+        {
+            base <<= 1;
+        }
+        auto step = base / 4u;
+        return (bytes + step - 1u) / step * step;
+    }
+
+    bool CachingPool::isCached(std::size_t bytes) const
+    {
+        return bytes <= mMaxCachedBytes;
+    }
+
+    ScopedBuffer::ScopedBuffer(Allocator& allocator, std::size_t bytes)
+        : mAllocator(allocator)
+        , mPtr(allocator.allocate(bytes))
+        , mBytes(bytes)
+    {
+    }
+
+    ScopedBuffer::~ScopedBuffer()
+    {
+        mAllocator.deallocate(mPtr, mBytes);
+    }
+
+    void* ScopedBuffer::get() const
+    {
+        return mPtr;
+    }
+
+    bool ScopedBuffer::valid() const
+    {
+        return mBytes == 0 || mPtr != nullptr;
+    }
+
+} // namespace hiptensor
@@ -0,0 +1,220 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+
+#include "data_types.hpp"
+#include "mode_coalescing.hpp"
+#include "util.hpp"
+
+namespace hiptensor
+{
+    namespace
+    {
+        // Position of the mode in the tensor, or -1 if the tensor does not hold it
+        int findMode(TensorOperand const& tensor, int32_t mode)
+        {
+            auto it = std::find(tensor.mModes.cbegin(), tensor.mModes.cend(), mode);
+            return it == tensor.mModes.cend() ? -1 : int(it - tensor.mModes.cbegin());
+        }
+
+        // Whether the modes at i and i + 1 address memory as a single mode would, with
+        // the mode at i varying fastest, or the one at i + 1 if reversed (e.g. packed
+        // row-major). Either stride is free if its mode has a single element.
+        bool isContiguous(TensorOperand const& tensor, int i, bool reversed)
+        {
+            auto const& lengths = tensor.mDesc.mLengths;
+            auto const& strides = tensor.mDesc.mStrides;
+            if(lengths[i] == 1 || lengths[i + 1] == 1)
+            {
+                return true;
+            }
+            return reversed ? strides[i] == strides[i + 1] * lengths[i + 1]
+                            : strides[i + 1] == strides[i] * lengths[i];
+        }
+
+        // The folded mode must index elements in the same order in every operand,
+        // so all of them have to be contiguous in the same direction.
+        bool canFold(std::vector<TensorOperand> const& tensors,
+                     int32_t                           mode,
+                     int32_t                           next,
+                     std::size_t                       minRank,
+                     bool                              reversed)
+        {
+            TensorOperand const* first    = nullptr;
+            int                  firstPos = 0;
+            for(auto const& tensor : tensors)
+            {
+                auto i = findMode(tensor, mode);
+                auto j = findMode(tensor, next);
+                if(i < 0 && j < 0)
+                {
+                    continue;
+                }
+
+                if(i < 0 || j != i + 1 || tensor.mModes.size() <= minRank
+                   || !isContiguous(tensor, i, reversed))
+                {
+                    return false;
+                }
+
+                // The extents of a mode must agree across operands
+                if(first == nullptr)
+                {
+                    first    = &tensor;
+                    firstPos = i;
+                }
+                else if(tensor.mDesc.mLengths[i] != first->mDesc.mLengths[firstPos]
+                        || tensor.mDesc.mLengths[j] != first->mDesc.mLengths[firstPos + 1])
+                {
+                    return false;
+                }
+            }
+
+            return first != nullptr;
+        }
+
+        // Folds the mode at i + 1 into the one at i, which takes the stride of the
+        // faster varying of the two
+        void foldNext(TensorOperand& tensor, int i, bool reversed)
+        {
+            auto& lengths = tensor.mDesc.mLengths;
+            auto& strides = tensor.mDesc.mStrides;
+            auto& modes   = tensor.mModes;
+            if(reversed ? lengths[i + 1] != 1 : lengths[i] == 1)
+            {
+                strides[i] = strides[i + 1];
+            }
+            lengths[i] *= lengths[i + 1];
+
+            lengths.erase(lengths.begin() + i + 1);
+            strides.erase(strides.begin() + i + 1);
+            modes.erase(modes.begin() + i + 1);
+        }
+    } // namespace
+
+    std::size_t coalesceModes(std::vector<TensorOperand>& tensors, std::size_t minRank)
+    {
+        for(auto const& tensor : tensors)
+        {
+            auto rank = tensor.mDesc.mLengths.size();
+            if(tensor.mModes.size() != rank
+               || (!tensor.mDesc.mStrides.empty() && tensor.mDesc.mStrides.size() != rank))
+            {
+                return 0u;
+            }
+        }
+
+        for(auto& tensor : tensors)
+        {
+            if(tensor.mDesc.mStrides.empty())
+            {
+                tensor.mDesc.mStrides
+                    = stridesFromLengths(tensor.mDesc.mLengths, HIPTENSOR_DATA_LAYOUT_COL_MAJOR);
+            }
+        }
+
+        std::size_t folds = 0u;
+        for(auto& tensor : tensors)
+        {
+            // The folded mode may fold again with its new neighbor, so i only
+            // moves on once it cannot.
+            for(std::size_t i = 0; i + 1 < tensor.mModes.size();)
+            {
+                auto mode     = tensor.mModes[i];
+                auto next     = tensor.mModes[i + 1];
+                auto reversed = false;
+                if(!canFold(tensors, mode, next, minRank, reversed))
+                {
+                    reversed = true;
+                    if(!canFold(tensors, mode, next, minRank, reversed))
+                    {
+                        i++;
+                        continue;
+                    }
+                }
+
+                for(auto& other : tensors)
+                {
+                    if(auto pos = findMode(other, mode); pos >= 0)
+                    {
+                        foldNext(other, pos, reversed);
+                    }
+                }
+                folds++;
+            }
+        }
+
+        return folds;
+    }
+
+    std::size_t ModeSplit::count() const
+    {
+        return elementsFromLengths(mLengths);
+    }
+
+    std::size_t ModeSplit::offset(std::size_t operand, std::size_t iteration) const
+    {
+        auto const& strides = mStrides[operand];
+
+        std::size_t offset = 0u;
+        for(std::size_t i = 0; i < mLengths.size(); i++)
+        {
+            offset += (iteration % mLengths[i]) * strides[i];
+            iteration /= mLengths[i];
+        }
+        return offset;
+    }
+
+    void splitMode(std::vector<TensorOperand>& tensors, ModeSplit& split, int32_t mode)
+    {
+        split.mStrides.resize(tensors.size());
+
+        std::size_t length = 1u;
+        for(std::size_t i = 0; i < tensors.size(); i++)
+        {
+            auto& tensor = tensors[i];
+            auto  pos    = findMode(tensor, mode);
+            if(pos < 0)
+            {
+                split.mStrides[i].push_back(0u);
+                continue;
+            }
+
+            auto& lengths = tensor.mDesc.mLengths;
+            auto& strides = tensor.mDesc.mStrides;
+            length        = lengths[pos];
+            split.mStrides[i].push_back(strides[pos] * hipDataTypeSize(tensor.mDesc.mType));
+
+            lengths.erase(lengths.begin() + pos);
+            strides.erase(strides.begin() + pos);
+            tensor.mModes.erase(tensor.mModes.begin() + pos);
+        }
+        split.mLengths.push_back(length);
+    }
+} // namespace hiptensor
@@ -0,0 +1,346 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+
+#include "logger.hpp"
+#include "perf_stats.hpp"
+
+namespace hiptensor
+{
+    // Per-entry sample reservoir used for the percentiles
+    static constexpr std::size_t ReservoirSize = 1024u;
+
+    PerfStats::PerfStats()
+        : mEnabled(false)
+        , mRandState(0x9E3779B97F4A7C15ull)
+    {
+        if(auto* enable = std::getenv("HIPTENSOR_PERF_STATS"))
+        {
+            mEnabled = std::strcmp(enable, "0") != 0 && std::strcmp(enable, "") != 0;
+        }
+    }
+
+    PerfStats::~PerfStats()
+    {
+        // The HIP runtime may already be shutting down, errors are ignored
+        std::scoped_lock lock(mMutex);
+        for(auto& pending : mPending)
+        {
+            (void)hipEventDestroy(pending.mStartEvent);
+            (void)hipEventDestroy(pending.mStopEvent);
+        }
+        for(auto event : mEventPool)
+        {
+            (void)hipEventDestroy(event);
+        }
+    }
+
+    bool PerfStats::isEnabled() const
+    {
+        return mEnabled.load(std::memory_order_relaxed);
+    }
+
+    void PerfStats::setEnabled(bool enabled)
+    {
+        mEnabled.store(enabled, std::memory_order_relaxed);
+    }
+
+    void PerfStats::record(Sample&& sample, float timeMs)
+    {
+        std::scoped_lock lock(mMutex);
+        recordLocked(std::move(sample), timeMs);
+    }
+
+    PerfStats::Timer PerfStats::startTimer(hipStream_t stream, bool isHost)
+    {
+        Timer timer;
+        if(!isEnabled())
+        {
+            return timer;
+        }
+
+        if(isHost)
+        {
+            timer.mActive = true;
+            timer.mHost   = true;
+            timer.mStart  = std::chrono::steady_clock::now();
+            return timer;
+        }
+
+        std::scoped_lock lock(mMutex);
+        auto             startEvent = acquireEvent();
+        auto             stopEvent  = acquireEvent();
+        if(startEvent == nullptr || stopEvent == nullptr
+           || !checkHip(hipEventRecord(startEvent, stream), "hipEventRecord"))
+        {
+            releaseEvents(startEvent, stopEvent, false);
+            return timer;
+        }
+
+        timer.mActive     = true;
+        timer.mStartEvent = startEvent;
+        timer.mStopEvent  = stopEvent;
+        return timer;
+    }
+
+    void PerfStats::stopTimer(Timer& timer, hipStream_t stream, Sample&& sample)
+    {
+        if(!timer.mActive)
+        {
+            return;
+        }
+        timer.mActive = false;
+
+        if(timer.mHost)
+        {
+            auto elapsed = std::chrono::steady_clock::now() - timer.mStart;
+            record(std::move(sample), std::chrono::duration<float, std::milli>(elapsed).count());
+            return;
+        }
+
+        std::scoped_lock lock(mMutex);
+        if(!checkHip(hipEventRecord(timer.mStopEvent, stream), "hipEventRecord"))
+        {
+            releaseEvents(timer.mStartEvent, timer.mStopEvent, false);
+            return;
+        }
+
+        mPending.push_back({timer.mStartEvent, timer.mStopEvent, std::move(sample)});
+
+        // Opportunistically fold in launches that have already finished
+        collectPending(false);
+    }
+
+    void PerfStats::cancelTimer(Timer& timer)
+    {
+        if(!timer.mActive)
+        {
+            return;
+        }
+        timer.mActive = false;
+
+        if(!timer.mHost)
+        {
+            std::scoped_lock lock(mMutex);
+            releaseEvents(timer.mStartEvent, timer.mStopEvent, true);
+        }
+    }
+
+    std::string PerfStats::toJson()
+    {
+        auto escape = [](std::string const& str) {
+            std::string result;
+            for(auto c : str)
+            {
+                if(c == '"' || c == '\\')
+                {
+                    result += '\\';
+                }
+                result += c;
+            }
+            return result;
+        };
+
+        std::scoped_lock lock(mMutex);
+        collectPending(true);
+
+        std::ostringstream json;
+        json << "{\"kernels\":[";
+        bool first = true;
+        for(auto& [key, entry] : mEntries)
+        {
+            auto samples = entry.mReservoir;
+            std::sort(samples.begin(), samples.end());
+            auto percentile = [&samples](double p) {
+                return samples[std::min(samples.size() - 1,
+                                        static_cast<std::size_t>(p * (samples.size() - 1) + 0.5))];
+            };
+
+            auto totalMs = entry.mTotalMs;
+            json << (first ? "" : ",") << "{\"api\":\"" << std::get<0>(key) << "\""
+                 << ",\"kernelId\":" << std::get<1>(key) << ",\"kernelName\":\""
+                 << escape(entry.mKernelName) << "\""
+                 << ",\"problem\":\"" << escape(std::get<2>(key)) << "\""
+                 << ",\"calls\":" << entry.mCalls << ",\"totalMs\":" << entry.mTotalMs
+                 << ",\"minMs\":" << entry.mMinMs << ",\"maxMs\":" << entry.mMaxMs
+                 << ",\"p50Ms\":" << percentile(0.50) << ",\"p99Ms\":" << percentile(0.99)
+                 << ",\"tflops\":" << (totalMs > 0.0 ? entry.mFlops / 1.E9 / totalMs : 0.0)
+                 << ",\"gbps\":" << (totalMs > 0.0 ? entry.mBytes / 1.E6 / totalMs : 0.0) << "}";
+            first = false;
+        }
+        json << "]}";
+        return json.str();
+    }
+
+    void PerfStats::reset()
+    {
+        std::scoped_lock lock(mMutex);
+        collectPending(true);
+        mEntries.clear();
+    }
+
+    /* static */
+    std::string PerfStats::lengthsString(std::vector<std::size_t> const& lengths)
+    {
+        std::string result;
+        for(auto length : lengths)
+        {
+            result += (result.empty() ? "" : "x") + std::to_string(length);
+        }
+        return result;
+    }
+
+    void PerfStats::recordLocked(Sample&& sample, float timeMs)
+    {
+        auto  key   = Key_t{sample.mApiName, sample.mKernelUid, std::move(sample.mProblem)};
+        auto& entry = mEntries[key];
+        if(entry.mCalls == 0)
+        {
+            entry.mKernelName = std::move(sample.mKernelName);
+            entry.mMinMs      = timeMs;
+            entry.mMaxMs      = timeMs;
+            entry.mReservoir.reserve(ReservoirSize);
+        }
+
+        entry.mCalls++;
+        entry.mTotalMs += timeMs;
+        entry.mMinMs = std::min(entry.mMinMs, timeMs);
+        entry.mMaxMs = std::max(entry.mMaxMs, timeMs);
+        entry.mFlops += sample.mFlops;
+        entry.mBytes += sample.mBytes;
+
+        // Reservoir sampling keeps a uniform subset of all calls
+        if(entry.mReservoir.size() < ReservoirSize)
+        {
+            entry.mReservoir.push_back(timeMs);
+        }
+        else
+        {
+            mRandState ^= mRandState << 13;
+            mRandState ^= mRandState >> 7;
+            mRandState ^= mRandState << 17;
+            auto slot = mRandState % entry.mCalls;
+            if(slot < ReservoirSize)
+            {
+                entry.mReservoir[slot] = timeMs;
+            }
+        }
+    }
+
+    void PerfStats::collectPending(bool wait)
+    {
+        for(auto it = mPending.begin(); it != mPending.end();)
+        {
+            auto status
+                = wait ? hipEventSynchronize(it->mStopEvent) : hipEventQuery(it->mStopEvent);
+            if(status == hipErrorNotReady)
+            {
+                // Still running; later entries may be on other streams
+                ++it;
+                continue;
+            }
+
+            float timeMs = 0.0f;
+            bool  timed  = checkHip(status, wait ? "hipEventSynchronize" : "hipEventQuery");
+            if(timed)
+            {
+                timed = checkHip(hipEventElapsedTime(&timeMs, it->mStartEvent, it->mStopEvent),
+                                 "hipEventElapsedTime");
+            }
+            if(timed)
+            {
+                recordLocked(std::move(it->mSample), timeMs);
+            }
+
+            // Events in an error state are not recycled
+            releaseEvents(it->mStartEvent, it->mStopEvent, timed);
+            it = mPending.erase(it);
+        }
+    }
+
+    hipEvent_t PerfStats::acquireEvent()
+    {
+        if(mEventPool.empty())
+        {
+            hipEvent_t event = nullptr;
+            if(!checkHip(hipEventCreate(&event), "hipEventCreate"))
+            {
+                return nullptr;
+            }
+            return event;
+        }
+
+        auto event = mEventPool.back();
+        mEventPool.pop_back();
+        return event;
+    }
+
+    void PerfStats::releaseEvents(hipEvent_t startEvent, hipEvent_t stopEvent, bool reuse)
+    {
+        for(auto event : {startEvent, stopEvent})
+        {
+            if(event == nullptr)
+            {
+                continue;
+            }
+
+            if(reuse)
+            {
+                mEventPool.push_back(event);
+            }
+            else
+            {
+                (void)hipEventDestroy(event);
+            }
+        }
+    }
+
+    bool PerfStats::checkHip(hipError_t status, const char* what)
+    {
+        if(status == hipSuccess)
+        {
+            return true;
+        }
+
+        if(mEnabled.exchange(false, std::memory_order_relaxed))
+        {
+            char msg[256];
+            snprintf(msg,
+                     sizeof(msg),
+                     "%s failed (%s), performance statistics disabled",
+                     what,
+                     hipGetErrorString(status));
+            Logger::instance()->logError("PerfStats", msg);
+        }
+        return false;
+    }
+
+} // namespace hiptensor
@@ -23,12 +23,20 @@
  * THE SOFTWARE.
  *
  *******************************************************************************/
+#include <algorithm>
+#include <chrono>
+
 #include <hiptensor/hiptensor.hpp>
 
+#include "permutation_cpu_reference_instances.hpp"
 #include "permutation_solution.hpp"
 #include "permutation_solution_instances.hpp"
 #include "permutation_solution_registry.hpp"
+#include "handle.hpp"
 #include "logger.hpp"
+#include "memory_pool.hpp"
+#include "mode_coalescing.hpp"
+#include "perf_stats.hpp"
 
 inline auto toPermutationSolutionVec(
     std::unordered_map<std::size_t, hiptensor::PermutationSolution*> const& map)
@@ -38,6 +46,336 @@ inline auto toPermutationSolutionVec(
     return result;
 }
 
+// Validates the data types of the problem shared by all permutation entry points.
+inline hiptensorStatus_t checkPermutationTypes(char const*                        apiName,
+                                               const hiptensorTensorDescriptor_t* descA,
+                                               const hiptensorTensorDescriptor_t* descB,
+                                               const hipDataType                  typeScalar)
+{
+    using hiptensor::Logger;
+    auto& logger = Logger::instance();
+
+    char msg[256];
+    if(descA->mType != HIP_R_16F && descA->mType != HIP_R_32F)
+    {
+        auto errorCode = HIPTENSOR_STATUS_NOT_SUPPORTED;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Unsupported Data Type Error : The supported data types of A and B are HIP_R_16F "
+                 "and HIP_R_32F (%s)",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError(apiName, msg);
+        return errorCode;
+    }
+
+    if(descA->mType != descB->mType)
+    {
+        auto errorCode = HIPTENSOR_STATUS_INVALID_VALUE;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Mismatched Data Type Error : Data types of A and B are not the same. (%s)",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError(apiName, msg);
+        return errorCode;
+    }
+
+    if(typeScalar != HIP_R_16F && typeScalar != HIP_R_32F)
+    {
+        auto errorCode = HIPTENSOR_STATUS_NOT_SUPPORTED;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Unsupported Data Type Error : The supported data types of alpha are HIP_R_16F "
+                 "and HIP_R_32F (%s)",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError(apiName, msg);
+        return errorCode;
+    }
+
+    return HIPTENSOR_STATUS_SUCCESS;
+}
+
+// Permutation kernels cover ranks 2 to 6
+constexpr std::size_t PermutationMinRank = 2u;
+constexpr std::size_t PermutationMaxRank = 6u;
+
+// The problem as dispatched. Modes that are contiguous in both A and B are folded, so
+// that the problem runs on kernels of lower rank, and the outer modes of A that the
+// kernels still cannot hold are looped over.
+inline std::vector<hiptensor::TensorOperand>
+    makePermutationProblem(const hiptensorTensorDescriptor_t* descA,
+                           const int32_t                      modeA[],
+                           const hiptensorTensorDescriptor_t* descB,
+                           const int32_t                      modeB[],
+                           hiptensor::ModeSplit&              split)
+{
+    std::vector<hiptensor::TensorOperand> operands
+        = {{*descA, {modeA, modeA + descA->mLengths.size()}},
+           {*descB, {modeB, modeB + descB->mLengths.size()}}};
+    hiptensor::coalesceModes(operands, PermutationMinRank);
+
+    while(operands[0].mModes.size() > PermutationMaxRank)
+    {
+        auto pos = hiptensor::outermostMode(operands[0], [](int32_t) { return true; });
+        if(pos < 0)
+        {
+            break;
+        }
+        hiptensor::splitMode(operands, split, operands[0].mModes[pos]);
+    }
+
+    return operands;
+}
+
+// Queries the solutions of the handle's backend matching the problem, in uid order
+// so that the selection does not depend on the registry's hashing.
+inline hiptensorStatus_t
+    queryPermutationCandidates(char const*                                   apiName,
+                               hiptensor::Handle*                            realHandle,
+                               const hiptensorTensorDescriptor_t*            descA,
+                               const hiptensorTensorDescriptor_t*            descB,
+                               std::vector<hiptensor::PermutationSolution*>& candidates)
+{
+    using hiptensor::Logger;
+    auto& logger = Logger::instance();
+
+    // For now, enumerate all known permutation kernels of the backend.
+    auto solnQ = realHandle->getBackend() == HIPTENSOR_BACKEND_HOST
+                     ? hiptensor::PermutationCpuReferenceInstances::instance()->allSolutions()
+                     : hiptensor::PermutationSolutionInstances::instance()->allSolutions();
+
+    // Query permutation solutions for the correct permutation operation and type
+    int32_t nDims     = descA->mLengths.size();
+    auto    solutionQ = solnQ.query(nDims,
+                                    descA->mType,
+                                    descB->mType,
+                                    descA->mUnaryOp,
+                                    descB->mUnaryOp,
+                                    hiptensor::PermutationOpId_t::SCALE);
+
+    if(solutionQ.solutionCount() == 0)
+    {
+        // No kernels found!
+        auto errorCode = HIPTENSOR_STATUS_INTERNAL_ERROR;
+        char msg[256];
+        snprintf(msg,
+                 sizeof(msg),
+                 "Internal Error : No Kernels Found (%s)",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError(apiName, msg);
+        return errorCode;
+    }
+
+    candidates = toPermutationSolutionVec(solutionQ.solutions());
+    std::sort(candidates.begin(), candidates.end(), [](auto* lhs, auto* rhs) {
+        return lhs->uid() < rhs->uid();
+    });
+
+    return HIPTENSOR_STATUS_SUCCESS;
+}
+
+// Validates the problem against the candidates. The fastest one is kept when timing
+// is requested, otherwise the first candidate supporting the problem.
+inline hiptensorStatus_t
+    selectPermutationSolution(hiptensor::PermutationSolution**                    winner,
+                              std::shared_ptr<hiptensor::PermutationArgs>&        winnerArgs,
+                              std::vector<hiptensor::PermutationSolution*> const& candidates,
+                              hiptensor::Handle*                                  realHandle,
+                              const hiptensorTensorDescriptor_t*                  descA,
+                              const int32_t                                       modeA[],
+                              const hiptensorTensorDescriptor_t*                  descB,
+                              const int32_t                                       modeB[],
+                              const hipDataType                                   typeScalar,
+                              bool                                                timed)
+{
+    *winner = nullptr;
+    winnerArgs.reset();
+
+    // Scratch tensors and scalar for timing the candidates
+    auto bytesA = hiptensor::elementSpaceFromLengths(descA->mLengths, descA->mStrides)
+                  * hiptensor::hipDataTypeSize(descA->mType);
+    auto bytesB = hiptensor::elementSpaceFromLengths(descB->mLengths, descB->mStrides)
+                  * hiptensor::hipDataTypeSize(descB->mType);
+    hiptensor::ScopedBuffer bufferA(realHandle->getAllocator(), timed ? bytesA : 0);
+    hiptensor::ScopedBuffer bufferB(realHandle->getAllocator(), timed ? bytesB : 0);
+    if(!bufferA.valid() || !bufferB.valid())
+    {
+        return HIPTENSOR_STATUS_ALLOC_FAILED;
+    }
+
+    auto                  computeType = hiptensor::convertToComputeType(typeScalar);
+    hiptensor::ScalarData alpha;
+    hiptensor::writeVal(&alpha, computeType, hiptensor::ScalarData(computeType, 1.02));
+
+    float bestTime = 0.0f;
+    for(auto* solution : candidates)
+    {
+        auto args = std::make_shared<hiptensor::PermutationArgs>();
+        if(!solution->initArgs(*args,
+                               nullptr,
+                               nullptr,
+                               nullptr,
+                               descA->mLengths,
+                               descA->mStrides,
+                               modeA,
+                               descB->mLengths,
+                               descB->mStrides,
+                               modeB,
+                               typeScalar))
+        {
+            continue;
+        }
+
+        if(!timed)
+        {
+            *winner    = solution;
+            winnerArgs = std::move(args);
+            break;
+        }
+
+        auto time = (*solution)(
+            *args, &alpha, bufferA.get(), bufferB.get(), StreamConfig{nullptr, true});
+        if(time > 0 && (*winner == nullptr || time < bestTime))
+        {
+            *winner    = solution;
+            winnerArgs = std::move(args);
+            bestTime   = time;
+        }
+    }
+
+    return *winner == nullptr ? HIPTENSOR_STATUS_INTERNAL_ERROR : HIPTENSOR_STATUS_SUCCESS;
+}
+
+// Launches the validated arguments, timing and recording the launch as configured.
+inline hiptensorStatus_t launchPermutation(char const*                           apiName,
+                                           hiptensor::Handle*                    realHandle,
+                                           hiptensor::PermutationSolution const* pSolution,
+                                           hiptensor::PermutationArgs const&     args,
+                                           const void*                           alpha,
+                                           const void*                           A,
+                                           void*                                 B,
+                                           const hipStream_t                     stream)
+{
+    using hiptensor::Logger;
+    auto& logger = Logger::instance();
+
+    auto  backend     = realHandle->getBackend();
+    auto& perfStats   = hiptensor::PerfStats::instance();
+    auto  statsSample = [apiName, pSolution, &args]() {
+        auto lengths = std::vector<std::size_t>(args.mLengths.begin(), args.mLengths.end());
+        return hiptensor::PerfStats::Sample{apiName,
+                                            pSolution->uid(),
+                                            pSolution->kernelName(),
+                                            hiptensor::PerfStats::lengthsString(lengths),
+                                            2.0 * args.mElements,
+                                            static_cast<double>(args.mBytes)};
+    };
+
+    // Perform permutation with timing if LOG_LEVEL_PERF_TRACE
+    if(logger->getLogMask() & HIPTENSOR_LOG_LEVEL_PERF_TRACE)
+    {
+        auto start = std::chrono::steady_clock::now();
+        auto time  = (*pSolution)(args,
+                                 alpha,
+                                 A,
+                                 B,
+                                 StreamConfig{
+                                     stream, // stream id
+                                     true, // time_kernel
+                                     0, // log_level
+                                     0, // cold_niters
+                                     1, // nrepeat
+                                 });
+        if(time < 0)
+        {
+            return HIPTENSOR_STATUS_CK_ERROR;
+        }
+
+        // Host solutions run synchronously and are not timed by the invoker
+        if(backend == HIPTENSOR_BACKEND_HOST)
+        {
+            auto elapsed = std::chrono::steady_clock::now() - start;
+            time         = std::chrono::duration<float, std::milli>(elapsed).count();
+        }
+
+        auto flops = std::size_t(2) * args.mElements;
+        auto bytes = args.mBytes;
+
+        hiptensor::PerfMetrics metrics = {
+            pSolution->uid(), // id
+            pSolution->kernelName(), // name
+            time, // avg time
+            static_cast<float>(flops) / static_cast<float>(1.E9) / time, // tflops
+            static_cast<float>(bytes) / static_cast<float>(1.E6) / time // BW
+        };
+
+        // log perf metrics (not name/id)
+        char msg[2048];
+        snprintf(msg,
+                 sizeof(msg),
+                 "KernelId: %lu KernelName: %s, %0.3f ms, %0.3f TFlops, %0.3f GB/s",
+                 metrics.mKernelUid,
+                 metrics.mKernelName.c_str(),
+                 metrics.mAvgTimeMs,
+                 metrics.mTflops,
+                 metrics.mBandwidth);
+        logger->logPerformanceTrace(apiName, msg);
+
+        perfStats->record(statsSample(), time);
+    }
+    // Perform permutation without synchronous timing
+    else
+    {
+        auto timer = perfStats->startTimer(stream, backend == HIPTENSOR_BACKEND_HOST);
+        if((*pSolution)(args, alpha, A, B, StreamConfig{stream, false}) < 0)
+        {
+            perfStats->cancelTimer(timer);
+            return HIPTENSOR_STATUS_CK_ERROR;
+        }
+
+        if(timer.mActive)
+        {
+            perfStats->stopTimer(timer, stream, statsSample());
+        }
+    }
+
+    return HIPTENSOR_STATUS_SUCCESS;
+}
+
+// Launches every iteration of the split, or the problem as a whole if there is none
+inline hiptensorStatus_t launchPermutation(char const*                           apiName,
+                                           hiptensor::Handle*                    realHandle,
+                                           hiptensor::PermutationSolution const* pSolution,
+                                           hiptensor::PermutationArgs const&     args,
+                                           hiptensor::ModeSplit const*           split,
+                                           const void*                           alpha,
+                                           const void*                           A,
+                                           void*                                 B,
+                                           const hipStream_t                     stream)
+{
+    if(split == nullptr)
+    {
+        return launchPermutation(apiName, realHandle, pSolution, args, alpha, A, B, stream);
+    }
+
+    for(std::size_t i = 0; i < split->count(); i++)
+    {
+        auto errorCode = launchPermutation(apiName,
+                                           realHandle,
+                                           pSolution,
+                                           args,
+                                           alpha,
+                                           split->at(A, 0, i),
+                                           split->at(B, 1, i),
+                                           stream);
+        if(errorCode != HIPTENSOR_STATUS_SUCCESS)
+        {
+            return errorCode;
+        }
+    }
+
+    return HIPTENSOR_STATUS_SUCCESS;
+}
+
 hiptensorStatus_t hiptensorPermutation(const hiptensorHandle_t*           handle,
                                        const void*                        alpha,
                                        const void*                        A,
@@ -54,22 +392,19 @@ hiptensorStatus_t hiptensorPermutation(const hiptensorHandle_t*           handle
 
     // Log API access
     char msg[2048];
-    snprintf(msg,
-             sizeof(msg),
-             "handle=%p, alpha=%p, A=%p, descA=%p, modeA=%p, B=%p, descB=%p, modeB=%p, "
-             "typeScalar=0x%02X, stream=%p",
-             handle,
-             alpha,
-             A,
-             descA,
-             modeA,
-             B,
-             descB,
-             modeB,
-             (unsigned int)typeScalar,
-             stream);
-
-    logger->logAPITrace("hiptensorPermutation", msg);
+    logger->logAPITrace("hiptensorPermutation",
+                        "handle=%p, alpha=%p, A=%p, descA=%p, modeA=%p, B=%p, descB=%p, modeB=%p, "
+                        "typeScalar=0x%02X, stream=%p",
+                        handle,
+                        alpha,
+                        A,
+                        descA,
+                        modeA,
+                        B,
+                        descB,
+                        modeB,
+                        (unsigned int)typeScalar,
+                        stream);
 
     if(!handle || !alpha || !A || !descA || !modeA || !B || !descB || !modeB)
     {
@@ -118,162 +453,257 @@ hiptensorStatus_t hiptensorPermutation(const hiptensorHandle_t*           handle
         return errorCode;
     }
 
-    if(descA->mType != HIP_R_16F && descA->mType != HIP_R_32F)
+    auto errorCode = checkPermutationTypes("hiptensorPermutation", descA, descB, typeScalar);
+    if(errorCode != HIPTENSOR_STATUS_SUCCESS)
     {
-        auto errorCode = HIPTENSOR_STATUS_NOT_SUPPORTED;
+        return errorCode;
+    }
+
+    // Kernels are dispatched on the coalesced problem, or on its splits
+    hiptensor::ModeSplit split;
+    auto                 operands = makePermutationProblem(descA, modeA, descB, modeB, split);
+
+    descA = &operands[0].mDesc;
+    modeA = operands[0].mModes.data();
+    descB = &operands[1].mDesc;
+    modeB = operands[1].mModes.data();
+
+    auto realHandle = hiptensor::Handle::toHandle((int64_t*)handle->fields);
+
+    std::vector<hiptensor::PermutationSolution*> candidates;
+    errorCode
+        = queryPermutationCandidates("hiptensorPermutation", realHandle, descA, descB, candidates);
+    if(errorCode != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return errorCode;
+    }
+
+    // One-shot calls bind the data pointers and scalar directly
+    for(auto* pSolution : candidates)
+    {
+        hiptensor::PermutationArgs args;
+        if(pSolution->initArgs(args,
+                               alpha,
+                               A,
+                               B,
+                               descA->mLengths,
+                               descA->mStrides,
+                               modeA,
+                               descB->mLengths,
+                               descB->mStrides,
+                               modeB,
+                               typeScalar))
+        {
+            return launchPermutation("hiptensorPermutation",
+                                     realHandle,
+                                     pSolution,
+                                     args,
+                                     split.mLengths.empty() ? nullptr : &split,
+                                     alpha,
+                                     A,
+                                     B,
+                                     stream);
+        }
+    }
+
+    errorCode = HIPTENSOR_STATUS_INTERNAL_ERROR;
+    snprintf(msg,
+             sizeof(msg),
+             "Selected kernel is unable to solve the problem (%s)",
+             hiptensorGetErrorString(errorCode));
+    logger->logError("hiptensorPermutation", msg);
+    return errorCode;
+}
+
+hiptensorStatus_t hiptensorInitPermutationPlan(const hiptensorHandle_t*           handle,
+                                               hiptensorPermutationPlan_t*        plan,
+                                               const hiptensorTensorDescriptor_t* descA,
+                                               const int32_t                      modeA[],
+                                               const hiptensorTensorDescriptor_t* descB,
+                                               const int32_t                      modeB[],
+                                               const hipDataType                  typeScalar,
+                                               const hiptensorAlgo_t              algo)
+{
+    using hiptensor::Logger;
+    auto& logger = Logger::instance();
+
+    // Log API access
+    char msg[2048];
+    logger->logAPITrace("hiptensorInitPermutationPlan",
+                        "handle=%p, plan=%p, descA=%p, modeA=%p, descB=%p, modeB=%p, "
+                        "typeScalar=0x%02X, algo=%d",
+                        handle,
+                        plan,
+                        descA,
+                        modeA,
+                        descB,
+                        modeB,
+                        (unsigned int)typeScalar,
+                        (int)algo);
+
+    if(!handle || !plan || !descA || !modeA || !descB || !modeB)
+    {
+        auto errorCode = HIPTENSOR_STATUS_NOT_INITIALIZED;
         snprintf(msg,
                  sizeof(msg),
-                 "Unsupported Data Type Error : The supported data types of A and B are HIP_R_16F "
-                 "and HIP_R_32F (%s)",
+                 "Initialization Error : %s = nullptr (%s)",
+                 !handle  ? "handle"
+                 : !plan  ? "plan"
+                 : !descA ? "descA"
+                 : !modeA ? "modeA"
+                 : !descB ? "descB"
+                          : "modeB",
                  hiptensorGetErrorString(errorCode));
-        logger->logError("hiptensorPermutation", msg);
+        logger->logError("hiptensorInitPermutationPlan", msg);
         return errorCode;
     }
 
-    if(descA->mType != descB->mType)
+    if(algo != HIPTENSOR_ALGO_DEFAULT && algo != HIPTENSOR_ALGO_DEFAULT_PATIENT)
     {
         auto errorCode = HIPTENSOR_STATUS_INVALID_VALUE;
+        snprintf(msg, sizeof(msg), "Invalid Algo Value (%s)", hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorInitPermutationPlan", msg);
+        return errorCode;
+    }
+
+    auto errorCode
+        = checkPermutationTypes("hiptensorInitPermutationPlan", descA, descB, typeScalar);
+    if(errorCode != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return errorCode;
+    }
+
+    // Kernels are dispatched on the coalesced problem, or on its splits
+    auto split    = std::make_shared<hiptensor::ModeSplit>();
+    auto operands = makePermutationProblem(descA, modeA, descB, modeB, *split);
+    descA         = &operands[0].mDesc;
+    modeA         = operands[0].mModes.data();
+    descB         = &operands[1].mDesc;
+    modeB         = operands[1].mModes.data();
+
+    auto realHandle = hiptensor::Handle::toHandle((int64_t*)handle->fields);
+    auto backend    = realHandle->getBackend();
+
+    std::vector<hiptensor::PermutationSolution*> candidates;
+    errorCode = queryPermutationCandidates(
+        "hiptensorInitPermutationPlan", realHandle, descA, descB, candidates);
+    if(errorCode != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return errorCode;
+    }
+
+    // Host solutions all run the same reference, so only device candidates are timed
+    bool timed = algo == HIPTENSOR_ALGO_DEFAULT_PATIENT && backend == HIPTENSOR_BACKEND_DEVICE;
+
+    hiptensor::PermutationSolution*             winner = nullptr;
+    std::shared_ptr<hiptensor::PermutationArgs> args;
+    errorCode = selectPermutationSolution(
+        &winner, args, candidates, realHandle, descA, modeA, descB, modeB, typeScalar, timed);
+    if(errorCode != HIPTENSOR_STATUS_SUCCESS)
+    {
         snprintf(msg,
                  sizeof(msg),
-                 "Mismatched Data Type Error : Data types of A and B are not the same. (%s)",
+                 "Selected kernel is unable to solve the problem (%s)",
                  hiptensorGetErrorString(errorCode));
-        logger->logError("hiptensorPermutation", msg);
+        logger->logError("hiptensorInitPermutationPlan", msg);
         return errorCode;
     }
 
-    if(typeScalar != HIP_R_16F && typeScalar != HIP_R_32F)
+    plan->mSolution = winner;
+    plan->mArgs     = std::move(args);
+    plan->mSplit    = split->mLengths.empty() ? nullptr : std::move(split);
+    plan->mBackend  = backend;
+
+    return HIPTENSOR_STATUS_SUCCESS;
+}
+
+hiptensorStatus_t hiptensorPermutationExecute(const hiptensorHandle_t*          handle,
+                                              const hiptensorPermutationPlan_t* plan,
+                                              const void*                       alpha,
+                                              const void*                       A,
+                                              void*                             B,
+                                              const hipStream_t                 stream)
+{
+    using hiptensor::Logger;
+    auto& logger = Logger::instance();
+
+    // Log API access
+    char msg[2048];
+    logger->logAPITrace("hiptensorPermutationExecute",
+                        "handle=%p, plan=%p, alpha=%p, A=%p, B=%p, stream=%p",
+                        handle,
+                        plan,
+                        alpha,
+                        A,
+                        B,
+                        stream);
+
+    if(!handle || !plan)
     {
-        auto errorCode = HIPTENSOR_STATUS_NOT_SUPPORTED;
+        auto errorCode = HIPTENSOR_STATUS_NOT_INITIALIZED;
         snprintf(msg,
                  sizeof(msg),
-                 "Unsupported Data Type Error : The supported data types of alpha are HIP_R_16F "
-                 "and HIP_R_32F (%s)",
+                 "Initialization Error : %s = nullptr (%s)",
+                 !handle ? "handle" : "plan",
                  hiptensorGetErrorString(errorCode));
-        logger->logError("hiptensorPermutation", msg);
+        logger->logError("hiptensorPermutationExecute", msg);
         return errorCode;
     }
 
-    // For now, enumerate all known permutation kernels.
-    auto& instances = hiptensor::PermutationSolutionInstances::instance();
-    auto  solnQ     = instances->allSolutions();
+    if(!alpha || !A || !B)
+    {
+        auto errorCode = HIPTENSOR_STATUS_INVALID_VALUE;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Input Parameter Error : alpha/A/B = nullptr (%s)",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorPermutationExecute", msg);
+        return errorCode;
+    }
 
-    if(solnQ.solutionCount() == 0)
+    if(plan->mSolution == nullptr || plan->mArgs == nullptr)
     {
-        // No kernels found!
         auto errorCode = HIPTENSOR_STATUS_INTERNAL_ERROR;
         snprintf(msg,
                  sizeof(msg),
-                 "Internal Error : No Kernels Found (%s)",
+                 "Internal Error : %s = nullptr (%s)",
+                 plan->mSolution == nullptr ? "solution" : "args",
                  hiptensorGetErrorString(errorCode));
-        logger->logError("hiptensorPermutation", msg);
+        logger->logError("hiptensorPermutationExecute", msg);
         return errorCode;
     }
 
-    // Extract the solutions to the candidates vector.
-    auto candidates = toPermutationSolutionVec(solnQ.solutions());
+    auto realHandle = hiptensor::Handle::toHandle((int64_t*)handle->fields);
+    auto backend    = realHandle->getBackend();
 
-    int  nDims              = descA->mLengths.size();
-    auto ADataType          = descA->mType;
-    auto BDataType          = descB->mType;
-    auto AOp                = descA->mUnaryOp;
-    auto BOp                = descB->mUnaryOp;
-
-    // Query permutation solutions for the correct permutation operation and type
-    auto solutionQ = hiptensor::PermutationSolutionRegistry::Query{candidates}
-                                                            .query(nDims,
-                                                                   ADataType,
-                                                                   BDataType,
-                                                                   AOp,
-                                                                   BOp,
-                                                                   hiptensor::PermutationOpId_t::SCALE);
-
-    if(solutionQ.solutionCount() == 0)
+    if(plan->mBackend != backend)
     {
-        // No kernels found!
-        auto errorCode = HIPTENSOR_STATUS_INTERNAL_ERROR;
+        auto errorCode = HIPTENSOR_STATUS_INVALID_VALUE;
         snprintf(msg,
                  sizeof(msg),
-                 "Internal Error : No Kernels Found (%s)",
+                 "Backend mismatch error: plan backend: %d, handle backend: %d (%s)",
+                 (int)plan->mBackend,
+                 (int)backend,
                  hiptensorGetErrorString(errorCode));
-        logger->logError("hiptensorPermutation", msg);
+        logger->logError("hiptensorPermutationExecute", msg);
         return errorCode;
     }
 
-    candidates = toPermutationSolutionVec(solutionQ.solutions());
+    // The plan holds the validated arguments: only the data pointers and
+    // scalar are patched in, and only when they have changed.
+    auto*       pSolution = (hiptensor::PermutationSolution*)(plan->mSolution);
+    auto const& args      = *(hiptensor::PermutationArgs const*)(plan->mArgs.get());
+    auto*       split     = (hiptensor::ModeSplit const*)(plan->mSplit.get());
 
-    bool canRun = false;
-    for(int i = 0; i < candidates.size(); i++)
+    auto errorCode = launchPermutation(
+        "hiptensorPermutationExecute", realHandle, pSolution, args, split, alpha, A, B, stream);
+    if(errorCode != HIPTENSOR_STATUS_SUCCESS)
     {
-        hiptensor::PermutationSolution *pSolution = candidates[i];
-        canRun = pSolution->initArgs(alpha,
-                                     A,
-                                     B,
-                                     descA->mLengths,
-                                     descA->mStrides,
-                                     modeA,
-                                     descB->mLengths,
-                                     descB->mStrides,
-                                     modeB,
-                                     typeScalar);
-
-        if(canRun)
-        {
-            // Perform permutation with timing if LOG_LEVEL_PERF_TRACE
-            if(logger->getLogMask() & HIPTENSOR_LOG_LEVEL_PERF_TRACE)
-            {
-                auto time = (*pSolution)(StreamConfig{
-                    stream, // stream id
-                    true, // time_kernel
-                    0, // log_level
-                    0, // cold_niters
-                    1, // nrepeat
-                });
-                if(time < 0)
-                {
-                    return HIPTENSOR_STATUS_CK_ERROR;
-                }
-
-                int n             = pSolution->problemDim();
-                auto flops        = std::size_t(2) * n;
-                auto bytes        = pSolution->problemBytes();
-
-                hiptensor::PerfMetrics metrics = {
-                    pSolution->uid(), // id
-                    pSolution->kernelName(), // name
-                    time, // avg time
-                    static_cast<float>(flops) / static_cast<float>(1.E9) / time, // tflops
-                    static_cast<float>(bytes) / static_cast<float>(1.E6) / time // BW
-                };
-
-                // log perf metrics (not name/id)
-                snprintf(msg,
-                        sizeof(msg),
-                        "KernelId: %lu KernelName: %s, %0.3f ms, %0.3f TFlops, %0.3f GB/s",
-                        metrics.mKernelUid,
-                        metrics.mKernelName.c_str(),
-                        metrics.mAvgTimeMs,
-                        metrics.mTflops,
-                        metrics.mBandwidth);
-                logger->logPerformanceTrace("hiptensorPermutation", msg);
-            }
-            // Perform permutation without timing
-            else
-            {
-                if((*pSolution)(StreamConfig{stream, false}) < 0)
-                {
-                    return HIPTENSOR_STATUS_CK_ERROR;
-                }
-            }
-
-            return HIPTENSOR_STATUS_SUCCESS;
-        }
+        snprintf(msg,
+                 sizeof(msg),
+                 "Selected kernel is unable to solve the problem (%s)",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorPermutationExecute", msg);
     }
-
-    auto errorCode = HIPTENSOR_STATUS_INTERNAL_ERROR;
-    snprintf(msg,
-                sizeof(msg),
-                "Selected kernel is unable to solve the problem (%s)",
-                hiptensorGetErrorString(errorCode));
-    logger->logError("hiptensorPermutation", msg);
     return errorCode;
 }
@@ -63,19 +63,21 @@ hiptensorStatus_t hiptensorPermutationReference(const hiptensorHandle_t*
     auto candidateSol = toPermutationSolutionVec(candidates.solutions());
     for(int i = 0; i < candidateSol.size(); i++)
     {
-        auto refCandidate = candidateSol[i];
-        if(refCandidate->initArgs(alpha,
-                                    A,
-                                    B,
-                                    descA->mLengths,
-                                    descA->mStrides,
-                                    modeA,
-                                    descB->mLengths,
-                                    descB->mStrides,
-                                    modeB,
-                                    typeScalar))
+        auto                       refCandidate = candidateSol[i];
+        hiptensor::PermutationArgs args;
+        if(refCandidate->initArgs(args,
+                                  alpha,
+                                  A,
+                                  B,
+                                  descA->mLengths,
+                                  descA->mStrides,
+                                  modeA,
+                                  descB->mLengths,
+                                  descB->mStrides,
+                                  modeB,
+                                  typeScalar))
         {
-            (*refCandidate)();
+            (*refCandidate)(args);
             return HIPTENSOR_STATUS_SUCCESS;
         }
     }
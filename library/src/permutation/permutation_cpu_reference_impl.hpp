@@ -132,10 +132,15 @@ namespace hiptensor
                         return false;
                     };
 
-                    auto bOffset = std::inner_product(
-                         indices.rbegin(), indices.rend(), std::rbegin(arg.mOutStrides[0]), 0);
-                    auto aOffset = std::inner_product(
-                         indices.rbegin(), indices.rend(), std::rbegin(arg.mInStrides[0]), 0);
+                    // Strides may be padded, so offsets can exceed the element count
+                    auto bOffset = std::inner_product(indices.rbegin(),
+                                                      indices.rend(),
+                                                      std::rbegin(arg.mOutStrides[0]),
+                                                      int64_t(0));
+                    auto aOffset = std::inner_product(indices.rbegin(),
+                                                      indices.rend(),
+                                                      std::rbegin(arg.mInStrides[0]),
+                                                      int64_t(0));
                     nextIndex();
 
                     // Perform sequence of unary, scale operations on input
@@ -28,26 +28,62 @@
 
 namespace hiptensor
 {
+    bool PermutationArgs::LaunchData::operator==(LaunchData const& other) const
+    {
+        return mA == other.mA && mB == other.mB && mAlpha == other.mAlpha;
+    }
+
+    PermutationArgs::PermutationArgs()
+        : mElements(0)
+        , mBytes(0)
+        , mTypeScalar(HIP_R_32F)
+        , mValid(false)
+        , mLaunchData{}
+    {
+    }
+
+    PermutationArgs::LaunchData
+        PermutationArgs::launchData(void const* alpha, void const* A, void const* B) const
+    {
+        // Note: CK ALWAYS uses float for alpha in permutation
+        float alphaF = 0.0f;
+        if(alpha != nullptr)
+        {
+            alphaF = hiptensor::readVal<float>(alpha, convertToComputeType(mTypeScalar));
+        }
+        return {A, B, alphaF};
+    }
+
+    void PermutationArgs::reset()
+    {
+        mElements   = 0;
+        mBytes      = 0;
+        mTypeScalar = HIP_R_32F;
+
+        mLengths.clear();
+        mAStrides.clear();
+        mBStrides.clear();
+
+        mInvokerArgPtr.reset(nullptr);
+        mInvokerPtr.reset(nullptr);
+        mLaunchData = {};
+
+        mValid = false;
+    }
 
     PermutationSolution::PermutationSolution(
         std::unique_ptr<ck::tensor_operation::device::BaseOperator>&& deviceOp,
         std::unique_ptr<PermutationSolutionParams>&&                  params)
-        : mDim(0)
-        , mBytes(0)
-        , mValid(false)
+        : mThreadDim(1)
         , mDeviceOp(std::move(deviceOp))
         , mParams(std::move(params))
     {
     }
 
     PermutationSolution::PermutationSolution(PermutationSolution&& other)
-        : mDim(other.mDim)
-        , mBytes(other.mBytes)
-        , mValid(other.mValid)
+        : mThreadDim(other.mThreadDim)
         , mDeviceOp(std::move(other.mDeviceOp))
         , mParams(std::move(other.mParams))
-        , mInvokerArgPtr(std::move(other.mInvokerArgPtr))
-        , mInvokerPtr(std::move(other.mInvokerPtr))
     {
     }
 
@@ -55,30 +91,34 @@ namespace hiptensor
     {
         if(this != &other)
         {
-            mDim = other.mDim;
-
-            mBytes = other.mBytes;
-            mValid = other.mValid;
-
-            mParams        = std::move(other.mParams);
-            mDeviceOp      = std::move(other.mDeviceOp);
-            mInvokerArgPtr = std::move(other.mInvokerArgPtr);
-            mInvokerPtr    = std::move(other.mInvokerPtr);
+            mThreadDim = other.mThreadDim;
+            mParams    = std::move(other.mParams);
+            mDeviceOp  = std::move(other.mDeviceOp);
         }
         return *this;
     }
 
-    float PermutationSolution::operator()(StreamConfig const& streamConfig /*= StreamConfig{}*/)
+    float PermutationSolution::operator()(PermutationArgs const& args,
+                                          StreamConfig const&    streamConfig) const
     {
-        if(!mInvokerArgPtr || !mInvokerPtr || !mParams)
+        if(!args.mValid || !args.mInvokerArgPtr || !args.mInvokerPtr)
         {
 #if !NDEBUG
-            std::cout << mDeviceOp->GetTypeString() << " is not initialized" << std::endl;
+            std::cout << kernelName() << " does not support this problem" << std::endl;
 #endif // !NDEBUG
             return -1.0f;
         }
 
-        if(!mValid)
+        return args.mInvokerPtr->Run(args.mInvokerArgPtr.get(), streamConfig);
+    }
+
+    float PermutationSolution::operator()(PermutationArgs const& args,
+                                          void const*            alpha,
+                                          void const*            A,
+                                          void*                  B,
+                                          StreamConfig const&    streamConfig) const
+    {
+        if(!args.mValid || !args.mInvokerPtr)
         {
 #if !NDEBUG
             std::cout << kernelName() << " does not support this problem" << std::endl;
@@ -86,7 +126,22 @@ namespace hiptensor
             return -1.0f;
         }
 
-        return mInvokerPtr->Run(mInvokerArgPtr.get(), streamConfig);
+        auto data = args.launchData(alpha, A, B);
+
+        // Concurrent launches of the same args fall back to a call-local argument
+        std::unique_lock<std::mutex> lock(args.mLaunchMutex, std::try_to_lock);
+        if(lock.owns_lock())
+        {
+            if(args.mInvokerArgPtr == nullptr || !(args.mLaunchData == data))
+            {
+                args.mInvokerArgPtr = makeArgument(args, alpha, A, B);
+                args.mLaunchData    = data;
+            }
+            return args.mInvokerPtr->Run(args.mInvokerArgPtr.get(), streamConfig);
+        }
+
+        auto argument = makeArgument(args, alpha, A, B);
+        return args.mInvokerPtr->Run(argument.get(), streamConfig);
     }
 
     float PermutationSolution::operator()(void const*                     alpha,
@@ -99,10 +154,20 @@ namespace hiptensor
                                           std::vector<std::size_t> const& b_strides,
                                           const int32_t                   modeB[],
                                           const hipDataType               typeScalar,
-                                          StreamConfig const&             streamConfig)
+                                          StreamConfig const&             streamConfig) const
     {
-        if(!initArgs(
-               alpha, A, B, a_lengths, a_strides, modeA, b_lengths, b_strides, modeB, typeScalar))
+        PermutationArgs args;
+        if(!initArgs(args,
+                     alpha,
+                     A,
+                     B,
+                     a_lengths,
+                     a_strides,
+                     modeA,
+                     b_lengths,
+                     b_strides,
+                     modeB,
+                     typeScalar))
         {
 #if !NDEBUG
             std::cout << kernelName() << " does not support this problem" << std::endl;
@@ -110,12 +175,7 @@ namespace hiptensor
             return -1.0f;
         }
 
-        return mInvokerPtr->Run(mInvokerArgPtr.get(), streamConfig);
-    }
-
-    bool PermutationSolution::isValid() const
-    {
-        return mValid;
+        return (*this)(args, streamConfig);
     }
 
     std::unique_ptr<PermutationSolutionParams> const& PermutationSolution::params() const
@@ -137,26 +197,16 @@ namespace hiptensor
         return mThreadDim;
     }
 
-    ck::index_t PermutationSolution::problemDim() const
-    {
-        return mDim;
-    }
-
-    ck::index_t PermutationSolution::problemBytes() const
-    {
-        return mBytes;
-    }
-
     std::string PermutationSolution::kernelName() const
     {
         return mDeviceOp->GetTypeString();
     }
 
-    size_t PermutationSolution::workspaceSize() const
+    size_t PermutationSolution::workspaceSize(PermutationArgs const& args) const
     {
-        if(mValid)
+        if(args.mValid)
         {
-            return mDeviceOp->GetWorkSpaceSize(mInvokerArgPtr.get());
+            return mDeviceOp->GetWorkSpaceSize(args.mInvokerArgPtr.get());
         }
         else
         {
@@ -164,15 +214,4 @@ namespace hiptensor
         }
     }
 
-    void PermutationSolution::resetArgs()
-    {
-        mDim   = 0;
-        mBytes = 0;
-
-        mInvokerArgPtr.reset(nullptr);
-        mInvokerPtr.reset(nullptr);
-
-        mValid = false;
-    }
-
 } // namespace hiptensor
@@ -29,6 +29,7 @@
 
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <tuple>
 #include <vector>
 
@@ -43,6 +44,51 @@
 
 namespace hiptensor
 {
+    // Kernel arguments and invoker for one permutation problem.
+    // These are owned by the caller rather than the solution, so that a single
+    // solution can serve several plans and threads.
+    struct PermutationArgs
+    {
+        // Data pointers and alpha that a kernel argument was made for
+        struct LaunchData
+        {
+            void const* mA;
+            void const* mB;
+            float       mAlpha;
+
+            bool operator==(LaunchData const& other) const;
+        };
+
+        PermutationArgs();
+        ~PermutationArgs()                                 = default;
+        PermutationArgs(PermutationArgs const&)            = delete;
+        PermutationArgs& operator=(PermutationArgs const&) = delete;
+
+        LaunchData launchData(void const* alpha, void const* A, void const* B) const;
+
+        void reset();
+
+        // Derived runtime arguments
+        ck::index_t mElements;
+        ck::index_t mBytes;
+        hipDataType mTypeScalar;
+
+        // Arguments were accepted by the kernel
+        bool mValid;
+
+        // Problem in CK index format, kept so that the kernel
+        // argument can be re-made for new data pointers and alpha.
+        std::vector<ck::index_t> mLengths, mAStrides, mBStrides;
+
+        // Kernel argument of the last launch and the data it was made for.
+        // Guarded by mLaunchMutex.
+        mutable std::unique_ptr<ck::tensor_operation::device::BaseArgument> mInvokerArgPtr;
+        mutable LaunchData                                                  mLaunchData;
+        mutable std::mutex                                                  mLaunchMutex;
+
+        std::unique_ptr<ck::tensor_operation::device::BaseInvoker> mInvokerPtr;
+    };
+
     class PermutationSolution
     {
     public:
@@ -61,8 +107,10 @@ namespace hiptensor
         PermutationSolution(PermutationSolution&& other);
         PermutationSolution& operator=(PermutationSolution&& other);
 
-        // Must specialize incoming arg handling
-        virtual bool initArgs(void const*                     alpha,
+        // Must specialize incoming arg handling.
+        // Results are written to args only: the solution itself is not modified.
+        virtual bool initArgs(PermutationArgs&                args,
+                              void const*                     alpha,
                               void const*                     A,
                               void*                           B,
                               std::vector<std::size_t> const& a_lengths,
@@ -71,11 +119,31 @@ namespace hiptensor
                               std::vector<std::size_t> const& b_lengths,
                               std::vector<std::size_t> const& b_strides,
                               const int32_t                   modeB[],
-                              const hipDataType               typeScalar)
+                              const hipDataType               typeScalar) const
+            = 0;
+
+        // Makes a kernel argument for previously initialized args with new data
+        // pointers and alpha.
+        virtual std::unique_ptr<ck::tensor_operation::device::BaseArgument>
+            makeArgument(PermutationArgs const& args,
+                         void const*            alpha,
+                         void const*            A,
+                         void*                  B) const
             = 0;
 
-        float operator()(StreamConfig const& streamConfig = StreamConfig{});
+        // Launch previously initialized args as they are
+        float operator()(PermutationArgs const& args,
+                         StreamConfig const&    streamConfig = StreamConfig{}) const;
+
+        // Patch data pointers and alpha into previously initialized args and launch.
+        // The kernel argument is only re-made if they differ from the previous launch.
+        float operator()(PermutationArgs const& args,
+                         void const*            alpha,
+                         void const*            A,
+                         void*                  B,
+                         StreamConfig const&    streamConfig = StreamConfig{}) const;
 
+        // Initialize call-local args and launch
         float operator()(void const*                     alpha,
                          void const*                     A,
                          void*                           B,
@@ -86,13 +154,10 @@ namespace hiptensor
                          std::vector<std::size_t> const& b_strides,
                          const int32_t                   modeB[],
                          const hipDataType               typeScalar,
-                         StreamConfig const&             streamConfig = StreamConfig{});
+                         StreamConfig const&             streamConfig = StreamConfig{}) const;
 
         /// Accessors
 
-        // Problem can be solved with this kernel
-        bool isValid() const;
-
         // Run-time solution parameters
         std::unique_ptr<PermutationSolutionParams> const& params() const;
 
@@ -102,33 +167,19 @@ namespace hiptensor
         // Get Number of threads across dimension
         uint32_t threadDim() const;
 
-        // Problem dimension
-        ck::index_t problemDim() const;
-
-        // Byte count
-        ck::index_t problemBytes() const;
-
         // Kernel's name encoding
         std::string kernelName() const;
 
         // Kernel's required workspace size
-        size_t workspaceSize() const;
-
-        // Reset all arguments
-        void resetArgs();
+        size_t workspaceSize(PermutationArgs const& args) const;
 
     protected:
-        // Derived runtime arguments
-        ck::index_t mDim;
-        ck::index_t mBytes;
-        bool        mValid;
-        uint32_t    mThreadDim;
+        // Launch configuration, known at construction
+        uint32_t mThreadDim;
 
         // Kernel Params
         std::unique_ptr<PermutationSolutionParams>                  mParams;
         std::unique_ptr<ck::tensor_operation::device::BaseOperator> mDeviceOp;
-        std::unique_ptr<ck::tensor_operation::device::BaseArgument> mInvokerArgPtr;
-        std::unique_ptr<ck::tensor_operation::device::BaseInvoker>  mInvokerPtr;
     };
 
     template <typename InDataTypeTuple,
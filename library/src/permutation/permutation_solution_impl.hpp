@@ -58,9 +58,12 @@ namespace hiptensor
             : PermutationSolution(std::move(deviceOp),
                                   std::make_unique<PermutationSolutionParamsImpl<DeviceOp>>())
         {
+            // Registration hashes the thread dim, so it must be known up front
+            mThreadDim = findThreadDim(mDeviceOp->GetTypeString());
         }
 
-        bool initArgs(void const*                     alpha,
+        bool initArgs(PermutationArgs&                args,
+                      void const*                     alpha,
                       void const*                     A,
                       void*                           B,
                       std::vector<std::size_t> const& a_lengths,
@@ -69,97 +72,119 @@ namespace hiptensor
                       std::vector<std::size_t> const& b_lengths,
                       std::vector<std::size_t> const& b_strides,
                       const int32_t                   modeB[],
-                      const hipDataType               typeScalar) override
+                      const hipDataType               typeScalar) const override
         {
             using Base   = PermutationSolution;
             using Traits = MetaTraits<DeviceOp>;
 
             // Clear out the previous arguments
-            resetArgs();
+            args.reset();
 
             // Promote to derived class for necessary functions such as
             // MakeArgumentPointer and MakeInvokerPointer.
             auto* deviceOp = dynamic_cast<DeviceOp*>(Base::mDeviceOp.get());
             if(deviceOp == nullptr)
             {
-                return 0;
+                return false;
             }
 
-            auto findThreadDim = [](std::string argValues) -> uint32_t {
-                if(!argValues.empty())
-                {
-                    std::string kernelName = argValues.substr(0, argValues.find('<'));
-                    if(kernelName == "DeviceElementwiseImpl"
-                       || kernelName == "ReferencePermutation")
-                    {
-                        int beg = argValues.find(',');
-                        int end = argValues.find(',', beg + 1);
-                        return std::stoi(argValues.substr(beg + 1, end - beg));
-                    }
-                }
-                return 1;
-            };
-
-            // Note: CK ALWAYS uses float for alpha in permutation
-            float alphaF;
-            if(alpha != nullptr)
+            // Honor the given strides, padded ones included. Packed otherwise.
+            auto aStrides = a_strides.empty()
+                                ? hiptensor::stridesFromLengths(a_lengths,
+                                                                HIPTENSOR_DATA_LAYOUT_COL_MAJOR)
+                                : a_strides;
+            auto bStrides = b_strides.empty()
+                                ? hiptensor::stridesFromLengths(b_lengths,
+                                                                HIPTENSOR_DATA_LAYOUT_COL_MAJOR)
+                                : b_strides;
+            if(aStrides.size() != Traits::NDim || bStrides.size() != Traits::NDim)
             {
-                alphaF = hiptensor::readVal<float>(alpha, convertToComputeType(typeScalar));
+                return false;
             }
 
-            // CK has its own format for indices...
-            auto toCKArr
-                = [](std::vector<std::size_t> const& v, std::array<ck::index_t, Traits::NDim>& a) {
-                      std::copy_n(v.begin(), Traits::NDim, a.begin());
-                  };
-
-            // Re-construct strides from lengths, assuming packed.
-            std::array<ck::index_t, Traits::NDim> aStrides, bStrides, bStridesCk, abLengths;
-
             std::map<char, ck::index_t> modeAToIndex;
             for(int i = 0; i < Traits::NDim; i++)
             {
                 modeAToIndex[modeA[i]] = i;
             }
 
-            toCKArr(hiptensor::stridesFromLengths(a_lengths, HIPTENSOR_DATA_LAYOUT_COL_MAJOR),
-                    aStrides);
-            toCKArr(hiptensor::stridesFromLengths(b_lengths, HIPTENSOR_DATA_LAYOUT_COL_MAJOR),
-                    bStrides);
+            // CK has its own format for indices...
+            args.mLengths  = std::vector<ck::index_t>(a_lengths.begin(), a_lengths.end());
+            args.mAStrides = std::vector<ck::index_t>(aStrides.begin(), aStrides.end());
+            args.mBStrides = std::vector<ck::index_t>(Traits::NDim);
             for(int i = 0; i < Traits::NDim; i++)
             {
-                bStridesCk[modeAToIndex[modeB[i]]] = bStrides[i];
+                args.mBStrides[modeAToIndex[modeB[i]]] = bStrides[i];
             }
 
-            toCKArr(a_lengths, abLengths);
-
             // Initialize the argument pointer
-            Base::mInvokerArgPtr = std::move(deviceOp->MakeArgumentPointer(
-                abLengths,
-                {aStrides},
-                {bStridesCk},
-                {A},
-                {B},
-                typename Traits::CombinedOp{typename Traits::AOp{},
-                                            typename Traits::ScaleOp{alphaF},
-                                            typename Traits::BOp{}}));
+            args.mTypeScalar    = typeScalar;
+            args.mInvokerArgPtr = makeArgument(args, alpha, A, B);
+            args.mLaunchData    = args.launchData(alpha, A, B);
 
             // Initialize the invoker
-            Base::mInvokerPtr = std::move(deviceOp->MakeInvokerPointer());
+            args.mInvokerPtr = std::move(deviceOp->MakeInvokerPointer());
 
             // Fill problem metrics
-            Base::mDim = Traits::NDim;
+            args.mElements = hiptensor::elementsFromLengths(args.mLengths);
 
             // Byte count
-            Base::mBytes = sizeof(typename Traits::InDataT) * Base::mDim
-                           + sizeof(typename Traits::OutDataT) * Base::mDim;
+            args.mBytes = sizeof(typename Traits::InDataT) * args.mElements
+                          + sizeof(typename Traits::OutDataT) * args.mElements;
 
             // Arg test
-            Base::mValid = deviceOp->IsSupportedArgument(Base::mInvokerArgPtr.get());
+            args.mValid = deviceOp->IsSupportedArgument(args.mInvokerArgPtr.get());
+            if(!args.mValid)
+            {
+                args.reset();
+            }
 
-            Base::mThreadDim = findThreadDim(deviceOp->GetTypeString());
+            return args.mValid;
+        }
 
-            return mValid;
+        std::unique_ptr<ck::tensor_operation::device::BaseArgument>
+            makeArgument(PermutationArgs const& args,
+                         void const*            alpha,
+                         void const*            A,
+                         void*                  B) const override
+        {
+            using Base   = PermutationSolution;
+            using Traits = MetaTraits<DeviceOp>;
+
+            auto* deviceOp = dynamic_cast<DeviceOp*>(Base::mDeviceOp.get());
+
+            auto toCKArr = [](std::vector<ck::index_t> const& v) {
+                std::array<ck::index_t, Traits::NDim> a;
+                std::copy_n(v.begin(), Traits::NDim, a.begin());
+                return a;
+            };
+
+            return deviceOp->MakeArgumentPointer(
+                toCKArr(args.mLengths),
+                {toCKArr(args.mAStrides)},
+                {toCKArr(args.mBStrides)},
+                {A},
+                {B},
+                typename Traits::CombinedOp{typename Traits::AOp{},
+                                            typename Traits::ScaleOp{
+                                                args.launchData(alpha, A, B).mAlpha},
+                                            typename Traits::BOp{}});
+        }
+
+    private:
+        static uint32_t findThreadDim(std::string const& argValues)
+        {
+            if(!argValues.empty())
+            {
+                std::string kernelName = argValues.substr(0, argValues.find('<'));
+                if(kernelName == "DeviceElementwiseImpl" || kernelName == "ReferencePermutation")
+                {
+                    int beg = argValues.find(',');
+                    int end = argValues.find(',', beg + 1);
+                    return std::stoi(argValues.substr(beg + 1, end - beg));
+                }
+            }
+            return 1;
         }
     };
 
@@ -0,0 +1,167 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <algorithm>
+
+#include "plan_cache.hpp"
+
+namespace hiptensor
+{
+    namespace
+    {
+        bool equal(hiptensorTensorDescriptor_t const& lhs, hiptensorTensorDescriptor_t const& rhs)
+        {
+            return lhs.mType == rhs.mType && lhs.mLengths == rhs.mLengths
+                   && lhs.mStrides == rhs.mStrides && lhs.mUnaryOp == rhs.mUnaryOp;
+        }
+
+        bool equal(hiptensorContractionDescriptor_t const& lhs,
+                   hiptensorContractionDescriptor_t const& rhs)
+        {
+            return lhs.mContractionOpId == rhs.mContractionOpId
+                   && lhs.mComputeType == rhs.mComputeType
+                   && std::equal(lhs.mTensorDesc.cbegin(),
+                                 lhs.mTensorDesc.cend(),
+                                 rhs.mTensorDesc.cbegin(),
+                                 rhs.mTensorDesc.cend(),
+                                 [](auto const& l, auto const& r) { return equal(l, r); })
+                   && lhs.mAlignmentReq == rhs.mAlignmentReq
+                   && lhs.mTensorMode == rhs.mTensorMode;
+        }
+    }
+
+    bool PlanCache::Signature::operator==(Signature const& other) const
+    {
+        return mAlgo == other.mAlgo && mWorkspaceSize == other.mWorkspaceSize
+               && mBackend == other.mBackend && equal(mDesc, other.mDesc);
+    }
+
+    PlanCache::Key PlanCache::hash(Signature const& signature)
+    {
+        return Hash{}(
+            signature.mDesc, signature.mAlgo, signature.mWorkspaceSize, signature.mBackend);
+    }
+
+    PlanCache::PlanCache(uint32_t capacity /*= DefaultCapacity*/)
+        : mCapacity(capacity)
+        , mHits(0)
+        , mMisses(0)
+        , mEvictions(0)
+    {
+    }
+
+    bool PlanCache::lookup(Key key, Signature const& signature, void** solution)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        auto it = mLookup.find(key);
+        if(it == mLookup.end() || !(it->second->mSignature == signature))
+        {
+            mMisses++;
+            return false;
+        }
+
+        // Move to front
+        mEntries.splice(mEntries.begin(), mEntries, it->second);
+        *solution = it->second->mSolution;
+        mHits++;
+        return true;
+    }
+
+    void PlanCache::insert(Key key, Signature const& signature, void* solution)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        if(mCapacity == 0u)
+        {
+            return;
+        }
+
+        // A colliding problem takes over the slot
+        if(auto it = mLookup.find(key); it != mLookup.end())
+        {
+            it->second->mSignature = signature;
+            it->second->mSolution  = solution;
+            mEntries.splice(mEntries.begin(), mEntries, it->second);
+            return;
+        }
+
+        evict(mCapacity - 1u);
+        mEntries.push_front({key, signature, solution});
+        mLookup[key] = mEntries.begin();
+    }
+
+    void PlanCache::clear()
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mEntries.clear();
+        mLookup.clear();
+    }
+
+    void PlanCache::resize(uint32_t capacity)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mCapacity = capacity;
+        evict(mCapacity);
+    }
+
+    uint32_t PlanCache::capacity() const
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return mCapacity;
+    }
+
+    uint32_t PlanCache::size() const
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return (uint32_t)mEntries.size();
+    }
+
+    hiptensorPlanCacheStats_t PlanCache::stats() const
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return {mHits, mMisses, mEvictions, (uint32_t)mEntries.size(), mCapacity};
+    }
+
+    void PlanCache::resetStats()
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mHits      = 0;
+        mMisses    = 0;
+        mEvictions = 0;
+    }
+
+    void PlanCache::evict(uint32_t capacity)
+    {
+        while(mEntries.size() > capacity)
+        {
+            mLookup.erase(mEntries.back().mKey);
+            mEntries.pop_back();
+            mEvictions++;
+        }
+    }
+
+} // namespace hiptensor
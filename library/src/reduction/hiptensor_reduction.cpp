@@ -23,6 +23,9 @@
  * THE SOFTWARE.
  *
  *******************************************************************************/
+#include <algorithm>
+#include <chrono>
+#include <cstring>
 #include <hiptensor/hiptensor.hpp>
 #include <set>
 #include <unordered_set>
@@ -30,6 +33,9 @@
 #include "handle.hpp"
 #include "hip_device.hpp"
 #include "logger.hpp"
+#include "memory_pool.hpp"
+#include "mode_coalescing.hpp"
+#include "perf_stats.hpp"
 
 #include "ck/ck.hpp"
 #include "ck/library/reference_tensor_operation/cpu/reference_reduce.hpp"
@@ -45,6 +51,7 @@
 #include "ck/library/utility/host_tensor_generator.hpp"
 #include "ck/utility/reduction_enums.hpp"
 
+#include "reduction_cpu_reference_instances.hpp"
 #include "reduction_solution.hpp"
 #include "reduction_solution_instances.hpp"
 #include "reduction_solution_registry.hpp"
@@ -54,6 +61,61 @@ using namespace ck::tensor_operation::device;
 
 namespace
 {
+    // Checks the data types and modes shared by all reduction entry points
+    hiptensorStatus_t checkReductionProblem(char const*                        apiName,
+                                            const hiptensorTensorDescriptor_t* descA,
+                                            const int32_t*                     modeA,
+                                            const hiptensorTensorDescriptor_t* descC,
+                                            const int32_t*                     modeC,
+                                            const hiptensorTensorDescriptor_t* descD,
+                                            hiptensorComputeType_t             typeCompute)
+    {
+        using hiptensor::Logger;
+        auto& logger = Logger::instance();
+        char  msg[2048];
+
+        const hiptensor::Hash            hashGenerator;
+        const std::unordered_set<size_t> supportedTypes = {
+            hashGenerator(HIP_R_16F, HIP_R_16F, HIP_R_16F, HIPTENSOR_COMPUTE_16F),
+            hashGenerator(HIP_R_16F, HIP_R_16F, HIP_R_16F, HIPTENSOR_COMPUTE_32F),
+            hashGenerator(HIP_R_16BF, HIP_R_16BF, HIP_R_16BF, HIPTENSOR_COMPUTE_16BF),
+            hashGenerator(HIP_R_16BF, HIP_R_16BF, HIP_R_16BF, HIPTENSOR_COMPUTE_32F),
+            hashGenerator(HIP_R_32F, HIP_R_32F, HIP_R_32F, HIPTENSOR_COMPUTE_32F),
+            hashGenerator(HIP_R_64F, HIP_R_64F, HIP_R_64F, HIPTENSOR_COMPUTE_64F),
+        };
+
+        if(supportedTypes.find(hashGenerator(descA->mType, descC->mType, descD->mType, typeCompute))
+           == supportedTypes.end())
+        {
+            auto errorCode = HIPTENSOR_STATUS_NOT_SUPPORTED;
+            snprintf(msg,
+                     sizeof(msg),
+                     "Unsupported Data Type Error : The combination of data types of A, C and D "
+                     "and compute type is not supported. (%s)",
+                     hiptensorGetErrorString(errorCode));
+            logger->logError(apiName, msg);
+            return errorCode;
+        }
+
+        auto modeSetA = std::set(modeA, modeA + descA->mLengths.size());
+        auto modeSetC = std::set(modeC, modeC + descC->mLengths.size());
+        if(descA->mLengths.size() < descC->mLengths.size() || !(*descC == *descD)
+           || !std::includes(
+               modeSetA.cbegin(), modeSetA.cend(), modeSetC.cbegin(), modeSetC.cend()))
+        {
+            auto errorCode = HIPTENSOR_STATUS_NOT_SUPPORTED;
+            snprintf(msg,
+                     sizeof(msg),
+                     "Unsupported Data Error : The descriptor of C and D should be same and "
+                     " modes of C should be subset of modes A. (%s)",
+                     hiptensorGetErrorString(errorCode));
+            logger->logError(apiName, msg);
+            return errorCode;
+        }
+
+        return HIPTENSOR_STATUS_SUCCESS;
+    }
+
     hiptensorStatus_t checkReductionInputData(const hiptensorHandle_t*           handle,
                                               const void*                        alpha,
                                               const void*                        A,
@@ -74,7 +136,6 @@ namespace
         // Log API access
         using hiptensor::Logger;
         auto& logger = Logger::instance();
-        char  msg[2048];
         if(!handle || !alpha || !A || !descA || !modeA || !beta || !descC || !D || !descD)
         {
             auto errorCode         = HIPTENSOR_STATUS_NOT_INITIALIZED;
@@ -126,42 +187,487 @@ namespace
             return errorCode;
         }
 
-        const hiptensor::Hash            hashGenerator;
-        const std::unordered_set<size_t> supportedTypes = {
-            hashGenerator(HIP_R_16F, HIP_R_16F, HIP_R_16F, HIPTENSOR_COMPUTE_16F),
-            hashGenerator(HIP_R_16F, HIP_R_16F, HIP_R_16F, HIPTENSOR_COMPUTE_32F),
-            hashGenerator(HIP_R_16BF, HIP_R_16BF, HIP_R_16BF, HIPTENSOR_COMPUTE_16BF),
-            hashGenerator(HIP_R_16BF, HIP_R_16BF, HIP_R_16BF, HIPTENSOR_COMPUTE_32F),
-            hashGenerator(HIP_R_32F, HIP_R_32F, HIP_R_32F, HIPTENSOR_COMPUTE_32F),
-            hashGenerator(HIP_R_64F, HIP_R_64F, HIP_R_64F, HIPTENSOR_COMPUTE_64F),
-        };
+        return checkReductionProblem(
+            "hiptensorReduction", descA, modeA, descC, modeC, descD, typeCompute);
+    }
 
-        if(supportedTypes.find(hashGenerator(descA->mType, descC->mType, descD->mType, typeCompute))
-           == supportedTypes.end())
+    // One reduction pass: D = alpha * reduce(A) + beta * D
+    struct ReductionProblem
+    {
+        std::vector<std::size_t> mALengths;
+        std::vector<std::size_t> mAStrides;
+        std::vector<int32_t>     mAModes;
+        std::vector<std::size_t> mDLengths;
+        std::vector<std::size_t> mDStrides;
+        std::vector<int32_t>     mDModes;
+        hipDataType              mTypeA;
+        hipDataType              mTypeD;
+
+        // Kept modes looped over outside of the kernels, for A above their rank
+        hiptensor::ModeSplit mSplit;
+    };
+
+    constexpr std::size_t ReductionMaxRank = 6;
+
+    // The problem as dispatched. Runs of kept or of reduced modes that are contiguous
+    // in memory are folded, so that it runs on kernels of lower rank, and the outer kept
+    // modes that the kernels still cannot hold are looped over.
+    ReductionProblem makeReductionProblem(const hiptensorTensorDescriptor_t* descA,
+                                          const int32_t*                     modeA,
+                                          const hiptensorTensorDescriptor_t* descD,
+                                          const int32_t*                     modeD)
+    {
+        std::vector<hiptensor::TensorOperand> operands
+            = {{*descA, {modeA, modeA + descA->mLengths.size()}},
+               {*descD, {modeD, modeD + descD->mLengths.size()}}};
+        hiptensor::coalesceModes(operands);
+
+        auto& a = operands[0];
+        auto& d = operands[1];
+
+        hiptensor::ModeSplit split;
+        while(a.mModes.size() > ReductionMaxRank)
         {
-            auto errorCode = HIPTENSOR_STATUS_NOT_SUPPORTED;
+            auto pos = hiptensor::outermostMode(a, [&d](int32_t mode) {
+                return std::find(d.mModes.cbegin(), d.mModes.cend(), mode) != d.mModes.cend();
+            });
+            if(pos < 0)
+            {
+                break;
+            }
+            hiptensor::splitMode(operands, split, a.mModes[pos]);
+        }
+
+        return {std::move(a.mDesc.mLengths),
+                std::move(a.mDesc.mStrides),
+                std::move(a.mModes),
+                std::move(d.mDesc.mLengths),
+                std::move(d.mDesc.mStrides),
+                std::move(d.mModes),
+                descA->mType,
+                descD->mType,
+                std::move(split)};
+    }
+
+    // A single pass reduces each element of D within one workgroup, which leaves most of
+    // the device idle when D is small and the reduced extent is large. A two-pass reduction
+    // splits the longest reduced mode of A in chunks: the first pass reduces every chunk
+    // into the workspace and the second pass reduces the chunks into D. The partial results
+    // are kept in the compute type, so that only D is rounded to a 16-bit type.
+    constexpr std::size_t TwoPassMinReduceLength = 1u << 16;
+    constexpr std::size_t TwoPassMinChunkLength  = 1u << 12;
+    constexpr std::size_t TwoPassTargetRows      = 1u << 12;
+
+    struct TwoPassReduction
+    {
+        // A with the chunk mode appended, reduced into the workspace
+        ReductionProblem mFirst;
+
+        // The workspace: the modes of D followed by the chunk mode, packed, reduced into D
+        ReductionProblem mSecond;
+
+        // Zero if a single pass is preferred or the problem cannot be split
+        uint64_t mWorkspaceSize = 0u;
+    };
+
+    TwoPassReduction makeTwoPassReduction(ReductionProblem const& problem)
+    {
+        TwoPassReduction plan;
+
+        // The first pass adds the chunk mode to A
+        auto const& lengths = problem.mALengths;
+        auto const& modesA  = problem.mAModes;
+        auto        rankA   = lengths.size();
+        if(rankA + 1 > ReductionMaxRank || !problem.mSplit.mLengths.empty())
+        {
+            return plan;
+        }
+
+        auto outputs = hiptensor::elementsFromLengths(problem.mDLengths);
+        if(outputs == 0 || outputs >= TwoPassTargetRows)
+        {
+            return plan;
+        }
+
+        auto reduceLength = hiptensor::elementsFromLengths(lengths) / outputs;
+        if(reduceLength < TwoPassMinReduceLength)
+        {
+            return plan;
+        }
+
+        // Split the longest reduced mode
+        auto modeSetD = std::set(problem.mDModes.cbegin(), problem.mDModes.cend());
+        int  split    = -1;
+        for(int i = 0; i < int(rankA); i++)
+        {
+            if(modeSetD.count(modesA[i]) == 0 && (split < 0 || lengths[i] > lengths[split]))
+            {
+                split = i;
+            }
+        }
+        if(split < 0)
+        {
+            return plan;
+        }
+
+        // Largest divisor of the split extent that keeps the chunks long enough
+        auto extent = lengths[split];
+        auto chunks = std::min({TwoPassTargetRows / outputs,
+                                reduceLength / TwoPassMinChunkLength,
+                                extent});
+        while(chunks > 1 && extent % chunks != 0)
+        {
+            chunks--;
+        }
+        if(chunks < 2)
+        {
+            return plan;
+        }
+
+        auto chunkMode = *std::max_element(modesA.cbegin(), modesA.cend()) + 1;
+
+        auto& first            = plan.mFirst;
+        first                  = problem;
+        first.mALengths[split] = extent / chunks;
+        first.mALengths.push_back(chunks);
+        first.mAStrides.push_back(problem.mAStrides[split] * (extent / chunks));
+        first.mAModes.push_back(chunkMode);
+        first.mDLengths.push_back(chunks);
+        first.mDStrides = hiptensor::stridesFromLengths(first.mDLengths, true);
+        first.mDModes.push_back(chunkMode);
+
+        // 16-bit types are reduced in f32
+        auto typePartial = problem.mTypeD == HIP_R_16F || problem.mTypeD == HIP_R_16BF
+                               ? HIP_R_32F
+                               : problem.mTypeD;
+        first.mTypeD     = typePartial;
+
+        auto& second     = plan.mSecond;
+        second           = problem;
+        second.mALengths = first.mDLengths;
+        second.mAStrides = first.mDStrides;
+        second.mAModes   = first.mDModes;
+        second.mTypeA    = typePartial;
+
+        plan.mWorkspaceSize = hiptensor::elementsFromLengths(first.mDLengths)
+                              * hiptensor::hipDataTypeSize(typePartial);
+        return plan;
+    }
+
+    // Loads are vectorized along the kept (0) or the reduced (1) modes of A. The
+    // preferred kernels vectorize along the mode of smallest stride, so that loads coalesce.
+    int32_t preferredSrcVectorDim(ReductionProblem const& problem)
+    {
+        int fastest = -1;
+        for(int i = 0; i < int(problem.mALengths.size()); i++)
+        {
+            if(problem.mALengths[i] > 1
+               && (fastest < 0 || problem.mAStrides[i] < problem.mAStrides[fastest]))
+            {
+                fastest = i;
+            }
+        }
+        if(fastest < 0)
+        {
+            return 0;
+        }
+
+        auto const& modesD = problem.mDModes;
+        auto        isKept = std::find(modesD.cbegin(), modesD.cend(), problem.mAModes[fastest])
+                      != modesD.cend();
+        return isKept ? 0 : 1;
+    }
+
+    // Validates the problem against the solutions of the handle's backend, preferred
+    // vector dimension first. The fastest one is kept when timing is requested,
+    // otherwise the first one supporting the problem.
+    hiptensorStatus_t
+        selectReductionSolution(char const*                                apiName,
+                                hiptensor::ReductionSolution**             winner,
+                                std::shared_ptr<hiptensor::ReductionArgs>& winnerArgs,
+                                float*                                     winnerTime,
+                                hiptensor::Handle*                         realHandle,
+                                ReductionProblem const&                    problem,
+                                hiptensorOperator_t                        opReduce,
+                                hiptensorComputeType_t                     typeCompute,
+                                bool                                       timed)
+    {
+        using hiptensor::Logger;
+        auto& logger = Logger::instance();
+        char  msg[512];
+
+        *winner     = nullptr;
+        *winnerTime = 0.0f;
+        winnerArgs.reset();
+
+        auto  isHost    = realHandle->getBackend() == HIPTENSOR_BACKEND_HOST;
+        auto* instances = isHost ? static_cast<hiptensor::ReductionSolutionRegistry*>(
+                              hiptensor::ReductionCpuReferenceInstances::instance().get())
+                                 : hiptensor::ReductionSolutionInstances::instance().get();
+        if(instances->solutionCount() == 0)
+        {
+            auto errorCode = HIPTENSOR_STATUS_INTERNAL_ERROR;
             snprintf(msg,
                      sizeof(msg),
-                     "Unsupported Data Type Error : The combination of data types of A, C and D "
-                     "and compute type is not supported. (%s)",
+                     "Internal Error : %s is empty (%s)",
+                     isHost ? "ReductionCpuReferenceInstances" : "ReductionSolutionInstances",
                      hiptensorGetErrorString(errorCode));
-            logger->logError("hiptensorReduction", msg);
+            logger->logError(apiName, msg);
             return errorCode;
         }
 
-        auto modeSetA = std::set(modeA, modeA + descA->mLengths.size());
-        auto modeSetC = std::set(modeC, modeC + descC->mLengths.size());
-        if(descA->mLengths.size() < descC->mLengths.size() || !(*descC == *descD)
-           || !std::includes(
-               modeSetA.cbegin(), modeSetA.cend(), modeSetC.cbegin(), modeSetC.cend()))
+        // CK does not support f16 or bf16 as compute type
+        if(typeCompute == HIPTENSOR_COMPUTE_16F || typeCompute == HIPTENSOR_COMPUTE_16BF)
         {
-            auto errorCode = HIPTENSOR_STATUS_NOT_SUPPORTED;
+            typeCompute = HIPTENSOR_COMPUTE_32F;
+        }
+
+        // Query reduction solutions for the correct reduction operation and type
+        auto rank      = int(problem.mALengths.size());
+        auto solutionQ = instances->querySolutions(problem.mTypeA,
+                                                   typeCompute,
+                                                   problem.mTypeD,
+                                                   rank,
+                                                   rank - int(problem.mDLengths.size()),
+                                                   opReduce,
+                                                   true, // @TODO hardcode
+                                                   false); // @TODO hardcode
+
+        std::vector<hiptensor::ReductionSolution*> candidates;
+        for(auto [_, pSolution] : solutionQ.solutions())
+        {
+            candidates.push_back(pSolution);
+        }
+        auto preferred = preferredSrcVectorDim(problem);
+        std::sort(candidates.begin(), candidates.end(), [preferred](auto* lhs, auto* rhs) {
+            return std::make_tuple(lhs->srcVectorDim() != preferred, lhs->uid())
+                   < std::make_tuple(rhs->srcVectorDim() != preferred, rhs->uid());
+        });
+
+        // Scratch tensors for timing the candidates
+        auto bytesA = hiptensor::elementSpaceFromLengths(problem.mALengths, problem.mAStrides)
+                      * hiptensor::hipDataTypeSize(problem.mTypeA);
+        auto bytesD = hiptensor::elementSpaceFromLengths(problem.mDLengths, problem.mDStrides)
+                      * hiptensor::hipDataTypeSize(problem.mTypeD);
+        hiptensor::ScopedBuffer bufferA(realHandle->getAllocator(), timed ? bytesA : 0);
+        hiptensor::ScopedBuffer bufferD(realHandle->getAllocator(), timed ? bytesD : 0);
+        if(!bufferA.valid() || !bufferD.valid())
+        {
+            return HIPTENSOR_STATUS_ALLOC_FAILED;
+        }
+
+        for(auto* solution : candidates)
+        {
+            auto args = std::make_shared<hiptensor::ReductionArgs>();
+            if(!solution->initArgs(*args,
+                                   problem.mALengths,
+                                   problem.mAStrides,
+                                   problem.mAModes,
+                                   problem.mDLengths,
+                                   problem.mDStrides,
+                                   problem.mDModes,
+                                   1.0,
+                                   0.0,
+                                   nullptr,
+                                   nullptr,
+                                   opReduce))
+            {
+                continue;
+            }
+
+            if(!timed)
+            {
+                *winner    = solution;
+                winnerArgs = std::move(args);
+                break;
+            }
+
+            auto time = (*solution)(
+                *args, 1.0, 0.0, bufferA.get(), bufferD.get(), StreamConfig{nullptr, true});
+            if(time > 0 && (*winner == nullptr || time < *winnerTime))
+            {
+                *winner     = solution;
+                winnerArgs  = std::move(args);
+                *winnerTime = time;
+            }
+        }
+
+        return *winner == nullptr ? HIPTENSOR_STATUS_INTERNAL_ERROR : HIPTENSOR_STATUS_SUCCESS;
+    }
+
+    // Launches the validated arguments, timing and recording the launch as configured.
+    hiptensorStatus_t launchReduction(char const*                         apiName,
+                                      bool                                isHost,
+                                      hiptensor::ReductionSolution const* pSolution,
+                                      hiptensor::ReductionArgs const&     args,
+                                      double                              alpha,
+                                      double                              beta,
+                                      void const*                         A,
+                                      void*                               D,
+                                      hipStream_t                         stream)
+    {
+        using hiptensor::Logger;
+        auto& logger = Logger::instance();
+
+        auto& perfStats   = hiptensor::PerfStats::instance();
+        auto  statsSample = [apiName, pSolution, &args]() {
+            auto lengthsA
+                = std::vector<std::size_t>(args.mInLengths.begin(), args.mInLengths.end());
+            auto lengthsD
+                = std::vector<std::size_t>(args.mOutLengths.begin(), args.mOutLengths.end());
+            auto problem = "A=" + hiptensor::PerfStats::lengthsString(lengthsA)
+                           + ",D=" + hiptensor::PerfStats::lengthsString(lengthsD);
+            return hiptensor::PerfStats::Sample{apiName,
+                                                pSolution->uid(),
+                                                pSolution->kernelName(),
+                                                problem,
+                                                2.0 * args.mDim,
+                                                static_cast<double>(args.mBytes)};
+        };
+
+        // Perform reduction with timing if LOG_LEVEL_PERF_TRACE
+        if(logger->getLogMask() & HIPTENSOR_LOG_LEVEL_PERF_TRACE)
+        {
+            auto start = std::chrono::steady_clock::now();
+            auto time  = (*pSolution)(args,
+                                     alpha,
+                                     beta,
+                                     A,
+                                     D,
+                                     StreamConfig{
+                                         stream, // stream id
+                                         true, // time_kernel
+                                         0, // log_level
+                                         0, // cold_niters
+                                         1, // nrepeat
+                                     });
+            if(time < 0)
+            {
+                return HIPTENSOR_STATUS_CK_ERROR;
+            }
+
+            // Host solutions run synchronously and are not timed by the invoker
+            if(isHost)
+            {
+                auto elapsed = std::chrono::steady_clock::now() - start;
+                time         = std::chrono::duration<float, std::milli>(elapsed).count();
+            }
+
+            auto flops = std::size_t(2) * args.mDim;
+            auto bytes = args.mBytes;
+
+            hiptensor::PerfMetrics metrics = {
+                pSolution->uid(), // id
+                pSolution->kernelName(), // name
+                time, // avg time
+                static_cast<float>(flops) / static_cast<float>(1.E9) / time, // tflops
+                static_cast<float>(bytes) / static_cast<float>(1.E6) / time // BW
+            };
+
+            // log perf metrics (not name/id)
+            char msg[2048];
             snprintf(msg,
                      sizeof(msg),
-                     "Unsupported Data Error : The descriptor of C and D should be same and "
-                     " modes of C should be subset of modes A. (%s)",
+                     "KernelId: %lu KernelName: %s, %0.3f ms, %0.3f TFlops, %0.3f GB/s",
+                     metrics.mKernelUid,
+                     metrics.mKernelName.c_str(),
+                     metrics.mAvgTimeMs,
+                     metrics.mTflops,
+                     metrics.mBandwidth);
+            logger->logPerformanceTrace(apiName, msg);
+
+            perfStats->record(statsSample(), time);
+        }
+        // Perform reduction without synchronous timing
+        else
+        {
+            auto timer = perfStats->startTimer(stream, isHost);
+            if((*pSolution)(args, alpha, beta, A, D, StreamConfig{stream, false}) < 0)
+            {
+                perfStats->cancelTimer(timer);
+                return HIPTENSOR_STATUS_CK_ERROR;
+            }
+
+            if(timer.mActive)
+            {
+                perfStats->stopTimer(timer, stream, statsSample());
+            }
+        }
+
+        return HIPTENSOR_STATUS_SUCCESS;
+    }
+
+    // Launches every iteration of the split, or the problem as a whole if there is none
+    hiptensorStatus_t launchReduction(char const*                         apiName,
+                                      bool                                isHost,
+                                      hiptensor::ReductionSolution const* pSolution,
+                                      hiptensor::ReductionArgs const&     args,
+                                      hiptensor::ModeSplit const*         split,
+                                      double                              alpha,
+                                      double                              beta,
+                                      void const*                         A,
+                                      void*                               D,
+                                      hipStream_t                         stream)
+    {
+        if(split == nullptr || split->mLengths.empty())
+        {
+            return launchReduction(apiName, isHost, pSolution, args, alpha, beta, A, D, stream);
+        }
+
+        for(std::size_t i = 0; i < split->count(); i++)
+        {
+            auto errorCode = launchReduction(apiName,
+                                             isHost,
+                                             pSolution,
+                                             args,
+                                             alpha,
+                                             beta,
+                                             split->at(A, 0, i),
+                                             split->at(D, 1, i),
+                                             stream);
+            if(errorCode != HIPTENSOR_STATUS_SUCCESS)
+            {
+                return errorCode;
+            }
+        }
+
+        return HIPTENSOR_STATUS_SUCCESS;
+    }
+
+    // CK API can only process $D = alpha * reduce(A) + beta * D$, so C must be in D
+    // before the kernel runs. With beta == 0, D is not read and no copy is needed.
+    hiptensorStatus_t copyReductionC(char const* apiName,
+                                     bool        isHost,
+                                     void const* C,
+                                     void*       D,
+                                     uint64_t    bytes,
+                                     double      beta,
+                                     hipStream_t stream)
+    {
+        if(!C || C == D || beta == 0.0)
+        {
+            return HIPTENSOR_STATUS_SUCCESS;
+        }
+
+        if(isHost)
+        {
+            std::memcpy(D, C, bytes);
+        }
+        // Ordered on the caller's stream ahead of the kernel: the host is not blocked
+        else if(auto status = hipMemcpyAsync(D, C, bytes, hipMemcpyDeviceToDevice, stream);
+                status != hipSuccess)
+        {
+            using hiptensor::Logger;
+            auto& logger = Logger::instance();
+            char  msg[512];
+
+            auto errorCode = HIPTENSOR_STATUS_HIP_ERROR;
+            snprintf(msg,
+                     sizeof(msg),
+                     "HIP Error : copying C to D failed with '%s' (%s)",
+                     hipGetErrorString(status),
                      hiptensorGetErrorString(errorCode));
-            logger->logError("hiptensorReduction", msg);
+            logger->logError(apiName, msg);
             return errorCode;
         }
 
@@ -191,30 +697,28 @@ hiptensorStatus_t hiptensorReduction(const hiptensorHandle_t*           handle,
     auto& logger = Logger::instance();
     char  msg[2048];
 
-    snprintf(msg,
-             sizeof(msg),
-             "hiptensorReduction: handle=%p, alpha=%p, A=%p, descA=%p, modeA=%p, beta=%p, C=%p, "
-             "descC=%p, modeC=%p, D=%p, descD=%p, modeD=%p, opReduce=%d, typeCompute=%d, "
-             "workspace=%p, workspaceSize=%lu, stream=%p",
-             handle,
-             alpha,
-             A,
-             descA,
-             modeA,
-             beta,
-             C,
-             descC,
-             modeC,
-             D,
-             descD,
-             modeD,
-             (int)opReduce,
-             (int)typeCompute,
-             workspace,
-             workspaceSize,
-             stream);
-
-    logger->logAPITrace("hiptensorReduction", msg);
+    logger->logAPITrace(
+        "hiptensorReduction",
+        "hiptensorReduction: handle=%p, alpha=%p, A=%p, descA=%p, modeA=%p, beta=%p, C=%p, "
+        "descC=%p, modeC=%p, D=%p, descD=%p, modeD=%p, opReduce=%d, typeCompute=%d, "
+        "workspace=%p, workspaceSize=%lu, stream=%p",
+        handle,
+        alpha,
+        A,
+        descA,
+        modeA,
+        beta,
+        C,
+        descC,
+        modeC,
+        D,
+        descD,
+        modeD,
+        (int)opReduce,
+        (int)typeCompute,
+        workspace,
+        workspaceSize,
+        stream);
 
     if(auto errorCode = checkReductionInputData(handle,
                                                 alpha,
@@ -237,141 +741,447 @@ hiptensorStatus_t hiptensorReduction(const hiptensorHandle_t*           handle,
         return errorCode;
     }
 
-    auto& instances = hiptensor::ReductionSolutionInstances::instance();
-    if(instances->solutionCount() == 0)
+    auto realHandle = hiptensor::Handle::toHandle((int64_t*)handle->fields);
+    auto isHost     = realHandle->getBackend() == HIPTENSOR_BACKEND_HOST;
+
+    double alphaD = hiptensor::readVal<double>(alpha, typeCompute);
+    double betaD  = hiptensor::readVal<double>(beta, typeCompute);
+
+    // descC == descD is checked above, so copying D's element space covers C
+    auto bytesD = hiptensor::elementSpaceFromLengths(descD->mLengths, descD->mStrides)
+                  * hiptensor::hipDataTypeSize(descD->mType);
+    if(auto errorCode
+       = copyReductionC("hiptensorReduction", isHost, C, D, bytesD, betaD, stream);
+       errorCode != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return errorCode;
+    }
+
+    hiptensor::ReductionSolution*             solutions[2] = {nullptr, nullptr};
+    std::shared_ptr<hiptensor::ReductionArgs> args[2];
+    float                                     time;
+
+    // Take the two-pass path only if the caller provides the workspace it needs
+    auto problem = makeReductionProblem(descA, modeA, descD, modeD);
+    auto twoPass = makeTwoPassReduction(problem);
+    if(twoPass.mWorkspaceSize > 0 && workspace && workspaceSize >= twoPass.mWorkspaceSize)
+    {
+        if(selectReductionSolution("hiptensorReduction",
+                                   &solutions[0],
+                                   args[0],
+                                   &time,
+                                   realHandle,
+                                   twoPass.mFirst,
+                                   opReduce,
+                                   typeCompute,
+                                   false)
+               != HIPTENSOR_STATUS_SUCCESS
+           || selectReductionSolution("hiptensorReduction",
+                                      &solutions[1],
+                                      args[1],
+                                      &time,
+                                      realHandle,
+                                      twoPass.mSecond,
+                                      opReduce,
+                                      typeCompute,
+                                      false)
+                  != HIPTENSOR_STATUS_SUCCESS)
+        {
+            solutions[0] = solutions[1] = nullptr;
+        }
+    }
+
+    hiptensorStatus_t errorCode;
+    if(solutions[1] != nullptr)
+    {
+        // Partial results of every chunk, ordered on the stream ahead of the second pass
+        errorCode = launchReduction("hiptensorReduction",
+                                    isHost,
+                                    solutions[0],
+                                    *args[0],
+                                    1.0,
+                                    0.0,
+                                    A,
+                                    workspace,
+                                    stream);
+        if(errorCode == HIPTENSOR_STATUS_SUCCESS)
+        {
+            errorCode = launchReduction("hiptensorReduction",
+                                        isHost,
+                                        solutions[1],
+                                        *args[1],
+                                        alphaD,
+                                        betaD,
+                                        workspace,
+                                        D,
+                                        stream);
+        }
+    }
+    else
+    {
+        errorCode = selectReductionSolution("hiptensorReduction",
+                                            &solutions[0],
+                                            args[0],
+                                            &time,
+                                            realHandle,
+                                            problem,
+                                            opReduce,
+                                            typeCompute,
+                                            false);
+        if(errorCode == HIPTENSOR_STATUS_SUCCESS)
+        {
+            errorCode = launchReduction("hiptensorReduction",
+                                        isHost,
+                                        solutions[0],
+                                        *args[0],
+                                        &problem.mSplit,
+                                        alphaD,
+                                        betaD,
+                                        A,
+                                        D,
+                                        stream);
+        }
+    }
+
+    if(errorCode == HIPTENSOR_STATUS_INTERNAL_ERROR)
     {
-        auto errorCode = HIPTENSOR_STATUS_INTERNAL_ERROR;
         snprintf(msg,
                  sizeof(msg),
-                 "Internal Error : ReductionSolutionInstances is empty (%s)",
+                 "No kernel is able to solve the problem (%s)",
                  hiptensorGetErrorString(errorCode));
         logger->logError("hiptensorReduction", msg);
+    }
+    return errorCode;
+}
+
+hiptensorStatus_t hiptensorInitReductionPlan(const hiptensorHandle_t*           handle,
+                                             hiptensorReductionPlan_t*          plan,
+                                             const hiptensorTensorDescriptor_t* descA,
+                                             const int32_t                      modeA[],
+                                             const hiptensorTensorDescriptor_t* descC,
+                                             const int32_t                      modeC[],
+                                             const hiptensorTensorDescriptor_t* descD,
+                                             const int32_t                      modeD[],
+                                             hiptensorOperator_t                opReduce,
+                                             hiptensorComputeType_t             typeCompute,
+                                             const hiptensorAlgo_t              algo,
+                                             uint64_t                           workspaceSizeLimit)
+{
+    using hiptensor::Logger;
+    auto& logger = Logger::instance();
+
+    // Log API access
+    char msg[2048];
+    logger->logAPITrace("hiptensorInitReductionPlan",
+                        "handle=%p, plan=%p, descA=%p, modeA=%p, descC=%p, modeC=%p, descD=%p, "
+                        "modeD=%p, opReduce=%d, typeCompute=%d, algo=%d, workspaceSizeLimit=%lu",
+                        handle,
+                        plan,
+                        descA,
+                        modeA,
+                        descC,
+                        modeC,
+                        descD,
+                        modeD,
+                        (int)opReduce,
+                        (int)typeCompute,
+                        (int)algo,
+                        workspaceSizeLimit);
+
+    if(!handle || !plan || !descA || !modeA || !descC || !descD)
+    {
+        auto errorCode = HIPTENSOR_STATUS_NOT_INITIALIZED;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Initialization Error : %s = nullptr (%s)",
+                 !handle  ? "handle"
+                 : !plan  ? "plan"
+                 : !descA ? "descA"
+                 : !modeA ? "modeA"
+                 : !descC ? "descC"
+                          : "descD",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorInitReductionPlan", msg);
         return errorCode;
     }
 
-    int  rankA        = descA->mLengths.size();
-    int  numReduceDim = descA->mLengths.size() - descD->mLengths.size();
-    auto ADataType    = descA->mType;
-    auto DDataType    = descD->mType;
+    if(algo != HIPTENSOR_ALGO_DEFAULT && algo != HIPTENSOR_ALGO_DEFAULT_PATIENT)
+    {
+        auto errorCode = HIPTENSOR_STATUS_INVALID_VALUE;
+        snprintf(msg, sizeof(msg), "Invalid Algo Value (%s)", hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorInitReductionPlan", msg);
+        return errorCode;
+    }
 
-    auto internalTypeCompute = typeCompute;
-    if(typeCompute == HIPTENSOR_COMPUTE_16F || typeCompute == HIPTENSOR_COMPUTE_16BF)
+    auto errorCode = checkReductionProblem(
+        "hiptensorInitReductionPlan", descA, modeA, descC, modeC, descD, typeCompute);
+    if(errorCode != HIPTENSOR_STATUS_SUCCESS)
     {
-        // CK does not support f16 or bf16 as compute type
-        internalTypeCompute = HIPTENSOR_COMPUTE_32F;
+        return errorCode;
     }
 
-    // Query reduction solutions for the correct reduction operation and type
-    auto solutionQ = instances->querySolutions(ADataType,
-                                               internalTypeCompute,
-                                               DDataType,
-                                               rankA,
-                                               numReduceDim,
-                                               opReduce,
-                                               true, // @TODO hardcode
-                                               false); // @TODO hardcode
+    auto realHandle = hiptensor::Handle::toHandle((int64_t*)handle->fields);
+    auto backend    = realHandle->getBackend();
 
-    if(solutionQ.solutionCount() == 0)
+    // Host solutions all run the same reference, so only device candidates are timed
+    bool timed = algo == HIPTENSOR_ALGO_DEFAULT_PATIENT && backend == HIPTENSOR_BACKEND_DEVICE;
+
+    // Two passes within the workspace limit, if the problem can be split
+    hiptensor::ReductionSolution*             twoPassSolutions[2] = {nullptr, nullptr};
+    std::shared_ptr<hiptensor::ReductionArgs> twoPassArgs[2];
+    float                                     twoPassTimes[2] = {0.0f, 0.0f};
+
+    auto problem = makeReductionProblem(descA, modeA, descD, modeD);
+    auto twoPass = makeTwoPassReduction(problem);
+    if(twoPass.mWorkspaceSize > 0 && twoPass.mWorkspaceSize <= workspaceSizeLimit)
     {
-        auto errorCode = HIPTENSOR_STATUS_INTERNAL_ERROR;
+        errorCode = selectReductionSolution("hiptensorInitReductionPlan",
+                                            &twoPassSolutions[0],
+                                            twoPassArgs[0],
+                                            &twoPassTimes[0],
+                                            realHandle,
+                                            twoPass.mFirst,
+                                            opReduce,
+                                            typeCompute,
+                                            timed);
+        if(errorCode == HIPTENSOR_STATUS_SUCCESS)
+        {
+            errorCode = selectReductionSolution("hiptensorInitReductionPlan",
+                                                &twoPassSolutions[1],
+                                                twoPassArgs[1],
+                                                &twoPassTimes[1],
+                                                realHandle,
+                                                twoPass.mSecond,
+                                                opReduce,
+                                                typeCompute,
+                                                timed);
+        }
+        if(errorCode == HIPTENSOR_STATUS_ALLOC_FAILED)
+        {
+            return errorCode;
+        }
+    }
+
+    // A single pass is needed as a fallback, or to compare against when timing
+    hiptensor::ReductionSolution*             solution = nullptr;
+    std::shared_ptr<hiptensor::ReductionArgs> args;
+    float                                     time = 0.0f;
+    if(twoPassSolutions[1] == nullptr || timed)
+    {
+        errorCode = selectReductionSolution("hiptensorInitReductionPlan",
+                                            &solution,
+                                            args,
+                                            &time,
+                                            realHandle,
+                                            problem,
+                                            opReduce,
+                                            typeCompute,
+                                            timed);
+        if(errorCode == HIPTENSOR_STATUS_ALLOC_FAILED)
+        {
+            return errorCode;
+        }
+    }
+
+    plan->mSizeD = hiptensor::elementSpaceFromLengths(descD->mLengths, descD->mStrides)
+                   * hiptensor::hipDataTypeSize(descD->mType);
+
+    plan->mTypeCompute = typeCompute;
+    plan->mBackend     = backend;
+
+    if(twoPassSolutions[1] != nullptr
+       && (solution == nullptr || twoPassTimes[0] + twoPassTimes[1] < time))
+    {
+        plan->mSolutions[0]  = twoPassSolutions[0];
+        plan->mSolutions[1]  = twoPassSolutions[1];
+        plan->mArgs[0]       = std::move(twoPassArgs[0]);
+        plan->mArgs[1]       = std::move(twoPassArgs[1]);
+        plan->mSplit         = nullptr;
+        plan->mWorkspaceSize = twoPass.mWorkspaceSize;
+    }
+    else if(solution != nullptr)
+    {
+        plan->mSolutions[0]  = solution;
+        plan->mSolutions[1]  = nullptr;
+        plan->mArgs[0]       = std::move(args);
+        plan->mArgs[1]       = nullptr;
+        plan->mSplit         = problem.mSplit.mLengths.empty()
+                                   ? nullptr
+                                   : std::make_shared<hiptensor::ModeSplit>(problem.mSplit);
+        plan->mWorkspaceSize = 0u;
+    }
+    else
+    {
+        errorCode = HIPTENSOR_STATUS_INTERNAL_ERROR;
         snprintf(msg,
                  sizeof(msg),
-                 "Internal Error : querySolutions returns 0 kernel. (%s)",
+                 "No kernel is able to solve the problem (%s)",
                  hiptensorGetErrorString(errorCode));
-        logger->logError("hiptensorReduction", msg);
+        logger->logError("hiptensorInitReductionPlan", msg);
         return errorCode;
     }
 
-    double alphaD;
-    if(alpha != nullptr)
+    return HIPTENSOR_STATUS_SUCCESS;
+}
+
+hiptensorStatus_t hiptensorReductionExecute(const hiptensorHandle_t*        handle,
+                                            const hiptensorReductionPlan_t* plan,
+                                            const void*                     alpha,
+                                            const void*                     A,
+                                            const void*                     beta,
+                                            const void*                     C,
+                                            void*                           D,
+                                            void*                           workspace,
+                                            uint64_t                        workspaceSize,
+                                            hipStream_t                     stream)
+{
+    using hiptensor::Logger;
+    auto& logger = Logger::instance();
+
+    // Log API access
+    char msg[2048];
+    logger->logAPITrace("hiptensorReductionExecute",
+                        "handle=%p, plan=%p, alpha=%p, A=%p, beta=%p, C=%p, D=%p, workspace=%p, "
+                        "workspaceSize=%lu, stream=%p",
+                        handle,
+                        plan,
+                        alpha,
+                        A,
+                        beta,
+                        C,
+                        D,
+                        workspace,
+                        workspaceSize,
+                        stream);
+
+    if(!handle || !plan)
     {
-        alphaD = hiptensor::readVal<double>(alpha, typeCompute);
+        auto errorCode = HIPTENSOR_STATUS_NOT_INITIALIZED;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Initialization Error : %s = nullptr (%s)",
+                 !handle ? "handle" : "plan",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorReductionExecute", msg);
+        return errorCode;
     }
-    double betaD;
-    if(beta != nullptr)
+
+    if(!alpha || !A || !beta || !D)
     {
-        betaD = hiptensor::readVal<double>(beta, typeCompute);
+        auto errorCode = HIPTENSOR_STATUS_INVALID_VALUE;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Input Parameter Error : alpha/A/beta/D = nullptr (%s)",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorReductionExecute", msg);
+        return errorCode;
     }
 
-    if(C && C != D)
+    if(plan->mSolutions[0] == nullptr || plan->mArgs[0] == nullptr)
     {
-        // CK API can only process $D = alpha * reduce(A) + beta * D$
-        // Need to copy C to D if C != D
-        CHECK_HIP_ERROR(hipMemcpy(D,
-                                  C,
-                                  hiptensor::elementsFromLengths(descC->mLengths)
-                                      * hiptensor::hipDataTypeSize(descC->mType),
-                                  hipMemcpyDeviceToDevice));
+        auto errorCode = HIPTENSOR_STATUS_INTERNAL_ERROR;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Internal Error : %s = nullptr (%s)",
+                 plan->mSolutions[0] == nullptr ? "solution" : "args",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorReductionExecute", msg);
+        return errorCode;
     }
 
-    for(auto [_, pSolution] : solutionQ.solutions())
+    auto realHandle = hiptensor::Handle::toHandle((int64_t*)handle->fields);
+    auto backend    = realHandle->getBackend();
+    auto isHost     = backend == HIPTENSOR_BACKEND_HOST;
+
+    if(plan->mBackend != backend)
     {
-        // Perform reduction with timing if LOG_LEVEL_PERF_TRACE
-        auto streamConfig =
-            (logger->getLogMask() & HIPTENSOR_LOG_LEVEL_PERF_TRACE) ?
-            StreamConfig{
-                stream, // stream id
-                true, // time_kernel
-                0, // log_level
-                0, // cold_niters
-                1, // nrepeat
-            }:
-        StreamConfig{stream, false};
-        auto [isSupported, time] = (*pSolution)(descA->mLengths,
-                                                descA->mStrides,
-                                                {modeA, modeA + descA->mLengths.size()},
-                                                descD->mLengths,
-                                                descD->mStrides,
-                                                {modeD, modeD + descD->mLengths.size()},
-                                                alphaD,
-                                                betaD,
-                                                A,
-                                                D,
-                                                opReduce,
-                                                streamConfig);
-        if(isSupported)
-        {
-            if(time < 0)
-            {
-                return HIPTENSOR_STATUS_CK_ERROR;
-            }
-            if(logger->getLogMask() & HIPTENSOR_LOG_LEVEL_PERF_TRACE)
-            {
+        auto errorCode = HIPTENSOR_STATUS_INVALID_VALUE;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Backend mismatch error: plan backend: %d, handle backend: %d (%s)",
+                 (int)plan->mBackend,
+                 (int)backend,
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorReductionExecute", msg);
+        return errorCode;
+    }
 
-                int  n     = pSolution->problemDim();
-                auto flops = std::size_t(2) * n;
-                auto bytes = pSolution->problemBytes();
+    if(plan->mWorkspaceSize > 0 && (!workspace || workspaceSize < plan->mWorkspaceSize))
+    {
+        auto errorCode = HIPTENSOR_STATUS_INSUFFICIENT_WORKSPACE;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Insufficient workspace: %lu bytes are required (%s)",
+                 plan->mWorkspaceSize,
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorReductionExecute", msg);
+        return errorCode;
+    }
 
-                hiptensor::PerfMetrics metrics = {
-                    pSolution->uid(), // id
-                    pSolution->kernelName(), // name
-                    time, // avg time
-                    static_cast<float>(flops) / static_cast<float>(1.E9) / time, // tflops
-                    static_cast<float>(bytes) / static_cast<float>(1.E6) / time // BW
-                };
+    double alphaD = hiptensor::readVal<double>(alpha, plan->mTypeCompute);
+    double betaD  = hiptensor::readVal<double>(beta, plan->mTypeCompute);
 
-                // log perf metrics (not name/id)
-                snprintf(msg,
-                         sizeof(msg),
-                         "KernelId: %lu KernelName: %s, %0.3f ms, %0.3f TFlops, %0.3f GB/s",
-                         metrics.mKernelUid,
-                         metrics.mKernelName.c_str(),
-                         metrics.mAvgTimeMs,
-                         metrics.mTflops,
-                         metrics.mBandwidth);
-                logger->logPerformanceTrace("hiptensorReduction", msg);
-            }
+    auto errorCode = copyReductionC(
+        "hiptensorReductionExecute", isHost, C, D, plan->mSizeD, betaD, stream);
+    if(errorCode != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return errorCode;
+    }
 
-            return HIPTENSOR_STATUS_SUCCESS;
+    // The plan holds the validated arguments: only the data pointers and
+    // scalars are patched in, and only when they have changed.
+    auto* pFirst    = (hiptensor::ReductionSolution*)(plan->mSolutions[0]);
+    auto* pSecond   = (hiptensor::ReductionSolution*)(plan->mSolutions[1]);
+    auto& firstArgs = *(hiptensor::ReductionArgs const*)(plan->mArgs[0].get());
+    if(pSecond == nullptr)
+    {
+        errorCode = launchReduction("hiptensorReductionExecute",
+                                    isHost,
+                                    pFirst,
+                                    firstArgs,
+                                    (hiptensor::ModeSplit const*)(plan->mSplit.get()),
+                                    alphaD,
+                                    betaD,
+                                    A,
+                                    D,
+                                    stream);
+    }
+    else
+    {
+        // Partial results of every chunk, ordered on the stream ahead of the second pass
+        errorCode = launchReduction("hiptensorReductionExecute",
+                                    isHost,
+                                    pFirst,
+                                    firstArgs,
+                                    1.0,
+                                    0.0,
+                                    A,
+                                    workspace,
+                                    stream);
+        if(errorCode == HIPTENSOR_STATUS_SUCCESS)
+        {
+            auto& secondArgs = *(hiptensor::ReductionArgs const*)(plan->mArgs[1].get());
+
+            errorCode = launchReduction("hiptensorReductionExecute",
+                                        isHost,
+                                        pSecond,
+                                        secondArgs,
+                                        alphaD,
+                                        betaD,
+                                        workspace,
+                                        D,
+                                        stream);
         }
     }
 
-    auto errorCode = HIPTENSOR_STATUS_INTERNAL_ERROR;
-    snprintf(msg,
-             sizeof(msg),
-             "No kernel is able to solve the problem (%s)",
-             hiptensorGetErrorString(errorCode));
-    logger->logError("hiptensorReduction", msg);
+    if(errorCode != HIPTENSOR_STATUS_SUCCESS)
+    {
+        snprintf(msg,
+                 sizeof(msg),
+                 "Selected kernel is unable to solve the problem (%s)",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorReductionExecute", msg);
+    }
     return errorCode;
 }
 
@@ -389,6 +1199,45 @@ hiptensorStatus_t hiptensorReductionGetWorkspaceSize(const hiptensorHandle_t*
                                                      hiptensorComputeType_t             typeCompute,
                                                      uint64_t* workspaceSize)
 {
-    *workspaceSize = 0;
+    using hiptensor::Logger;
+    auto& logger = Logger::instance();
+    char  msg[512];
+
+    logger->logAPITrace("hiptensorReductionGetWorkspaceSize",
+                        "handle=%p, A=%p, descA=%p, modeA=%p, C=%p, descC=%p, modeC=%p, D=%p, "
+                        "descD=%p, modeD=%p, opReduce=%d, typeCompute=%d, workspaceSize=%p",
+                        handle,
+                        A,
+                        descA,
+                        modeA,
+                        C,
+                        descC,
+                        modeC,
+                        D,
+                        descD,
+                        modeD,
+                        (int)opReduce,
+                        (int)typeCompute,
+                        workspaceSize);
+
+    if(!handle || !descA || !modeA || !descD || !workspaceSize)
+    {
+        auto errorCode = HIPTENSOR_STATUS_NOT_INITIALIZED;
+        snprintf(msg,
+                 sizeof(msg),
+                 "Initialization Error : %s = nullptr (%s)",
+                 !handle  ? "handle"
+                 : !descA ? "descA"
+                 : !modeA ? "modeA"
+                 : !descD ? "descD"
+                          : "workspaceSize",
+                 hiptensorGetErrorString(errorCode));
+        logger->logError("hiptensorReductionGetWorkspaceSize", msg);
+        return errorCode;
+    }
+
+    // Non-zero only if hiptensorReduction would take the two-pass path
+    *workspaceSize
+        = makeTwoPassReduction(makeReductionProblem(descA, modeA, descD, modeD)).mWorkspaceSize;
     return HIPTENSOR_STATUS_SUCCESS;
 }
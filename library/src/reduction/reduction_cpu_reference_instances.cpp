@@ -28,40 +28,50 @@
 #include "reduction_cpu_reference_impl.hpp"
 #include <hiptensor/internal/types.hpp>
 
-#define REG_CPU_SOLUTION(dim_count, reduced_dim_count, type, computeType) \
-    registerSolutions(enumerateReferenceSolutions<type,                   \
-                                                  computeType,            \
-                                                  type,                   \
-                                                  dim_count,              \
-                                                  reduced_dim_count,      \
-                                                  HIPTENSOR_OP_ADD,       \
-                                                  true,                   \
-                                                  false>());              \
-    registerSolutions(enumerateReferenceSolutions<type,                   \
-                                                  computeType,            \
-                                                  type,                   \
-                                                  dim_count,              \
-                                                  reduced_dim_count,      \
-                                                  HIPTENSOR_OP_MUL,       \
-                                                  true,                   \
-                                                  false>());              \
-    registerSolutions(enumerateReferenceSolutions<type,                   \
-                                                  computeType,            \
-                                                  type,                   \
-                                                  dim_count,              \
-                                                  reduced_dim_count,      \
-                                                  HIPTENSOR_OP_MIN,       \
-                                                  true,                   \
-                                                  false>());              \
-    registerSolutions(enumerateReferenceSolutions<type,                   \
-                                                  computeType,            \
-                                                  type,                   \
-                                                  dim_count,              \
-                                                  reduced_dim_count,      \
-                                                  HIPTENSOR_OP_MAX,       \
-                                                  true,                   \
+#define REG_CPU_SOLUTION_TYPES(dim_count, reduced_dim_count, inType, computeType, outType) \
+    registerSolutions(enumerateReferenceSolutions<inType,                                  \
+                                                  computeType,                             \
+                                                  outType,                                 \
+                                                  dim_count,                               \
+                                                  reduced_dim_count,                       \
+                                                  HIPTENSOR_OP_ADD,                        \
+                                                  true,                                    \
+                                                  false>());                               \
+    registerSolutions(enumerateReferenceSolutions<inType,                                  \
+                                                  computeType,                             \
+                                                  outType,                                 \
+                                                  dim_count,                               \
+                                                  reduced_dim_count,                       \
+                                                  HIPTENSOR_OP_MUL,                        \
+                                                  true,                                    \
+                                                  false>());                               \
+    registerSolutions(enumerateReferenceSolutions<inType,                                  \
+                                                  computeType,                             \
+                                                  outType,                                 \
+                                                  dim_count,                               \
+                                                  reduced_dim_count,                       \
+                                                  HIPTENSOR_OP_MIN,                        \
+                                                  true,                                    \
+                                                  false>());                               \
+    registerSolutions(enumerateReferenceSolutions<inType,                                  \
+                                                  computeType,                             \
+                                                  outType,                                 \
+                                                  dim_count,                               \
+                                                  reduced_dim_count,                       \
+                                                  HIPTENSOR_OP_MAX,                        \
+                                                  true,                                    \
                                                   false>());
 
+#define REG_CPU_SOLUTION(dim_count, reduced_dim_count, type, computeType)         \
+    REG_CPU_SOLUTION_TYPES(dim_count, reduced_dim_count, type, computeType, type)
+
+// Two-pass reductions of 16-bit types keep their partial results in the compute type
+#define REG_CPU_FIRST_PASS_SOLUTION(dim_count, reduced_dim_count, type, computeType)     \
+    REG_CPU_SOLUTION_TYPES(dim_count, reduced_dim_count, type, computeType, computeType)
+
+#define REG_CPU_SECOND_PASS_SOLUTION(dim_count, type, computeType)       \
+    REG_CPU_SOLUTION_TYPES(dim_count, 1, computeType, computeType, type)
+
 namespace hiptensor
 {
     ReductionCpuReferenceInstances::ReductionCpuReferenceInstances()
@@ -88,6 +98,28 @@ namespace hiptensor
         REG_CPU_SOLUTION(6, 5, ck::half_t, float);
         REG_CPU_SOLUTION(6, 6, ck::half_t, float);
 
+        REG_CPU_FIRST_PASS_SOLUTION(2, 1, ck::half_t, float);
+        REG_CPU_FIRST_PASS_SOLUTION(3, 1, ck::half_t, float);
+        REG_CPU_FIRST_PASS_SOLUTION(3, 2, ck::half_t, float);
+        REG_CPU_FIRST_PASS_SOLUTION(4, 1, ck::half_t, float);
+        REG_CPU_FIRST_PASS_SOLUTION(4, 2, ck::half_t, float);
+        REG_CPU_FIRST_PASS_SOLUTION(4, 3, ck::half_t, float);
+        REG_CPU_FIRST_PASS_SOLUTION(5, 1, ck::half_t, float);
+        REG_CPU_FIRST_PASS_SOLUTION(5, 2, ck::half_t, float);
+        REG_CPU_FIRST_PASS_SOLUTION(5, 3, ck::half_t, float);
+        REG_CPU_FIRST_PASS_SOLUTION(5, 4, ck::half_t, float);
+        REG_CPU_FIRST_PASS_SOLUTION(6, 1, ck::half_t, float);
+        REG_CPU_FIRST_PASS_SOLUTION(6, 2, ck::half_t, float);
+        REG_CPU_FIRST_PASS_SOLUTION(6, 3, ck::half_t, float);
+        REG_CPU_FIRST_PASS_SOLUTION(6, 4, ck::half_t, float);
+        REG_CPU_FIRST_PASS_SOLUTION(6, 5, ck::half_t, float);
+        REG_CPU_SECOND_PASS_SOLUTION(1, ck::half_t, float);
+        REG_CPU_SECOND_PASS_SOLUTION(2, ck::half_t, float);
+        REG_CPU_SECOND_PASS_SOLUTION(3, ck::half_t, float);
+        REG_CPU_SECOND_PASS_SOLUTION(4, ck::half_t, float);
+        REG_CPU_SECOND_PASS_SOLUTION(5, ck::half_t, float);
+        REG_CPU_SECOND_PASS_SOLUTION(6, ck::half_t, float);
+
         REG_CPU_SOLUTION(1, 1, ck::bhalf_t, float);
         REG_CPU_SOLUTION(2, 1, ck::bhalf_t, float);
         REG_CPU_SOLUTION(2, 2, ck::bhalf_t, float);
@@ -110,6 +142,28 @@ namespace hiptensor
         REG_CPU_SOLUTION(6, 5, ck::bhalf_t, float);
         REG_CPU_SOLUTION(6, 6, ck::bhalf_t, float);
 
+        REG_CPU_FIRST_PASS_SOLUTION(2, 1, ck::bhalf_t, float);
+        REG_CPU_FIRST_PASS_SOLUTION(3, 1, ck::bhalf_t, float);
+        REG_CPU_FIRST_PASS_SOLUTION(3, 2, ck::bhalf_t, float);
+        REG_CPU_FIRST_PASS_SOLUTION(4, 1, ck::bhalf_t, float);
+        REG_CPU_FIRST_PASS_SOLUTION(4, 2, ck::bhalf_t, float);
+        REG_CPU_FIRST_PASS_SOLUTION(4, 3, ck::bhalf_t, float);
+        REG_CPU_FIRST_PASS_SOLUTION(5, 1, ck::bhalf_t, float);
+        REG_CPU_FIRST_PASS_SOLUTION(5, 2, ck::bhalf_t, float);
+        REG_CPU_FIRST_PASS_SOLUTION(5, 3, ck::bhalf_t, float);
+        REG_CPU_FIRST_PASS_SOLUTION(5, 4, ck::bhalf_t, float);
+        REG_CPU_FIRST_PASS_SOLUTION(6, 1, ck::bhalf_t, float);
+        REG_CPU_FIRST_PASS_SOLUTION(6, 2, ck::bhalf_t, float);
+        REG_CPU_FIRST_PASS_SOLUTION(6, 3, ck::bhalf_t, float);
+        REG_CPU_FIRST_PASS_SOLUTION(6, 4, ck::bhalf_t, float);
+        REG_CPU_FIRST_PASS_SOLUTION(6, 5, ck::bhalf_t, float);
+        REG_CPU_SECOND_PASS_SOLUTION(1, ck::bhalf_t, float);
+        REG_CPU_SECOND_PASS_SOLUTION(2, ck::bhalf_t, float);
+        REG_CPU_SECOND_PASS_SOLUTION(3, ck::bhalf_t, float);
+        REG_CPU_SECOND_PASS_SOLUTION(4, ck::bhalf_t, float);
+        REG_CPU_SECOND_PASS_SOLUTION(5, ck::bhalf_t, float);
+        REG_CPU_SECOND_PASS_SOLUTION(6, ck::bhalf_t, float);
+
         REG_CPU_SOLUTION(1, 1, float, float);
         REG_CPU_SOLUTION(2, 1, float, float);
         REG_CPU_SOLUTION(2, 2, float, float);
@@ -28,26 +28,56 @@
 
 namespace hiptensor
 {
+    bool ReductionArgs::LaunchData::operator==(LaunchData const& other) const
+    {
+        return mA == other.mA && mC == other.mC && mAlpha == other.mAlpha
+               && mBeta == other.mBeta;
+    }
 
-    ReductionSolution::ReductionSolution(
-        std::unique_ptr<ck::tensor_operation::device::BaseOperator>&& deviceOp,
-        std::unique_ptr<ReductionSolutionParams>&&                    params)
+    ReductionArgs::ReductionArgs()
         : mDim(0)
         , mBytes(0)
+        , mOpReduce(HIPTENSOR_OP_ADD)
         , mValid(false)
+        , mLaunchData{}
+    {
+    }
+
+    void ReductionArgs::reset()
+    {
+        mDim      = 0;
+        mBytes    = 0;
+        mOpReduce = HIPTENSOR_OP_ADD;
+
+        mInLengths.clear();
+        mInStrides.clear();
+        mOutLengths.clear();
+        mOutStrides.clear();
+        mReduceDims.clear();
+
+        mInvokerArgPtr.reset(nullptr);
+        mInvokerPtr.reset(nullptr);
+        mLaunchData = {};
+
+        mValid = false;
+    }
+
+    ReductionSolution::ReductionSolution(
+        std::unique_ptr<ck::tensor_operation::device::BaseOperator>&& deviceOp,
+        std::unique_ptr<ReductionSolutionParams>&&                    params,
+        int32_t                                                       srcVectorDim)
+        : mThreadDim(1)
+        , mSrcVectorDim(srcVectorDim)
         , mDeviceOp(std::move(deviceOp))
         , mParams(std::move(params))
     {
     }
 
     ReductionSolution::ReductionSolution(ReductionSolution&& other)
-        : mDim(other.mDim)
-        , mBytes(other.mBytes)
-        , mValid(other.mValid)
+        : mThreadDim(other.mThreadDim)
+        , mSrcVectorDim(other.mSrcVectorDim)
         , mDeviceOp(std::move(other.mDeviceOp))
         , mParams(std::move(other.mParams))
-        , mInvokerArgPtr(std::move(other.mInvokerArgPtr))
-        , mInvokerPtr(std::move(other.mInvokerPtr))
     {
     }
 
@@ -55,17 +85,59 @@ namespace hiptensor
     {
         if(this != &other)
         {
-            mDim = other.mDim;
+            mThreadDim    = other.mThreadDim;
+            mSrcVectorDim = other.mSrcVectorDim;
+            mParams       = std::move(other.mParams);
+            mDeviceOp     = std::move(other.mDeviceOp);
+        }
+        return *this;
+    }
+
+    float ReductionSolution::operator()(ReductionArgs const& args,
+                                        StreamConfig const&  streamConfig) const
+    {
+        if(!args.mValid || !args.mInvokerArgPtr || !args.mInvokerPtr)
+        {
+#if !NDEBUG
+            std::cout << kernelName() << " does not support this problem" << std::endl;
+#endif // !NDEBUG
+            return -1.0f;
+        }
+
+        return args.mInvokerPtr->Run(args.mInvokerArgPtr.get(), streamConfig);
+    }
+
+    float ReductionSolution::operator()(ReductionArgs const& args,
+                                        double               alpha,
+                                        double               beta,
+                                        void const*          A,
+                                        void*                C,
+                                        StreamConfig const&  streamConfig) const
+    {
+        if(!args.mValid || !args.mInvokerPtr)
+        {
+#if !NDEBUG
+            std::cout << kernelName() << " does not support this problem" << std::endl;
+#endif // !NDEBUG
+            return -1.0f;
+        }
 
-            mBytes = other.mBytes;
-            mValid = other.mValid;
+        auto data = ReductionArgs::LaunchData{A, C, alpha, beta};
 
-            mParams        = std::move(other.mParams);
-            mDeviceOp      = std::move(other.mDeviceOp);
-            mInvokerArgPtr = std::move(other.mInvokerArgPtr);
-            mInvokerPtr    = std::move(other.mInvokerPtr);
+        // Concurrent launches of the same args fall back to a call-local argument
+        std::unique_lock<std::mutex> lock(args.mLaunchMutex, std::try_to_lock);
+        if(lock.owns_lock())
+        {
+            if(args.mInvokerArgPtr == nullptr || !(args.mLaunchData == data))
+            {
+                args.mInvokerArgPtr = makeArgument(args, alpha, beta, A, C);
+                args.mLaunchData    = data;
+            }
+            return args.mInvokerPtr->Run(args.mInvokerArgPtr.get(), streamConfig);
         }
-        return *this;
+
+        auto argument = makeArgument(args, alpha, beta, A, C);
+        return args.mInvokerPtr->Run(argument.get(), streamConfig);
     }
 
     std::pair<bool, float> ReductionSolution::operator()(std::vector<std::size_t> const& a_lengths,
@@ -79,9 +151,11 @@ namespace hiptensor
                                                          void const*                     A,
                                                          void*                           C,
                                                          hiptensorOperator_t             opReduce,
-                                                         StreamConfig const& streamConfig)
+                                                         StreamConfig const& streamConfig) const
     {
-        if(!initArgs(a_lengths,
+        ReductionArgs args;
+        if(!initArgs(args,
+                     a_lengths,
                      a_strides,
                      a_modes,
                      c_lengths,
@@ -99,12 +173,7 @@ namespace hiptensor
             return {false, 0.0f};
         }
 
-        return {true, mInvokerPtr->Run(mInvokerArgPtr.get(), streamConfig)};
-    }
-
-    bool ReductionSolution::isValid() const
-    {
-        return mValid;
+        return {true, (*this)(args, streamConfig)};
     }
 
     std::unique_ptr<ReductionSolutionParams> const& ReductionSolution::params() const
@@ -126,14 +195,9 @@ namespace hiptensor
         return mThreadDim;
     }
 
-    ck::index_t ReductionSolution::problemDim() const
+    int32_t ReductionSolution::srcVectorDim() const
     {
-        return mDim;
-    }
-
-    ck::index_t ReductionSolution::problemBytes() const
-    {
-        return mBytes;
+        return mSrcVectorDim;
     }
 
     std::string ReductionSolution::kernelName() const
@@ -141,11 +205,11 @@ namespace hiptensor
         return mDeviceOp->GetTypeString();
     }
 
-    size_t ReductionSolution::workspaceSize() const
+    size_t ReductionSolution::workspaceSize(ReductionArgs const& args) const
     {
-        if(mValid)
+        if(args.mValid)
         {
-            return mDeviceOp->GetWorkSpaceSize(mInvokerArgPtr.get());
+            return mDeviceOp->GetWorkSpaceSize(args.mInvokerArgPtr.get());
         }
         else
         {
@@ -153,15 +217,4 @@ namespace hiptensor
         }
     }
 
-    void ReductionSolution::resetArgs()
-    {
-        mDim   = 0;
-        mBytes = 0;
-
-        mInvokerArgPtr.reset(nullptr);
-        mInvokerPtr.reset(nullptr);
-
-        mValid = false;
-    }
-
 } // namespace hiptensor
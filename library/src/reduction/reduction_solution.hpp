@@ -29,6 +29,7 @@
 
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <tuple>
 #include <vector>
 
@@ -39,6 +40,50 @@
 
 namespace hiptensor
 {
+    // Kernel arguments and invoker for one reduction problem.
+    // These are owned by the caller rather than the solution, so that a single
+    // solution can serve several plans and threads.
+    struct ReductionArgs
+    {
+        // Data pointers and scalars that a kernel argument was made for
+        struct LaunchData
+        {
+            void const* mA;
+            void const* mC;
+            double      mAlpha;
+            double      mBeta;
+
+            bool operator==(LaunchData const& other) const;
+        };
+
+        ReductionArgs();
+        ~ReductionArgs()                               = default;
+        ReductionArgs(ReductionArgs const&)            = delete;
+        ReductionArgs& operator=(ReductionArgs const&) = delete;
+
+        void reset();
+
+        // Derived runtime arguments
+        ck::index_t         mDim;
+        ck::index_t         mBytes;
+        hiptensorOperator_t mOpReduce;
+
+        // Arguments were accepted by the kernel
+        bool mValid;
+
+        // Problem in CK index format, kept so that the kernel
+        // argument can be re-made for new data pointers and scalars.
+        std::vector<ck::index_t> mInLengths, mInStrides, mOutLengths, mOutStrides, mReduceDims;
+
+        // Kernel argument of the last launch and the data it was made for.
+        // Guarded by mLaunchMutex.
+        mutable std::unique_ptr<ck::tensor_operation::device::BaseArgument> mInvokerArgPtr;
+        mutable LaunchData                                                  mLaunchData;
+        mutable std::mutex                                                  mLaunchMutex;
+
+        std::unique_ptr<ck::tensor_operation::device::BaseInvoker> mInvokerPtr;
+    };
+
     class ReductionSolution
     {
     public:
@@ -53,12 +98,14 @@ namespace hiptensor
         // This class is intended to receive DeviceOp kernel pointers from
         // the CK generator and take ownership.
         ReductionSolution(std::unique_ptr<ck::tensor_operation::device::BaseOperator>&& deviceOp,
-                          std::unique_ptr<ReductionSolutionParams>&&                    params);
+                          std::unique_ptr<ReductionSolutionParams>&&                    params,
+                          int32_t srcVectorDim = -1);
         ReductionSolution(ReductionSolution&& other);
         ReductionSolution& operator=(ReductionSolution&& other);
 
         // Must specialize incoming arg handling
-        virtual bool initArgs(std::vector<std::size_t> const& a_lengths,
+        virtual bool initArgs(ReductionArgs&                  args,
+                              std::vector<std::size_t> const& a_lengths,
                               std::vector<std::size_t> const& a_strides,
                               std::vector<int32_t> const&     a_modes,
                               std::vector<std::size_t> const& c_lengths,
@@ -68,9 +115,33 @@ namespace hiptensor
                               double                          beta,
                               void const*                     A,
                               void*                           C,
-                              hiptensorOperator_t             opReduce)
+                              hiptensorOperator_t             opReduce) const
             = 0;
 
+        // Makes a kernel argument for previously initialized args with new data
+        // pointers and scalars.
+        virtual std::unique_ptr<ck::tensor_operation::device::BaseArgument>
+            makeArgument(ReductionArgs const& args,
+                         double               alpha,
+                         double               beta,
+                         void const*          A,
+                         void*                C) const
+            = 0;
+
+        // Launch previously initialized args
+        float operator()(ReductionArgs const& args,
+                         StreamConfig const&  streamConfig = StreamConfig{}) const;
+
+        // Patch data pointers and scalars into previously initialized args and launch.
+        // The kernel argument is only re-made if they differ from the previous launch.
+        float operator()(ReductionArgs const& args,
+                         double               alpha,
+                         double               beta,
+                         void const*          A,
+                         void*                C,
+                         StreamConfig const&  streamConfig = StreamConfig{}) const;
+
+        // Initialize call-local args and launch
         std::pair<bool, float> operator()(std::vector<std::size_t> const& a_lengths,
                                           std::vector<std::size_t> const& a_strides,
                                           std::vector<int32_t> const&     a_modes,
@@ -82,13 +153,10 @@ namespace hiptensor
                                           void const*                     A,
                                           void*                           C,
                                           hiptensorOperator_t             opReduce,
-                                          StreamConfig const& streamConfig = StreamConfig{});
+                                          StreamConfig const& streamConfig = StreamConfig{}) const;
 
         /// Accessors
 
-        // Problem can be solved with this kernel
-        bool isValid() const;
-
         // Run-time solution parameters
         std::unique_ptr<ReductionSolutionParams> const& params() const;
 
@@ -98,33 +166,23 @@ namespace hiptensor
         // Get Number of threads across dimension
         uint32_t threadDim() const;
 
-        // Problem dimension
-        ck::index_t problemDim() const;
-
-        // Byte count
-        ck::index_t problemBytes() const;
+        // Dimension that source loads are vectorized along:
+        // 0 for the kept modes, 1 for the reduced modes, -1 if not applicable
+        int32_t srcVectorDim() const;
 
         // Kernel's name encoding
         std::string kernelName() const;
 
         // Kernel's required workspace size
-        size_t workspaceSize() const;
-
-        // Reset all arguments
-        void resetArgs();
+        size_t workspaceSize(ReductionArgs const& args) const;
 
     protected:
-        // Derived runtime arguments
-        ck::index_t mDim;
-        ck::index_t mBytes;
-        bool        mValid;
-        uint32_t    mThreadDim;
+        uint32_t mThreadDim;
+        int32_t  mSrcVectorDim;
 
         // Kernel Params
         std::unique_ptr<ReductionSolutionParams>                    mParams;
         std::unique_ptr<ck::tensor_operation::device::BaseOperator> mDeviceOp;
-        std::unique_ptr<ck::tensor_operation::device::BaseArgument> mInvokerArgPtr;
-        std::unique_ptr<ck::tensor_operation::device::BaseInvoker>  mInvokerPtr;
     };
 
     template <typename InDataType,
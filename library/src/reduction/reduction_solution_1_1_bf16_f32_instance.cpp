@@ -34,5 +34,6 @@ namespace hiptensor
     {
         // add entries to mSolutionQuery
         REG_REDUCTION_SOLUTION(1, 1, ck::bhalf_t, float);
+        REG_REDUCTION_SECOND_PASS_SOLUTION(1, ck::bhalf_t, float);
     }
 } // namespace hiptensor
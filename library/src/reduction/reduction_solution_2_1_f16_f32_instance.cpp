@@ -34,5 +34,7 @@ namespace hiptensor
     {
         // add entries to mSolutionQuery
         REG_REDUCTION_SOLUTION(2, 1, ck::half_t, float);
+        REG_REDUCTION_FIRST_PASS_SOLUTION(2, 1, ck::half_t, float);
+        REG_REDUCTION_SECOND_PASS_SOLUTION(2, ck::half_t, float);
     }
 } // namespace hiptensor
@@ -35,5 +35,6 @@ namespace hiptensor
 
         // add entries to mSolutionQuery
         REG_REDUCTION_SOLUTION(3, 2, ck::half_t, float);
+        REG_REDUCTION_FIRST_PASS_SOLUTION(3, 2, ck::half_t, float);
     }
 } // namespace hiptensor
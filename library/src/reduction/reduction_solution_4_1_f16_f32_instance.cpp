@@ -35,5 +35,7 @@ namespace hiptensor
 
         // add entries to mSolutionQuery
         REG_REDUCTION_SOLUTION(4, 1, ck::half_t, float);
+        REG_REDUCTION_FIRST_PASS_SOLUTION(4, 1, ck::half_t, float);
+        REG_REDUCTION_SECOND_PASS_SOLUTION(4, ck::half_t, float);
     }
 } // namespace hiptensor
@@ -35,5 +35,6 @@ namespace hiptensor
 
         // add entries to mSolutionQuery
         REG_REDUCTION_SOLUTION(5, 4, ck::half_t, float);
+        REG_REDUCTION_FIRST_PASS_SOLUTION(5, 4, ck::half_t, float);
     }
 } // namespace hiptensor
@@ -68,13 +68,15 @@ namespace hiptensor
     class ReductionSolutionImpl<DeviceOp> : public ReductionSolution
     {
     public:
-        ReductionSolutionImpl(std::unique_ptr<DeviceOp>&& deviceOp)
+        ReductionSolutionImpl(std::unique_ptr<DeviceOp>&& deviceOp, int32_t srcVectorDim = -1)
             : ReductionSolution(std::move(deviceOp),
-                                std::make_unique<ReductionSolutionParamsImpl<DeviceOp>>())
+                                std::make_unique<ReductionSolutionParamsImpl<DeviceOp>>(),
+                                srcVectorDim)
         {
         }
 
-        bool initArgs(std::vector<std::size_t> const& a_lengths,
+        bool initArgs(ReductionArgs&                  args,
+                      std::vector<std::size_t> const& a_lengths,
                       std::vector<std::size_t> const& a_strides,
                       std::vector<int32_t> const&     a_modes,
                       std::vector<std::size_t> const& c_lengths,
@@ -84,38 +86,33 @@ namespace hiptensor
                       double                          beta,
                       void const*                     A,
                       void*                           C,
-                      hiptensorOperator_t             opReduce) override
+                      hiptensorOperator_t             opReduce) const override
         {
             using Base   = ReductionSolution;
             using Traits = MetaTraits<DeviceOp>;
 
             // Clear out the previous arguments
-            resetArgs();
+            args.reset();
 
             // Promote to derived class for necessary functions such as
             // MakeArgumentPointer and MakeInvokerPointer.
             auto* deviceOp = dynamic_cast<DeviceOp*>(Base::mDeviceOp.get());
             if(deviceOp == nullptr)
             {
-                return 0;
+                return false;
             }
 
             static_assert(Traits::TensorRank >= Traits::TensorNumReduceDim,
                           "TensorRank must be greater than or equal to TensorNumReduceDim");
-            constexpr ck::index_t OutputDim
-                = (Traits::TensorRank - Traits::TensorNumReduceDim)
-                      ? (Traits::TensorRank - Traits::TensorNumReduceDim)
-                      : 1;
-            std::array<ck::index_t, Traits::TensorRank>         arrInLengths;
-            std::array<ck::index_t, Traits::TensorRank>         arrInStrides;
-            std::array<ck::index_t, OutputDim>                  arrOutLengths;
-            std::array<ck::index_t, OutputDim>                  arrOutStrides;
-            std::array<ck::index_t, Traits::TensorNumReduceDim> reduceDims;
-            auto                                                toCKArr
-                = [](auto const& v, auto& a) { std::copy(v.cbegin(), v.cend(), a.begin()); };
+            if(a_lengths.size() != Traits::TensorRank
+               || a_lengths.size() - c_lengths.size() != Traits::TensorNumReduceDim)
+            {
+                return false;
+            }
+
             auto findReduceModes
                 = [](const std::vector<int32_t>& modeA, const std::vector<int32_t> modeD) {
-                      std::vector<size_t> reduceModes;
+                      std::vector<ck::index_t> reduceModes;
                       for(int i = 0; i < modeA.size(); i++)
                       {
                           if(auto it = std::find(modeD.cbegin(), modeD.cend(), modeA[i]);
@@ -126,9 +123,9 @@ namespace hiptensor
                       }
                       return reduceModes;
                   };
-            toCKArr(a_lengths, arrInLengths);
-            toCKArr(a_strides.empty() ? hiptensor::stridesFromLengths(a_lengths) : a_strides,
-                    arrInStrides);
+
+            auto aStrides
+                = a_strides.empty() ? hiptensor::stridesFromLengths(a_lengths) : a_strides;
 
             auto ckCLengths = c_lengths;
             auto ckCStrides = c_strides;
@@ -138,47 +135,94 @@ namespace hiptensor
                 ckCStrides.push_back(
                     1); // caller should guarantee that c_strides is empty if c_lengths is empty
             }
-            toCKArr(ckCLengths, arrOutLengths);
-            toCKArr(ckCStrides.empty() ? hiptensor::stridesFromLengths(ckCLengths) : ckCStrides,
-                    arrOutStrides);
-            toCKArr(findReduceModes(a_modes, c_modes), reduceDims);
-
-            auto [in_elementwise_op, acc_elementwise_op]
-                = reductionUnaryOperators(opReduce,
-                                          hiptensor::elementsFromLengths(a_lengths)
-                                              / hiptensor::elementsFromLengths(ckCLengths));
-
-            Base::mInvokerArgPtr = std::move(deviceOp->MakeArgumentPointer(arrInLengths,
-                                                                           arrInStrides,
-                                                                           arrOutLengths,
-                                                                           arrOutStrides,
-                                                                           reduceDims,
-                                                                           alpha,
-                                                                           beta,
-                                                                           A,
-                                                                           nullptr,
-                                                                           C,
-                                                                           nullptr,
-                                                                           in_elementwise_op,
-                                                                           acc_elementwise_op));
+            if(ckCStrides.empty())
+            {
+                ckCStrides = hiptensor::stridesFromLengths(ckCLengths);
+            }
+
+            // CK has its own format for indices...
+            args.mInLengths  = std::vector<ck::index_t>(a_lengths.begin(), a_lengths.end());
+            args.mInStrides  = std::vector<ck::index_t>(aStrides.begin(), aStrides.end());
+            args.mOutLengths = std::vector<ck::index_t>(ckCLengths.begin(), ckCLengths.end());
+            args.mOutStrides = std::vector<ck::index_t>(ckCStrides.begin(), ckCStrides.end());
+            args.mReduceDims = findReduceModes(a_modes, c_modes);
+            if(args.mReduceDims.size() != Traits::TensorNumReduceDim)
+            {
+                args.reset();
+                return false;
+            }
+
+            // Initialize the argument pointer
+            args.mOpReduce      = opReduce;
+            args.mInvokerArgPtr = makeArgument(args, alpha, beta, A, C);
+            args.mLaunchData    = {A, C, alpha, beta};
 
             // Initialize the invoker
-            Base::mInvokerPtr = std::move(deviceOp->MakeInvokerPointer());
+            args.mInvokerPtr = std::move(deviceOp->MakeInvokerPointer());
 
-            // @todo
             // Fill problem metrics
-            // Base::mDim = Traits::NDim;
+            args.mDim = hiptensor::elementsFromLengths(args.mInLengths);
 
             // Byte count
-            // Base::mBytes = sizeof(typename Traits::InDataT) * Base::mDim
-            // + sizeof(typename Traits::OutDataT) * Base::mDim;
+            args.mBytes = sizeof(typename Traits::TensorInDataType) * args.mDim
+                          + sizeof(typename Traits::TensorOutDataType)
+                                * hiptensor::elementsFromLengths(args.mOutLengths);
 
             // Arg test
-            Base::mValid = deviceOp->IsSupportedArgument(Base::mInvokerArgPtr.get());
+            args.mValid = deviceOp->IsSupportedArgument(args.mInvokerArgPtr.get());
+            if(!args.mValid)
+            {
+                args.reset();
+            }
+
+            return args.mValid;
+        }
+
+        std::unique_ptr<ck::tensor_operation::device::BaseArgument>
+            makeArgument(ReductionArgs const& args,
+                         double               alpha,
+                         double               beta,
+                         void const*          A,
+                         void*                C) const override
+        {
+            using Base   = ReductionSolution;
+            using Traits = MetaTraits<DeviceOp>;
+
+            constexpr ck::index_t OutputDim
+                = (Traits::TensorRank - Traits::TensorNumReduceDim)
+                      ? (Traits::TensorRank - Traits::TensorNumReduceDim)
+                      : 1;
+
+            auto* deviceOp = dynamic_cast<DeviceOp*>(Base::mDeviceOp.get());
+
+            auto toCKArr = [](std::vector<ck::index_t> const& v, auto& a) {
+                std::copy_n(v.begin(), a.size(), a.begin());
+                return a;
+            };
+            std::array<ck::index_t, Traits::TensorRank>         arrInLengths;
+            std::array<ck::index_t, Traits::TensorRank>         arrInStrides;
+            std::array<ck::index_t, OutputDim>                  arrOutLengths;
+            std::array<ck::index_t, OutputDim>                  arrOutStrides;
+            std::array<ck::index_t, Traits::TensorNumReduceDim> reduceDims;
 
-            // Base::mThreadDim = findThreadDim(deviceOp->GetTypeString());
+            auto [in_elementwise_op, acc_elementwise_op] = reductionUnaryOperators(
+                args.mOpReduce,
+                hiptensor::elementsFromLengths(args.mInLengths)
+                    / hiptensor::elementsFromLengths(args.mOutLengths));
 
-            return mValid;
+            return deviceOp->MakeArgumentPointer(toCKArr(args.mInLengths, arrInLengths),
+                                                 toCKArr(args.mInStrides, arrInStrides),
+                                                 toCKArr(args.mOutLengths, arrOutLengths),
+                                                 toCKArr(args.mOutStrides, arrOutStrides),
+                                                 toCKArr(args.mReduceDims, reduceDims),
+                                                 alpha,
+                                                 beta,
+                                                 A,
+                                                 nullptr,
+                                                 C,
+                                                 nullptr,
+                                                 in_elementwise_op,
+                                                 acc_elementwise_op);
         }
     };
 
@@ -268,11 +312,11 @@ namespace hiptensor
 
         std::vector<std::unique_ptr<ReductionSolution>> result;
         result.push_back(std::make_unique<ReductionSolutionImpl<DeviceOp>>(
-            std::make_unique<ReduceOpInstance_InSrcVectorDim0>(
-                ReduceOpInstance_InSrcVectorDim0{})));
+            std::make_unique<ReduceOpInstance_InSrcVectorDim0>(ReduceOpInstance_InSrcVectorDim0{}),
+            0));
         result.push_back(std::make_unique<ReductionSolutionImpl<DeviceOp>>(
-            std::make_unique<ReduceOpInstance_InSrcVectorDim1>(
-                ReduceOpInstance_InSrcVectorDim1{})));
+            std::make_unique<ReduceOpInstance_InSrcVectorDim1>(ReduceOpInstance_InSrcVectorDim1{}),
+            1));
         return result;
     }
 
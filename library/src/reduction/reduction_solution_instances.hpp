@@ -32,40 +32,52 @@
 #include "reduction_solution_registry.hpp"
 #include "singleton.hpp"
 
-#define REG_REDUCTION_SOLUTION(dim_count, reduced_dim_count, type, computeType) \
-    registerSolutions(enumerateReductionSolutions<type,                         \
-                                                  computeType,                  \
-                                                  type,                         \
-                                                  dim_count,                    \
-                                                  reduced_dim_count,            \
-                                                  HIPTENSOR_OP_ADD,             \
-                                                  true,                         \
-                                                  false>());                    \
-    registerSolutions(enumerateReductionSolutions<type,                         \
-                                                  computeType,                  \
-                                                  type,                         \
-                                                  dim_count,                    \
-                                                  reduced_dim_count,            \
-                                                  HIPTENSOR_OP_MUL,             \
-                                                  true,                         \
-                                                  false>());                    \
-    registerSolutions(enumerateReductionSolutions<type,                         \
-                                                  computeType,                  \
-                                                  type,                         \
-                                                  dim_count,                    \
-                                                  reduced_dim_count,            \
-                                                  HIPTENSOR_OP_MIN,             \
-                                                  true,                         \
-                                                  false>());                    \
-    registerSolutions(enumerateReductionSolutions<type,                         \
-                                                  computeType,                  \
-                                                  type,                         \
-                                                  dim_count,                    \
-                                                  reduced_dim_count,            \
-                                                  HIPTENSOR_OP_MAX,             \
-                                                  true,                         \
+#define REG_REDUCTION_SOLUTION_TYPES(dim_count, reduced_dim_count, inType, computeType, outType) \
+    registerSolutions(enumerateReductionSolutions<inType,                                        \
+                                                  computeType,                                   \
+                                                  outType,                                       \
+                                                  dim_count,                                     \
+                                                  reduced_dim_count,                             \
+                                                  HIPTENSOR_OP_ADD,                              \
+                                                  true,                                          \
+                                                  false>());                                     \
+    registerSolutions(enumerateReductionSolutions<inType,                                        \
+                                                  computeType,                                   \
+                                                  outType,                                       \
+                                                  dim_count,                                     \
+                                                  reduced_dim_count,                             \
+                                                  HIPTENSOR_OP_MUL,                              \
+                                                  true,                                          \
+                                                  false>());                                     \
+    registerSolutions(enumerateReductionSolutions<inType,                                        \
+                                                  computeType,                                   \
+                                                  outType,                                       \
+                                                  dim_count,                                     \
+                                                  reduced_dim_count,                             \
+                                                  HIPTENSOR_OP_MIN,                              \
+                                                  true,                                          \
+                                                  false>());                                     \
+    registerSolutions(enumerateReductionSolutions<inType,                                        \
+                                                  computeType,                                   \
+                                                  outType,                                       \
+                                                  dim_count,                                     \
+                                                  reduced_dim_count,                             \
+                                                  HIPTENSOR_OP_MAX,                              \
+                                                  true,                                          \
                                                   false>());
 
+#define REG_REDUCTION_SOLUTION(dim_count, reduced_dim_count, type, computeType)         \
+    REG_REDUCTION_SOLUTION_TYPES(dim_count, reduced_dim_count, type, computeType, type)
+
+// Two-pass reductions of 16-bit types keep their partial results in the compute type.
+// The first pass keeps the chunk mode, so it reduces fewer modes than its rank, and
+// the second pass reduces the chunk mode only.
+#define REG_REDUCTION_FIRST_PASS_SOLUTION(dim_count, reduced_dim_count, type, computeType)     \
+    REG_REDUCTION_SOLUTION_TYPES(dim_count, reduced_dim_count, type, computeType, computeType)
+
+#define REG_REDUCTION_SECOND_PASS_SOLUTION(dim_count, type, computeType)       \
+    REG_REDUCTION_SOLUTION_TYPES(dim_count, 1, computeType, computeType, type)
+
 namespace hiptensor
 {
     class ReductionSolutionInstances : public ReductionSolutionRegistry,
@@ -0,0 +1,140 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <algorithm>
+#include <cstdlib>
+
+#include "thread_pool.hpp"
+
+namespace hiptensor
+{
+    ThreadPool::ThreadPool()
+        : mFunc(nullptr)
+        , mCount(0)
+        , mNext(0)
+        , mActive(0)
+        , mGeneration(0)
+        , mStop(false)
+    {
+        auto count = std::max(1u, std::thread::hardware_concurrency());
+        if(auto* threads = std::getenv("HIPTENSOR_CPU_THREADS"))
+        {
+            if(auto requested = std::atoi(threads); requested > 0)
+            {
+                count = static_cast<uint32_t>(requested);
+            }
+        }
+
+        // The calling thread is the remaining one
+        for(uint32_t i = 1u; i < count; i++)
+        {
+            mWorkers.emplace_back(&ThreadPool::workerLoop, this);
+        }
+    }
+
+    ThreadPool::~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mStop = true;
+        }
+        mWake.notify_all();
+
+        for(auto& worker : mWorkers)
+        {
+            worker.join();
+        }
+    }
+
+    void ThreadPool::parallelFor(std::size_t count, std::function<void(std::size_t)> const& func)
+    {
+        std::unique_lock<std::mutex> batch(mBatchMutex, std::try_to_lock);
+        if(!batch.owns_lock() || mWorkers.empty() || count <= 1u)
+        {
+            for(std::size_t i = 0; i < count; i++)
+            {
+                func(i);
+            }
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mFunc   = &func;
+            mCount  = count;
+            mNext   = 0;
+            mActive = mWorkers.size();
+            mGeneration++;
+        }
+        mWake.notify_all();
+
+        runTasks();
+
+        // Every worker checks in once per loop, so func outlives all uses
+        std::unique_lock<std::mutex> lock(mMutex);
+        mDone.wait(lock, [this] { return mActive == 0u; });
+        mFunc = nullptr;
+    }
+
+    uint32_t ThreadPool::threadCount() const
+    {
+        return static_cast<uint32_t>(mWorkers.size()) + 1u;
+    }
+
+    void ThreadPool::workerLoop()
+    {
+        uint64_t generation = 0;
+        while(true)
+        {
+            {
+                std::unique_lock<std::mutex> lock(mMutex);
+                mWake.wait(lock, [&] { return mStop || mGeneration != generation; });
+                if(mStop)
+                {
+                    return;
+                }
+                generation = mGeneration;
+            }
+
+            runTasks();
+
+            std::lock_guard<std::mutex> lock(mMutex);
+            if(--mActive == 0u)
+            {
+                mDone.notify_one();
+            }
+        }
+    }
+
+    void ThreadPool::runTasks()
+    {
+        for(auto i = mNext++; i < mCount; i = mNext++)
+        {
+            (*mFunc)(i);
+        }
+    }
+
+} // namespace hiptensor
@@ -0,0 +1,241 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <iostream>
+#include <vector>
+
+// hiptensor includes
+#include <hiptensor/hiptensor.hpp>
+#include <hiptensor/hiptensor_types.hpp>
+
+#include "contraction/contraction_cpu_reference_instances.hpp"
+#include "contraction/contraction_solution.hpp"
+
+// Validates the 3M (Gauss) decomposition used by the complex device ops: the same
+// chain of one scale and two bilinear real contractions, followed by the combine
+// step, is run with the real CPU reference solutions and compared against the
+// complex CPU reference.
+
+void printBool(bool in)
+{
+    std::cout << (in ? "PASSED" : "FAILED") << std::endl;
+}
+
+namespace
+{
+    using hiptensor::ContractionOpId_t;
+    using hiptensor::ContractionSolution;
+
+    // E[m0, m1, n0, n1] = A[m0, m1, k0, k1] * B[n0, n1, k0, k1] (+ D)
+    struct Problem
+    {
+        std::size_t M0 = 5, M1 = 3, N0 = 4, N1 = 6, K0 = 7, K1 = 2;
+
+        std::vector<std::size_t> aLengths = {M0, M1, K0, K1};
+        std::vector<std::size_t> aStrides = {1, M0, M0 * M1, M0 * M1 * K0};
+        std::vector<int32_t>     aModes   = {'m', 'n', 'u', 'v'};
+        std::vector<std::size_t> bLengths = {N0, N1, K0, K1};
+        std::vector<std::size_t> bStrides = {1, N0, N0 * N1, N0 * N1 * K0};
+        std::vector<int32_t>     bModes   = {'h', 'k', 'u', 'v'};
+        std::vector<std::size_t> eLengths = {M0, M1, N0, N1};
+        std::vector<std::size_t> eStrides = {1, M0, M0 * M1, M0 * M1 * N0};
+        std::vector<int32_t>     eModes   = {'m', 'n', 'h', 'k'};
+
+        std::size_t elementsA() const
+        {
+            return M0 * M1 * K0 * K1;
+        }
+        std::size_t elementsB() const
+        {
+            return N0 * N1 * K0 * K1;
+        }
+        std::size_t elementsE() const
+        {
+            return M0 * M1 * N0 * N1;
+        }
+    };
+
+    ContractionSolution*
+        findSolution(ContractionOpId_t opId, hipDataType type, hiptensorComputeType_t computeType)
+    {
+        auto& instances = hiptensor::ContractionCpuReferenceInstances::instance();
+        auto  solutionQ
+            = instances->allSolutions().query(opId).query(type, type, type, type, computeType);
+        if(solutionQ.solutionCount() == 0)
+        {
+            return nullptr;
+        }
+        return solutionQ.solutions().begin()->second;
+    }
+
+    bool run(ContractionSolution* solution,
+             Problem const&       p,
+             void const*          alpha,
+             void const*          A,
+             void const*          B,
+             void const*          beta,
+             void const*          D,
+             void*                E)
+    {
+        auto [errorCode, time] = (*solution)(alpha,
+                                             A,
+                                             B,
+                                             beta,
+                                             D,
+                                             E,
+                                             p.aLengths,
+                                             p.aStrides,
+                                             p.aModes,
+                                             p.bLengths,
+                                             p.bStrides,
+                                             p.bModes,
+                                             p.eLengths,
+                                             p.eStrides,
+                                             p.eModes,
+                                             p.eLengths,
+                                             p.eStrides,
+                                             p.eModes,
+                                             nullptr,
+                                             0);
+        return errorCode == HIPTENSOR_STATUS_SUCCESS;
+    }
+} // namespace
+
+bool complex3MTest(bool bilinear)
+{
+    auto* scale     = findSolution(ContractionOpId_t::SCALE, HIP_R_32F, HIPTENSOR_COMPUTE_32F);
+    auto* bilinearR = findSolution(ContractionOpId_t::BILINEAR, HIP_R_32F, HIPTENSOR_COMPUTE_32F);
+    auto* reference = findSolution(bilinear ? ContractionOpId_t::BILINEAR_COMPLEX
+                                            : ContractionOpId_t::SCALE_COMPLEX,
+                                   HIP_C_32F,
+                                   HIPTENSOR_COMPUTE_C32F);
+    if(scale == nullptr || bilinearR == nullptr || reference == nullptr)
+    {
+        return false;
+    }
+
+    Problem p;
+
+    // Complex inputs, and their planar (real, imag, real + imag) decomposition
+    std::vector<hipFloatComplex> A(p.elementsA()), B(p.elementsB());
+    std::vector<hipFloatComplex> D(p.elementsE()), E(p.elementsE());
+    std::vector<float>           Ar(A.size()), Ai(A.size()), As(A.size());
+    std::vector<float>           Br(B.size()), Bi(B.size()), Bs(B.size());
+
+    for(std::size_t i = 0; i < A.size(); i++)
+    {
+        A[i]  = make_hipFloatComplex(float(i % 7) * 0.25f - 0.75f,
+                                    float((i * 3) % 5) * 0.5f - 1.0f);
+        Ar[i] = A[i].x;
+        Ai[i] = A[i].y;
+        As[i] = A[i].x + A[i].y;
+    }
+    for(std::size_t i = 0; i < B.size(); i++)
+    {
+        B[i]  = make_hipFloatComplex(float((i * 5) % 9) * 0.125f - 0.5f, float(i % 4) * 0.25f);
+        Br[i] = B[i].x;
+        Bi[i] = B[i].y;
+        Bs[i] = B[i].x + B[i].y;
+    }
+    for(std::size_t i = 0; i < D.size(); i++)
+    {
+        D[i] = make_hipFloatComplex(float(i % 3), float(i % 5) * -0.5f);
+    }
+
+    hipFloatComplex alpha = make_hipFloatComplex(1.5f, -0.5f);
+    hipFloatComplex beta  = make_hipFloatComplex(-0.25f, 2.0f);
+
+    if(!run(reference,
+            p,
+            &alpha,
+            A.data(),
+            B.data(),
+            bilinear ? &beta : nullptr,
+            bilinear ? D.data() : nullptr,
+            E.data()))
+    {
+        return false;
+    }
+
+    // The 3M chain, as issued by DeviceContractionComplex3M:
+    //   Eimag  = -2 * Ar.Br
+    //   Ereal  = -1 * Ai.Bi - 0.5 * Eimag    (= Re(AB))
+    //   Eimag2 =  1 * As.Bs + 1.0 * Eimag    (= Im(AB) - Re(AB))
+    std::vector<float> Ereal(p.elementsE()), Eimag(p.elementsE()), Eimag2(p.elementsE());
+
+    float s0 = -2.0f;
+    float a1 = -1.0f, b1 = -0.5f;
+    float a2 = 1.0f, b2 = 1.0f;
+
+    if(!run(scale, p, &s0, Ar.data(), Br.data(), nullptr, nullptr, Eimag.data())
+       || !run(bilinearR, p, &a1, Ai.data(), Bi.data(), &b1, Eimag.data(), Ereal.data())
+       || !run(bilinearR, p, &a2, As.data(), Bs.data(), &b2, Eimag.data(), Eimag2.data()))
+    {
+        return false;
+    }
+
+    // Combine: restore Im(AB), then apply alpha / beta
+    for(std::size_t i = 0; i < E.size(); i++)
+    {
+        auto accum  = std::complex<float>(Ereal[i], Eimag2[i] + Ereal[i]);
+        auto result = accum * std::complex<float>(alpha.x, alpha.y);
+        if(bilinear)
+        {
+            result += std::complex<float>(D[i].x, D[i].y) * std::complex<float>(beta.x, beta.y);
+        }
+
+        auto ref = std::complex<float>(E[i].x, E[i].y);
+        if(std::abs(result - ref) > 1e-4f * std::max(1.0f, std::abs(ref)))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+int main(int argc, char* argv[])
+{
+    bool totalPass = true;
+    bool testPass  = false;
+
+    testPass = complex3MTest(true);
+    totalPass &= testPass;
+    std::cout << "3M bilinear complex contraction: ";
+    printBool(testPass);
+
+    testPass = complex3MTest(false);
+    totalPass &= testPass;
+    std::cout << "3M scale complex contraction: ";
+    printBool(testPass);
+
+    if(!totalPass)
+        return -1;
+    return 0;
+}
@@ -0,0 +1,198 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+// hiptensor includes
+#include <hiptensor/hiptensor.hpp>
+#include <hiptensor/hiptensor_types.hpp>
+
+#include "contraction/contraction_cpu_reference_instances.hpp"
+#include "contraction/contraction_solution.hpp"
+#include "thread_pool.hpp"
+
+// Checks the blocked CPU contraction engine behind the reference solutions
+// against a naive loop, on a problem with interleaved modes whose folded
+// M, N and K extents are not multiples of the engine tile sizes.
+
+void printBool(bool in)
+{
+    std::cout << (in ? "PASSED" : "FAILED") << std::endl;
+}
+
+bool threadPoolTest()
+{
+    auto& pool = hiptensor::ThreadPool::instance();
+    if(pool->threadCount() == 0u)
+    {
+        return false;
+    }
+
+    // Every index visited exactly once, nested loops run inline
+    constexpr std::size_t    count = 1000;
+    std::vector<std::size_t> visits(count, 0);
+    std::atomic<std::size_t> nested{0};
+    pool->parallelFor(count, [&](std::size_t i) {
+        visits[i]++;
+        pool->parallelFor(3, [&](std::size_t) { nested++; });
+    });
+
+    return std::all_of(visits.begin(), visits.end(), [](auto v) { return v == 1u; })
+           && nested == 3 * count;
+}
+
+// E[n0, m0, n1, m1] = alpha * A[m0, k0, m1, k1] * B[k1, n0, k0, n1] + beta * D
+bool rankMixedContractionTest()
+{
+    auto& instances = hiptensor::ContractionCpuReferenceInstances::instance();
+    auto  solutionQ = instances->allSolutions()
+                         .query(hiptensor::ContractionOpId_t::BILINEAR)
+                         .query(HIP_R_32F, HIP_R_32F, HIP_R_32F, HIP_R_32F, HIPTENSOR_COMPUTE_32F);
+    if(solutionQ.solutionCount() == 0)
+    {
+        return false;
+    }
+    auto* solution = solutionQ.solutions().begin()->second;
+
+    std::size_t M0 = 7, M1 = 9, N0 = 13, N1 = 11, K0 = 12, K1 = 25;
+
+    std::vector<std::size_t> aLengths = {M0, K0, M1, K1};
+    std::vector<std::size_t> aStrides = {1, M0, M0 * K0, M0 * K0 * M1};
+    std::vector<int32_t>     aModes   = {'m', 'k', 'n', 'l'};
+    std::vector<std::size_t> bLengths = {K1, N0, K0, N1};
+    std::vector<std::size_t> bStrides = {1, K1, K1 * N0, K1 * N0 * K0};
+    std::vector<int32_t>     bModes   = {'l', 'o', 'k', 'p'};
+    std::vector<std::size_t> eLengths = {N0, M0, N1, M1};
+    std::vector<std::size_t> eStrides = {1, N0, N0 * M0, N0 * M0 * N1};
+    std::vector<int32_t>     eModes   = {'o', 'm', 'p', 'n'};
+
+    std::vector<float> A(M0 * K0 * M1 * K1), B(K1 * N0 * K0 * N1);
+    std::vector<float> D(N0 * M0 * N1 * M1), E(D.size()), ref(D.size());
+    for(std::size_t i = 0; i < A.size(); i++)
+    {
+        A[i] = float(i % 13) * 0.125f - 0.75f;
+    }
+    for(std::size_t i = 0; i < B.size(); i++)
+    {
+        B[i] = float((i * 7) % 11) * 0.25f - 1.25f;
+    }
+    for(std::size_t i = 0; i < D.size(); i++)
+    {
+        D[i] = float(i % 5);
+    }
+
+    float alpha = 1.5f;
+    float beta  = -0.5f;
+
+    auto loopM = [&](auto&& func) {
+        for(std::size_t m1 = 0; m1 < M1; m1++)
+        {
+            for(std::size_t m0 = 0; m0 < M0; m0++)
+            {
+                func(m0, m1);
+            }
+        }
+    };
+
+    loopM([&](std::size_t m0, std::size_t m1) {
+        for(std::size_t n1 = 0; n1 < N1; n1++)
+        {
+            for(std::size_t n0 = 0; n0 < N0; n0++)
+            {
+                double accum = 0.0;
+                for(std::size_t k1 = 0; k1 < K1; k1++)
+                {
+                    for(std::size_t k0 = 0; k0 < K0; k0++)
+                    {
+                        auto indexA = m0 + k0 * aStrides[1] + m1 * aStrides[2] + k1 * aStrides[3];
+                        auto indexB = k1 + n0 * bStrides[1] + k0 * bStrides[2] + n1 * bStrides[3];
+                        accum += double(A[indexA]) * double(B[indexB]);
+                    }
+                }
+                auto indexE = n0 + m0 * eStrides[1] + n1 * eStrides[2] + m1 * eStrides[3];
+                ref[indexE] = float(alpha * accum + beta * D[indexE]);
+            }
+        }
+    });
+
+    auto [errorCode, time] = (*solution)(&alpha,
+                                         A.data(),
+                                         B.data(),
+                                         &beta,
+                                         D.data(),
+                                         E.data(),
+                                         aLengths,
+                                         aStrides,
+                                         aModes,
+                                         bLengths,
+                                         bStrides,
+                                         bModes,
+                                         eLengths,
+                                         eStrides,
+                                         eModes,
+                                         eLengths,
+                                         eStrides,
+                                         eModes,
+                                         nullptr,
+                                         0);
+    if(errorCode != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return false;
+    }
+
+    for(std::size_t i = 0; i < E.size(); i++)
+    {
+        if(std::abs(E[i] - ref[i]) > 1e-3f * std::max(1.0f, std::abs(ref[i])))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(int argc, char* argv[])
+{
+    bool totalPass = true;
+    bool testPass  = false;
+
+    testPass = threadPoolTest();
+    totalPass &= testPass;
+    std::cout << "Thread pool parallelFor: ";
+    printBool(testPass);
+
+    testPass = rankMixedContractionTest();
+    totalPass &= testPass;
+    std::cout << "CPU engine rank-mixed contraction: ";
+    printBool(testPass);
+
+    if(!totalPass)
+        return -1;
+    return 0;
+}
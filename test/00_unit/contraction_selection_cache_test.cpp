@@ -0,0 +1,417 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+#include <unistd.h>
+
+// hiptensor includes
+#include <hiptensor/hiptensor.hpp>
+#include <hiptensor/hiptensor_types.hpp>
+
+#include "contraction/contraction_cpu_reference_instances.hpp"
+#include "contraction/contraction_selection_cache.hpp"
+#include "contraction/contraction_solution.hpp"
+#include "logger.hpp"
+
+using hiptensor::ContractionSelectionCache;
+
+// Bilinear f32 problem: E[a,b,c,d] = A[a,b,k] * B[c,d,k]
+struct Problem
+{
+    std::vector<std::size_t> aLengths    = {4, 8, 16};
+    std::vector<std::size_t> aStrides    = {1, 4, 32};
+    std::vector<int32_t>     aModes      = {'a', 'b', 'k'};
+    std::vector<std::size_t> bLengths    = {2, 5, 16};
+    std::vector<std::size_t> bStrides    = {1, 2, 10};
+    std::vector<int32_t>     bModes      = {'c', 'd', 'k'};
+    std::vector<std::size_t> dLengths    = {4, 8, 2, 5};
+    std::vector<std::size_t> dStrides    = {1, 4, 32, 64};
+    std::vector<std::size_t> eLengths    = {4, 8, 2, 5};
+    std::vector<std::size_t> eStrides    = {1, 4, 32, 64};
+    std::vector<int32_t>     eModes      = {'a', 'b', 'c', 'd'};
+    uint32_t                 arch        = 0x90A;
+    hiptensorComputeType_t   typeCompute = HIPTENSOR_COMPUTE_32F;
+
+    ContractionSelectionCache::Key key() const
+    {
+        return ContractionSelectionCache::hashProblem(
+            (int32_t)hiptensor::ContractionOpId_t::BILINEAR,
+            HIP_R_32F,
+            HIP_R_32F,
+            HIP_R_32F,
+            HIP_R_32F,
+            typeCompute,
+            aLengths,
+            aStrides,
+            aModes,
+            bLengths,
+            bStrides,
+            bModes,
+            dLengths,
+            dStrides,
+            eModes,
+            eLengths,
+            eStrides,
+            eModes,
+            arch);
+    }
+};
+
+void printBool(bool in)
+{
+    std::cout << (in ? "PASSED" : "FAILED") << std::endl;
+}
+
+// Unique file that no other process can claim; the caller removes it.
+std::string makeTempFile()
+{
+    char name[] = "/tmp/hiptensor_selection_cache_XXXXXX";
+    int  fd     = mkstemp(name);
+    if(fd == -1)
+    {
+        return "";
+    }
+    close(fd);
+    return name;
+}
+
+hiptensor::ContractionSolution* referenceSolution()
+{
+    auto& instances = hiptensor::ContractionCpuReferenceInstances::instance();
+    auto  solutionQ = instances->allSolutions()
+                         .query(hiptensor::ContractionOpId_t::BILINEAR)
+                         .query(HIP_R_32F, HIP_R_32F, HIP_R_32F, HIP_R_32F, HIPTENSOR_COMPUTE_32F);
+
+    if(solutionQ.solutionCount() == 0)
+    {
+        return nullptr;
+    }
+    return solutionQ.solutions().begin()->second;
+}
+
+bool signatureTest()
+{
+    Problem ref;
+
+    // Mode labels don't matter, only their roles in the contraction
+    Problem relabeled;
+    relabeled.aModes = {'x', 'y', 'z'};
+    relabeled.bModes = {'u', 'v', 'z'};
+    relabeled.eModes = {'x', 'y', 'u', 'v'};
+
+    Problem otherArch;
+    otherArch.arch = 0x942;
+
+    Problem otherStrides;
+    otherStrides.aStrides = {16, 64, 1};
+
+    // Output layout matters as much as the inputs'
+    Problem otherDStrides;
+    otherDStrides.dStrides = {10, 40, 1, 2};
+
+    Problem otherEStrides;
+    otherEStrides.eStrides = {10, 40, 1, 2};
+
+    // No D, as for scale contractions
+    Problem noD;
+    noD.dLengths.clear();
+    noD.dStrides.clear();
+
+    Problem otherCompute;
+    otherCompute.typeCompute = HIPTENSOR_COMPUTE_16F;
+
+    return ref.key() == relabeled.key() && ref.key() != otherArch.key()
+           && ref.key() != otherStrides.key() && ref.key() != otherDStrides.key()
+           && ref.key() != otherEStrides.key() && otherDStrides.key() != otherEStrides.key()
+           && ref.key() != noD.key() && ref.key() != otherCompute.key();
+}
+
+bool roundTripTest()
+{
+    auto* solution = referenceSolution();
+    if(solution == nullptr)
+    {
+        return false;
+    }
+
+    Problem problem;
+    auto    fileName = makeTempFile();
+    auto&   cache    = ContractionSelectionCache::instance();
+    if(fileName.empty())
+    {
+        return false;
+    }
+
+    cache->clear();
+    cache->insert(problem.key(), solution->uid());
+    if(cache->write(fileName) != HIPTENSOR_STATUS_SUCCESS)
+    {
+        std::remove(fileName.c_str());
+        return false;
+    }
+
+    cache->clear();
+    if(cache->load(fileName) != HIPTENSOR_STATUS_SUCCESS || cache->size() != 1u)
+    {
+        std::remove(fileName.c_str());
+        return false;
+    }
+
+    // The cached uid must resolve back to the same registered solution,
+    // and that solution must still accept the problem.
+    ContractionSelectionCache::Uid uid;
+    bool                           result = cache->lookup(problem.key(), &uid);
+
+    auto& instances = hiptensor::ContractionCpuReferenceInstances::instance();
+    auto  solutions = instances->allSolutions().solutions();
+    auto  it        = solutions.find(uid);
+    result &= (it != solutions.end()) && (it->second == solution);
+
+    hiptensor::ContractionArgs args;
+    result &= solution->initArgs(args,
+                                 nullptr,
+                                 nullptr,
+                                 nullptr,
+                                 nullptr,
+                                 nullptr,
+                                 nullptr,
+                                 problem.aLengths,
+                                 problem.aStrides,
+                                 problem.aModes,
+                                 problem.bLengths,
+                                 problem.bStrides,
+                                 problem.bModes,
+                                 problem.dLengths,
+                                 problem.dStrides,
+                                 problem.eModes,
+                                 problem.eLengths,
+                                 problem.eStrides,
+                                 problem.eModes,
+                                 nullptr);
+
+    cache->clear();
+    std::remove(fileName.c_str());
+    return result;
+}
+
+bool versionMismatchTest()
+{
+    auto fileName = makeTempFile();
+    if(fileName.empty())
+    {
+        return false;
+    }
+
+    {
+        std::ofstream file(fileName);
+        file << "hiptensor_selection_cache " << ContractionSelectionCache::Version + 1 << "\n"
+             << "1234 5678\n";
+    }
+
+    auto& cache = ContractionSelectionCache::instance();
+    cache->clear();
+
+    bool result = (cache->load(fileName) == HIPTENSOR_STATUS_IO_ERROR) && (cache->size() == 0u);
+
+    cache->clear();
+    std::remove(fileName.c_str());
+    return result;
+}
+
+bool missingFileTest()
+{
+    auto& cache = ContractionSelectionCache::instance();
+    cache->clear();
+
+    // Claim a unique name, then remove the file so that it doesn't exist
+    auto fileName = makeTempFile();
+    std::remove(fileName.c_str());
+
+    bool result = !fileName.empty() && (cache->load(fileName) == HIPTENSOR_STATUS_IO_ERROR)
+                  && (cache->fileName() == fileName) && (cache->size() == 0u);
+
+    cache->clear();
+    return result;
+}
+
+// Counts the candidates timed by brute-force selection
+static std::atomic<int> sTimedCandidates{0};
+
+void countTimedCandidates(int32_t logContext, const char* funcName, const char* msg)
+{
+    if(std::strcmp(funcName, "BRUTE_FORCE_KERNEL_PERF") == 0)
+    {
+        sTimedCandidates++;
+    }
+}
+
+bool cacheHitTest()
+{
+    Problem problem;
+
+    hiptensorHandle_t* handle;
+    if(hiptensorCreate(&handle) != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return false;
+    }
+
+    auto toInt64 = [](std::vector<std::size_t> const& v) {
+        return std::vector<int64_t>(v.begin(), v.end());
+    };
+    auto aLengths = toInt64(problem.aLengths), aStrides = toInt64(problem.aStrides);
+    auto bLengths = toInt64(problem.bLengths), bStrides = toInt64(problem.bStrides);
+    auto eLengths = toInt64(problem.eLengths), eStrides = toInt64(problem.eStrides);
+
+    hiptensorTensorDescriptor_t descA, descB, descE;
+    hiptensorInitTensorDescriptor(handle,
+                                  &descA,
+                                  aLengths.size(),
+                                  aLengths.data(),
+                                  aStrides.data(),
+                                  HIP_R_32F,
+                                  HIPTENSOR_OP_IDENTITY);
+    hiptensorInitTensorDescriptor(handle,
+                                  &descB,
+                                  bLengths.size(),
+                                  bLengths.data(),
+                                  bStrides.data(),
+                                  HIP_R_32F,
+                                  HIPTENSOR_OP_IDENTITY);
+    hiptensorInitTensorDescriptor(handle,
+                                  &descE,
+                                  eLengths.size(),
+                                  eLengths.data(),
+                                  eStrides.data(),
+                                  HIP_R_32F,
+                                  HIPTENSOR_OP_IDENTITY);
+
+    hiptensorContractionDescriptor_t desc;
+    hiptensorInitContractionDescriptor(handle,
+                                       &desc,
+                                       &descA,
+                                       problem.aModes.data(),
+                                       16,
+                                       &descB,
+                                       problem.bModes.data(),
+                                       16,
+                                       &descE,
+                                       problem.eModes.data(),
+                                       16,
+                                       &descE,
+                                       problem.eModes.data(),
+                                       16,
+                                       HIPTENSOR_COMPUTE_32F);
+
+    hiptensorContractionFind_t find;
+    hiptensorInitContractionFind(handle, &find, HIPTENSOR_ALGO_DEFAULT);
+
+    uint64_t workspaceSize = 0;
+    hiptensorContractionGetWorkspaceSize(
+        handle, &desc, &find, HIPTENSOR_WORKSPACE_RECOMMENDED, &workspaceSize);
+
+    // The plan cache would hide the selection cache, keep it out of the way
+    hiptensorHandleResizePlanCache(handle, 0u);
+
+    auto& cache = ContractionSelectionCache::instance();
+    cache->clear();
+
+    auto mask = hiptensor::Logger::instance()->getLogMask();
+    hiptensorLoggerSetMask(HIPTENSOR_LOG_LEVEL_HEURISTICS_TRACE);
+    hiptensorLoggerSetCallback(countTimedCandidates);
+
+    // Miss: all candidates are timed and the winner is recorded
+    hiptensorContractionPlan_t plan;
+    sTimedCandidates = 0;
+    bool result      = hiptensorInitContractionPlan(handle, &plan, &desc, &find, workspaceSize)
+                  == HIPTENSOR_STATUS_SUCCESS;
+    result &= sTimedCandidates > 0 && cache->size() == 1u;
+
+    // Hit: the recorded winner is re-used without timing
+    hiptensorContractionPlan_t cachedPlan;
+    sTimedCandidates = 0;
+    result &= hiptensorInitContractionPlan(handle, &cachedPlan, &desc, &find, workspaceSize)
+              == HIPTENSOR_STATUS_SUCCESS;
+    result &= sTimedCandidates == 0 && cachedPlan.mSolution == plan.mSolution;
+
+    hiptensorLoggerSetCallback(nullptr);
+    hiptensorLoggerSetMask(mask);
+
+    cache->clear();
+    hiptensorDestroy(handle);
+    return result;
+}
+
+bool apiNullHandleTest()
+{
+    return hiptensorContractionSelectionCacheLoad(nullptr, "cache.txt")
+               == HIPTENSOR_STATUS_NOT_INITIALIZED
+           && hiptensorContractionSelectionCacheWrite(nullptr, "cache.txt")
+                  == HIPTENSOR_STATUS_NOT_INITIALIZED;
+}
+
+int main(int argc, char* argv[])
+{
+    bool totalPass = true;
+    bool testPass  = false;
+
+    testPass = signatureTest();
+    totalPass &= testPass;
+    std::cout << "Selection cache signature: ";
+    printBool(testPass);
+
+    testPass = roundTripTest();
+    totalPass &= testPass;
+    std::cout << "Selection cache round trip: ";
+    printBool(testPass);
+
+    testPass = versionMismatchTest();
+    totalPass &= testPass;
+    std::cout << "Selection cache version mismatch: ";
+    printBool(testPass);
+
+    testPass = missingFileTest();
+    totalPass &= testPass;
+    std::cout << "Selection cache missing file: ";
+    printBool(testPass);
+
+    testPass = cacheHitTest();
+    totalPass &= testPass;
+    std::cout << "Selection cache hit skips timing: ";
+    printBool(testPass);
+
+    testPass = apiNullHandleTest();
+    totalPass &= testPass;
+    std::cout << "Selection cache API null handle: ";
+    printBool(testPass);
+
+    if(!totalPass)
+        return -1;
+    return 0;
+}
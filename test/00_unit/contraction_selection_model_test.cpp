@@ -0,0 +1,333 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+// hiptensor includes
+#include <hiptensor/hiptensor.hpp>
+#include <hiptensor/hiptensor_types.hpp>
+
+#include "contraction/contraction_cpu_reference_instances.hpp"
+#include "contraction/contraction_selection.hpp"
+#include "contraction/contraction_selection_model.hpp"
+#include "contraction/contraction_solution.hpp"
+#include "data_types.hpp"
+
+using hiptensor::ContractionSelectionModel;
+
+// Bilinear f32 problem: E[a,b,c,d] = A[a,b,k] * B[c,d,k]
+struct Problem
+{
+    std::vector<std::size_t> aLengths = {4, 8, 16};
+    std::vector<std::size_t> aStrides = {1, 4, 32};
+    std::vector<int32_t>     aModes   = {'a', 'b', 'k'};
+    std::vector<std::size_t> bLengths = {2, 5, 16};
+    std::vector<std::size_t> bStrides = {1, 2, 10};
+    std::vector<int32_t>     bModes   = {'c', 'd', 'k'};
+    std::vector<std::size_t> eLengths = {4, 8, 2, 5};
+    std::vector<std::size_t> eStrides = {1, 4, 32, 64};
+    std::vector<int32_t>     eModes   = {'a', 'b', 'c', 'd'};
+    uint32_t                 arch     = 0x90A;
+
+    ContractionSelectionModel::Features features() const
+    {
+        return ContractionSelectionModel::makeFeatures(
+            (int32_t)hiptensor::ContractionOpId_t::BILINEAR,
+            HIP_R_32F,
+            HIP_R_32F,
+            HIP_R_32F,
+            HIP_R_32F,
+            HIPTENSOR_COMPUTE_32F,
+            aLengths,
+            aStrides,
+            aModes,
+            bLengths,
+            bStrides,
+            bModes,
+            eModes,
+            arch);
+    }
+};
+
+void printBool(bool in)
+{
+    std::cout << (in ? "PASSED" : "FAILED") << std::endl;
+}
+
+hiptensorStatus_t readModel(std::string const& text)
+{
+    std::istringstream stream(text);
+    return ContractionSelectionModel::instance()->read(stream);
+}
+
+hiptensor::ContractionSolution* referenceSolution()
+{
+    auto& instances = hiptensor::ContractionCpuReferenceInstances::instance();
+    auto  solutionQ = instances->allSolutions()
+                         .query(hiptensor::ContractionOpId_t::BILINEAR)
+                         .query(HIP_R_32F, HIP_R_32F, HIP_R_32F, HIP_R_32F, HIPTENSOR_COMPUTE_32F);
+
+    if(solutionQ.solutionCount() == 0)
+    {
+        return nullptr;
+    }
+    return solutionQ.solutions().begin()->second;
+}
+
+bool builtInTest()
+{
+    auto& model = ContractionSelectionModel::instance();
+    model->reset();
+
+    return model->size() > 0u && model->fileName().empty();
+}
+
+bool featuresTest()
+{
+    Problem problem;
+    auto    features = problem.features();
+
+    Problem transposed;
+    transposed.aStrides = {16, 64, 1};
+    transposed.bLengths = {2, 5, 1};
+    auto other          = transposed.features();
+
+    return features.mRankM == 2u && features.mRankN == 2u && features.mRankK == 1u
+           && features.mM == 32u && features.mN == 10u && features.mK == 16u
+           && !features.mContiguousKA && !features.mContiguousKB && !features.mUnitExtent
+           && other.mContiguousKA && other.mUnitExtent;
+}
+
+// The first matching rule wins, features left out match anything
+bool rulesTest()
+{
+    auto result = readModel("# comment\n"
+                            "hiptensor_selection_model 1\n"
+                            "op=bilinear arch=gfx942 uid=1\n"
+                            "op=bilinear a=HIP_R_32F m=64: uid=2\n"
+                            "op=bilinear a=HIP_R_32F rank_m=2 layout_a=m k=16 uid=3 # inline\n"
+                            "op=scale uid=4\n"
+                            "uid=5\n"
+                            "uid=3\n");
+
+    Problem problem;
+    auto    uids = ContractionSelectionModel::instance()->query(problem.features());
+
+    problem.arch = 0x942;
+    auto archUids = ContractionSelectionModel::instance()->query(problem.features());
+
+    ContractionSelectionModel::instance()->reset();
+    return result == HIPTENSOR_STATUS_SUCCESS && uids == std::vector<std::size_t>{3u, 5u}
+           && archUids == std::vector<std::size_t>{1u, 3u, 5u};
+}
+
+// Malformed tables leave the rules as they are
+bool malformedTest()
+{
+    auto& model = ContractionSelectionModel::instance();
+    model->reset();
+    auto size = model->size();
+
+    return readModel("hiptensor_selection_model 1\nop=bilinear\n") == HIPTENSOR_STATUS_IO_ERROR
+           && readModel("hiptensor_selection_model 1\nsize=3 uid=1\n")
+                  == HIPTENSOR_STATUS_IO_ERROR
+           && readModel("hiptensor_selection_model 1\na=HIP_R_33F uid=1\n")
+                  == HIPTENSOR_STATUS_IO_ERROR
+           && readModel("hiptensor_selection_model 1\nm=1:x uid=1\n") == HIPTENSOR_STATUS_IO_ERROR
+           && readModel("hiptensor_selection_model 2\nuid=1\n") == HIPTENSOR_STATUS_IO_ERROR
+           && readModel("uid=1\n") == HIPTENSOR_STATUS_IO_ERROR && model->size() == size;
+}
+
+// Rules written out read back the same, and exact rules match only their problem
+bool stringTest()
+{
+    auto line = std::string("op=bilinear a=HIP_R_32F d=HIP_TYPE_NONE "
+                            "compute=HIPTENSOR_COMPUTE_32F arch=gfx942 rank_k=1 m=64: n=:32 "
+                            "k=16 layout_a=m layout_b=k unit=0 uid=9 # comment");
+
+    ContractionSelectionModel::Rule rule;
+    if(!ContractionSelectionModel::fromString(line, rule)
+       || ContractionSelectionModel::toString(rule) != line.substr(0, line.find(" #")))
+    {
+        return false;
+    }
+
+    Problem problem;
+    auto    features = problem.features();
+
+    ContractionSelectionModel::Rule exact;
+    exact.mContractionOpId = features.mContractionOpId;
+    exact.mTypeA           = features.mTypeA;
+    exact.mTypeB           = features.mTypeB;
+    exact.mTypeD           = features.mTypeD;
+    exact.mTypeE           = features.mTypeE;
+    exact.mTypeCompute     = features.mTypeCompute;
+    exact.mDeviceArch      = features.mDeviceArch;
+    exact.mRankM           = features.mRankM;
+    exact.mRankN           = features.mRankN;
+    exact.mRankK           = features.mRankK;
+    exact.mM               = ContractionSelectionModel::Range{features.mM, features.mM};
+    exact.mN               = ContractionSelectionModel::Range{features.mN, features.mN};
+    exact.mK               = ContractionSelectionModel::Range{features.mK, features.mK};
+    exact.mContiguousKA    = features.mContiguousKA;
+    exact.mContiguousKB    = features.mContiguousKB;
+    exact.mUnitExtent      = features.mUnitExtent;
+    exact.mUid             = 11u;
+
+    ContractionSelectionModel::Rule parsed;
+
+    auto text   = ContractionSelectionModel::toString(exact);
+    auto result = ContractionSelectionModel::fromString(text, parsed) && parsed.matches(features)
+                  && parsed.mUid == 11u;
+
+    problem.bLengths[2] = 8u;
+    problem.aLengths[2] = 8u;
+    return result && !parsed.matches(problem.features())
+           && !ContractionSelectionModel::fromString("hiptensor_selection_model 1", rule)
+           && !ContractionSelectionModel::fromString("# uid=1", rule);
+}
+
+bool loadTest()
+{
+    auto fileName = std::string(std::tmpnam(nullptr));
+    {
+        std::ofstream file(fileName);
+        file << "hiptensor_selection_model " << ContractionSelectionModel::Version << "\n"
+             << "op=bilinear uid=7\n";
+    }
+
+    auto& model  = ContractionSelectionModel::instance();
+    bool  result = model->load(fileName) == HIPTENSOR_STATUS_SUCCESS && model->size() == 1u
+                  && model->fileName() == fileName
+                  && model->load(fileName + ".missing") == HIPTENSOR_STATUS_IO_ERROR
+                  && model->size() == 1u;
+
+    model->reset();
+    std::remove(fileName.c_str());
+    return result && model->fileName().empty();
+}
+
+// Rules naming solutions that are not candidates fall through to the next rule
+bool selectionTest()
+{
+    auto* solution = referenceSolution();
+    if(solution == nullptr)
+    {
+        return false;
+    }
+
+    std::unordered_map<std::size_t, hiptensor::ContractionSolution*> candidates
+        = {{solution->uid(), solution}};
+
+    auto select = [&candidates](hiptensor::ContractionSolution** winner) {
+        Problem problem;
+        return hiptensor::actorCriticModel(winner,
+                                           candidates,
+                                           (int32_t)hiptensor::ContractionOpId_t::BILINEAR,
+                                           HIP_R_32F,
+                                           problem.aLengths,
+                                           problem.aStrides,
+                                           problem.aModes,
+                                           HIP_R_32F,
+                                           problem.bLengths,
+                                           problem.bStrides,
+                                           problem.bModes,
+                                           HIP_R_32F,
+                                           problem.eLengths,
+                                           problem.eStrides,
+                                           problem.eModes,
+                                           HIP_R_32F,
+                                           problem.eLengths,
+                                           problem.eStrides,
+                                           problem.eModes,
+                                           HIPTENSOR_COMPUTE_32F,
+                                           0u,
+                                           problem.arch);
+    };
+
+    std::stringstream table;
+    table << "hiptensor_selection_model 1\nuid=1\nuid=" << solution->uid() << "\n";
+
+    hiptensor::ContractionSolution* winner = nullptr;
+
+    auto hit = readModel(table.str()) == HIPTENSOR_STATUS_SUCCESS
+               && select(&winner) == HIPTENSOR_STATUS_SUCCESS && winner == solution;
+
+    winner    = nullptr;
+    auto miss = readModel("hiptensor_selection_model 1\nuid=1\n") == HIPTENSOR_STATUS_SUCCESS
+                && select(&winner) == HIPTENSOR_STATUS_EXECUTION_FAILED && winner == nullptr;
+
+    ContractionSelectionModel::instance()->reset();
+    return hit && miss;
+}
+
+int main(int argc, char* argv[])
+{
+    bool totalPass = true;
+    bool testPass  = false;
+
+    testPass = builtInTest();
+    totalPass &= testPass;
+    std::cout << "Selection model built-in table: ";
+    printBool(testPass);
+
+    testPass = featuresTest();
+    totalPass &= testPass;
+    std::cout << "Selection model features: ";
+    printBool(testPass);
+
+    testPass = rulesTest();
+    totalPass &= testPass;
+    std::cout << "Selection model rule order: ";
+    printBool(testPass);
+
+    testPass = malformedTest();
+    totalPass &= testPass;
+    std::cout << "Selection model malformed tables: ";
+    printBool(testPass);
+
+    testPass = stringTest();
+    totalPass &= testPass;
+    std::cout << "Selection model rule strings: ";
+    printBool(testPass);
+
+    testPass = loadTest();
+    totalPass &= testPass;
+    std::cout << "Selection model load: ";
+    printBool(testPass);
+
+    testPass = selectionTest();
+    totalPass &= testPass;
+    std::cout << "Selection model kernel selection: ";
+    printBool(testPass);
+
+    if(!totalPass)
+        return -1;
+    return 0;
+}
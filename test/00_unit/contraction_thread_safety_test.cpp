@@ -0,0 +1,340 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+// hiptensor includes
+#include <hiptensor/hiptensor.hpp>
+#include <hiptensor/hiptensor_types.hpp>
+
+#include "contraction/contraction_cpu_reference_instances.hpp"
+#include "contraction/contraction_solution.hpp"
+
+// Executes one shared ContractionSolution from many threads at once,
+// each with its own problem shape, data and scalars.
+
+void printBool(bool in)
+{
+    std::cout << (in ? "PASSED" : "FAILED") << std::endl;
+}
+
+hiptensor::ContractionSolution* referenceSolution()
+{
+    auto& instances = hiptensor::ContractionCpuReferenceInstances::instance();
+    auto  solutionQ = instances->allSolutions()
+                         .query(hiptensor::ContractionOpId_t::BILINEAR)
+                         .query(HIP_R_32F, HIP_R_32F, HIP_R_32F, HIP_R_32F, HIPTENSOR_COMPUTE_32F);
+
+    if(solutionQ.solutionCount() == 0)
+    {
+        return nullptr;
+    }
+    return solutionQ.solutions().begin()->second;
+}
+
+// E[m, n] = alpha * A[m, k] * B[n, k] + beta * D[m, n], column major
+bool runProblem(hiptensor::ContractionSolution const* solution,
+                int                                   threadId,
+                int                                   iterations)
+{
+    std::size_t M = 8 + threadId % 5;
+    std::size_t N = 6 + threadId % 3;
+    std::size_t K = 5 + threadId % 7;
+
+    std::vector<std::size_t> aLengths = {M, K};
+    std::vector<std::size_t> aStrides = {1, M};
+    std::vector<int32_t>     aModes   = {'m', 'k'};
+    std::vector<std::size_t> bLengths = {N, K};
+    std::vector<std::size_t> bStrides = {1, N};
+    std::vector<int32_t>     bModes   = {'n', 'k'};
+    std::vector<std::size_t> eLengths = {M, N};
+    std::vector<std::size_t> eStrides = {1, M};
+    std::vector<int32_t>     eModes   = {'m', 'n'};
+
+    std::vector<float> A(M * K), B(N * K), D(M * N), E(M * N), ref(M * N);
+    for(std::size_t i = 0; i < A.size(); i++)
+    {
+        A[i] = float((i + threadId) % 11) * 0.25f;
+    }
+    for(std::size_t i = 0; i < B.size(); i++)
+    {
+        B[i] = float((i * 3 + threadId) % 7) * 0.5f;
+    }
+    for(std::size_t i = 0; i < D.size(); i++)
+    {
+        D[i] = float(i % 5);
+    }
+
+    float alpha = 1.0f + 0.5f * threadId;
+    float beta  = 2.0f - 0.25f * threadId;
+
+    for(std::size_t n = 0; n < N; n++)
+    {
+        for(std::size_t m = 0; m < M; m++)
+        {
+            float accum = 0.0f;
+            for(std::size_t k = 0; k < K; k++)
+            {
+                accum += A[m + k * M] * B[n + k * N];
+            }
+            ref[m + n * M] = alpha * accum + beta * D[m + n * M];
+        }
+    }
+
+    for(int i = 0; i < iterations; i++)
+    {
+        std::fill(E.begin(), E.end(), 0.0f);
+
+        auto [errorCode, time] = (*solution)(&alpha,
+                                             A.data(),
+                                             B.data(),
+                                             &beta,
+                                             D.data(),
+                                             E.data(),
+                                             aLengths,
+                                             aStrides,
+                                             aModes,
+                                             bLengths,
+                                             bStrides,
+                                             bModes,
+                                             eLengths,
+                                             eStrides,
+                                             eModes,
+                                             eLengths,
+                                             eStrides,
+                                             eModes,
+                                             nullptr,
+                                             0);
+
+        if(errorCode != HIPTENSOR_STATUS_SUCCESS)
+        {
+            return false;
+        }
+
+        for(std::size_t j = 0; j < E.size(); j++)
+        {
+            if(std::abs(E[j] - ref[j]) > 1e-4f * std::max(1.0f, std::abs(ref[j])))
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+bool sharedSolutionStressTest()
+{
+    auto* solution = referenceSolution();
+    if(solution == nullptr)
+    {
+        return false;
+    }
+
+    constexpr int threadCount = 16;
+    constexpr int iterations  = 20;
+
+    std::atomic<int>         failures{0};
+    std::vector<std::thread> threads;
+    for(int t = 0; t < threadCount; t++)
+    {
+        threads.emplace_back([&, t]() {
+            if(!runProblem(solution, t, iterations))
+            {
+                failures++;
+            }
+        });
+    }
+
+    for(auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    return failures == 0;
+}
+
+bool callerOwnedArgsTest()
+{
+    auto* solution = referenceSolution();
+    if(solution == nullptr)
+    {
+        return false;
+    }
+
+    // Arguments built for one problem stay intact while
+    // the same solution is initialized for another.
+    hiptensor::ContractionArgs small, large;
+    auto                       init = [&](hiptensor::ContractionArgs& args, std::size_t extent) {
+        std::vector<std::size_t> lengths = {extent, extent};
+        std::vector<std::size_t> strides = {1, extent};
+        return solution->initArgs(args,
+                                  nullptr,
+                                  nullptr,
+                                  nullptr,
+                                  nullptr,
+                                  nullptr,
+                                  nullptr,
+                                  lengths,
+                                  strides,
+                                  {'m', 'k'},
+                                  lengths,
+                                  strides,
+                                  {'n', 'k'},
+                                  lengths,
+                                  strides,
+                                  {'m', 'n'},
+                                  lengths,
+                                  strides,
+                                  {'m', 'n'},
+                                  nullptr);
+    };
+
+    bool result = init(small, 4) && init(large, 32);
+    result &= small.problemDims() == std::make_tuple(4, 4, 4);
+    result &= large.problemDims() == std::make_tuple(32, 32, 32);
+
+    return result;
+}
+
+bool prebuiltArgsTest()
+{
+    auto* solution = referenceSolution();
+    if(solution == nullptr)
+    {
+        return false;
+    }
+
+    // E[m, n] = alpha * A[m, k] * B[n, k] + beta * D[m, n], column major
+    std::size_t              M = 12, N = 10, K = 7;
+    std::vector<std::size_t> aLengths = {M, K};
+    std::vector<std::size_t> aStrides = {1, M};
+    std::vector<std::size_t> bLengths = {N, K};
+    std::vector<std::size_t> bStrides = {1, N};
+    std::vector<std::size_t> eLengths = {M, N};
+    std::vector<std::size_t> eStrides = {1, M};
+
+    // Initialized once without data, as done at plan time
+    hiptensor::ContractionArgs args;
+    if(!solution->initArgs(args,
+                           nullptr,
+                           nullptr,
+                           nullptr,
+                           nullptr,
+                           nullptr,
+                           nullptr,
+                           aLengths,
+                           aStrides,
+                           {'m', 'k'},
+                           bLengths,
+                           bStrides,
+                           {'n', 'k'},
+                           eLengths,
+                           eStrides,
+                           {'m', 'n'},
+                           eLengths,
+                           eStrides,
+                           {'m', 'n'},
+                           nullptr))
+    {
+        return false;
+    }
+
+    // Each execution only patches in data pointers and scalars.
+    // Buffers and scalars keep their addresses while their values change.
+    std::vector<float> A(M * K), B(N * K), D(M * N), E(M * N);
+    float              alpha, beta;
+
+    bool result = true;
+    for(int i = 0; i < 4; i++)
+    {
+        std::fill(E.begin(), E.end(), 0.0f);
+        for(std::size_t j = 0; j < A.size(); j++)
+        {
+            A[j] = float((j + i) % 9) * 0.5f;
+        }
+        for(std::size_t j = 0; j < B.size(); j++)
+        {
+            B[j] = float((j * 5 + i) % 4);
+        }
+        for(std::size_t j = 0; j < D.size(); j++)
+        {
+            D[j] = float(j % 3 + i);
+        }
+
+        alpha = 0.5f + i;
+        beta  = 1.5f - i;
+
+        auto [errorCode, time] = (*solution)(
+            args, &alpha, A.data(), B.data(), &beta, D.data(), E.data(), nullptr, 0);
+        result &= errorCode == HIPTENSOR_STATUS_SUCCESS;
+
+        for(std::size_t n = 0; n < N; n++)
+        {
+            for(std::size_t m = 0; m < M; m++)
+            {
+                float accum = 0.0f;
+                for(std::size_t k = 0; k < K; k++)
+                {
+                    accum += A[m + k * M] * B[n + k * N];
+                }
+                float ref = alpha * accum + beta * D[m + n * M];
+                result &= std::abs(E[m + n * M] - ref) <= 1e-4f * std::max(1.0f, std::abs(ref));
+            }
+        }
+    }
+
+    return result;
+}
+
+int main(int argc, char* argv[])
+{
+    bool totalPass = true;
+    bool testPass  = false;
+
+    testPass = callerOwnedArgsTest();
+    totalPass &= testPass;
+    std::cout << "Contraction caller owned args: ";
+    printBool(testPass);
+
+    testPass = prebuiltArgsTest();
+    totalPass &= testPass;
+    std::cout << "Contraction pre-built args: ";
+    printBool(testPass);
+
+    testPass = sharedSolutionStressTest();
+    totalPass &= testPass;
+    std::cout << "Contraction shared solution stress: ";
+    printBool(testPass);
+
+    if(!totalPass)
+        return -1;
+    return 0;
+}
@@ -0,0 +1,75 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <iostream>
+
+#include "hip_device.hpp"
+
+// Device properties are queried once per device id and shared afterwards.
+
+void printBool(bool in)
+{
+    std::cout << (in ? "PASSED" : "FAILED") << std::endl;
+}
+
+bool memoizedPropertiesTest()
+{
+    auto  deviceId = hiptensor::HipDevice::currentDeviceId();
+    auto& first    = hiptensor::HipDevice::fromId(deviceId);
+    auto& second   = hiptensor::HipDevice::fromId(deviceId);
+
+    // Same cached object, and the current device copies it
+    auto current = hiptensor::HipDevice();
+    return &first == &second && current.getDeviceId() == first.getDeviceId()
+           && current.getGcnArch() == first.getGcnArch() && current.cuCount() == first.cuCount();
+}
+
+bool missingDeviceTest()
+{
+    auto& device = hiptensor::HipDevice::fromId(-1);
+    return device.getDeviceId() == -1
+           && device.getGcnArch() == hiptensor::HipDevice::hipGcnArch_t::UNSUPPORTED_ARCH;
+}
+
+int main(int argc, char* argv[])
+{
+    bool totalPass = true;
+    bool testPass  = false;
+
+    testPass = memoizedPropertiesTest();
+    totalPass &= testPass;
+    std::cout << "HipDevice memoized properties: ";
+    printBool(testPass);
+
+    testPass = missingDeviceTest();
+    totalPass &= testPass;
+    std::cout << "HipDevice missing device: ";
+    printBool(testPass);
+
+    if(!totalPass)
+        return -1;
+    return 0;
+}
@@ -0,0 +1,1034 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+// hiptensor includes
+#include <hiptensor/hiptensor.hpp>
+#include <hiptensor/hiptensor_types.hpp>
+
+// Runs contraction, permutation and reduction through the public API
+// on the host backend, with host pointers only.
+
+void printBool(bool in)
+{
+    std::cout << (in ? "PASSED" : "FAILED") << std::endl;
+}
+
+bool nearlyEqual(std::vector<float> const& result, std::vector<float> const& ref)
+{
+    for(std::size_t i = 0; i < ref.size(); i++)
+    {
+        if(std::abs(result[i] - ref[i]) > 1e-4f * std::max(1.0f, std::abs(ref[i])))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool backendSelectionTest(hiptensorHandle_t* handle)
+{
+    hiptensorBackend_t backend;
+    return hiptensorHandleSetBackend(handle, HIPTENSOR_BACKEND_HOST) == HIPTENSOR_STATUS_SUCCESS
+           && hiptensorHandleGetBackend(handle, &backend) == HIPTENSOR_STATUS_SUCCESS
+           && backend == HIPTENSOR_BACKEND_HOST
+           && hiptensorHandleSetBackend(handle, (hiptensorBackend_t)7)
+                  == HIPTENSOR_STATUS_INVALID_VALUE;
+}
+
+// D[m, n] = alpha * A[m, k] * B[n, k] + beta * C[m, n]
+bool hostContractionTest(hiptensorHandle_t* handle)
+{
+    int64_t M = 37, N = 29, K = 45;
+
+    std::vector<int64_t> aLengths = {M, K}, bLengths = {N, K}, cLengths = {M, N};
+    std::vector<int32_t> aModes = {'m', 'k'}, bModes = {'n', 'k'}, cModes = {'m', 'n'};
+
+    std::vector<float> A(M * K), B(N * K), C(M * N), D(M * N), ref(M * N);
+    for(std::size_t i = 0; i < A.size(); i++)
+    {
+        A[i] = float(i % 7) * 0.5f;
+    }
+    for(std::size_t i = 0; i < B.size(); i++)
+    {
+        B[i] = float(i % 5) - 2.0f;
+    }
+    for(std::size_t i = 0; i < C.size(); i++)
+    {
+        C[i] = float(i % 3);
+    }
+
+    float alpha = 2.0f, beta = 0.5f;
+    for(int64_t n = 0; n < N; n++)
+    {
+        for(int64_t m = 0; m < M; m++)
+        {
+            float accum = 0.0f;
+            for(int64_t k = 0; k < K; k++)
+            {
+                accum += A[m + k * M] * B[n + k * N];
+            }
+            ref[m + n * M] = alpha * accum + beta * C[m + n * M];
+        }
+    }
+
+    hiptensorTensorDescriptor_t descA, descB, descC;
+
+    hiptensorContractionDescriptor_t desc;
+    hiptensorContractionFind_t       find;
+    hiptensorContractionPlan_t       plan;
+    uint64_t                         worksize = 0;
+
+    if(hiptensorInitTensorDescriptor(
+           handle, &descA, 2, aLengths.data(), nullptr, HIP_R_32F, HIPTENSOR_OP_IDENTITY)
+           != HIPTENSOR_STATUS_SUCCESS
+       || hiptensorInitTensorDescriptor(
+              handle, &descB, 2, bLengths.data(), nullptr, HIP_R_32F, HIPTENSOR_OP_IDENTITY)
+              != HIPTENSOR_STATUS_SUCCESS
+       || hiptensorInitTensorDescriptor(
+              handle, &descC, 2, cLengths.data(), nullptr, HIP_R_32F, HIPTENSOR_OP_IDENTITY)
+              != HIPTENSOR_STATUS_SUCCESS
+       || hiptensorInitContractionDescriptor(handle,
+                                             &desc,
+                                             &descA,
+                                             aModes.data(),
+                                             16u,
+                                             &descB,
+                                             bModes.data(),
+                                             16u,
+                                             &descC,
+                                             cModes.data(),
+                                             16u,
+                                             &descC,
+                                             cModes.data(),
+                                             16u,
+                                             HIPTENSOR_COMPUTE_32F)
+              != HIPTENSOR_STATUS_SUCCESS
+       || hiptensorInitContractionFind(handle, &find, HIPTENSOR_ALGO_DEFAULT)
+              != HIPTENSOR_STATUS_SUCCESS
+       || hiptensorContractionGetWorkspaceSize(
+              handle, &desc, &find, HIPTENSOR_WORKSPACE_RECOMMENDED, &worksize)
+              != HIPTENSOR_STATUS_SUCCESS
+       || hiptensorInitContractionPlan(handle, &plan, &desc, &find, worksize)
+              != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return false;
+    }
+
+    std::vector<char> workspace(worksize);
+    if(hiptensorContraction(handle,
+                            &plan,
+                            &alpha,
+                            A.data(),
+                            B.data(),
+                            &beta,
+                            C.data(),
+                            D.data(),
+                            workspace.data(),
+                            worksize,
+                            0)
+       != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return false;
+    }
+
+    return nearlyEqual(D, ref);
+}
+
+// D_i[m, n] = alpha * A_i[m, k] * B_i[n, k] + beta * C_i[m, n], with B either
+// batched or shared by all items
+bool hostStridedBatchedContractionTest(hiptensorHandle_t* handle, bool shareB)
+{
+    int64_t  M = 13, N = 11, K = 9;
+    uint32_t batchCount = 3;
+
+    int64_t strideA = M * K, strideB = shareB ? 0 : N * K, strideC = M * N, strideD = M * N;
+
+    std::vector<int64_t> aLengths = {M, K}, bLengths = {N, K}, cLengths = {M, N};
+    std::vector<int32_t> aModes = {'m', 'k'}, bModes = {'n', 'k'}, cModes = {'m', 'n'};
+
+    std::vector<float> A(strideA * batchCount), B(shareB ? N * K : strideB * batchCount);
+    std::vector<float> C(strideC * batchCount), D(strideD * batchCount), ref(D.size());
+    for(std::size_t i = 0; i < A.size(); i++)
+    {
+        A[i] = float(i % 7) * 0.5f;
+    }
+    for(std::size_t i = 0; i < B.size(); i++)
+    {
+        B[i] = float(i % 5) - 2.0f;
+    }
+    for(std::size_t i = 0; i < C.size(); i++)
+    {
+        C[i] = float(i % 3);
+    }
+
+    float alpha = 2.0f, beta = 0.5f;
+    for(uint32_t b = 0; b < batchCount; b++)
+    {
+        for(int64_t n = 0; n < N; n++)
+        {
+            for(int64_t m = 0; m < M; m++)
+            {
+                float accum = 0.0f;
+                for(int64_t k = 0; k < K; k++)
+                {
+                    accum += A[b * strideA + m + k * M] * B[b * strideB + n + k * N];
+                }
+                ref[b * strideD + m + n * M] = alpha * accum + beta * C[b * strideC + m + n * M];
+            }
+        }
+    }
+
+    hiptensorTensorDescriptor_t descA, descB, descC;
+
+    hiptensorContractionDescriptor_t desc;
+    hiptensorContractionFind_t       find;
+    hiptensorContractionPlan_t       plan;
+    uint64_t                         worksize = 0;
+
+    if(hiptensorInitTensorDescriptor(
+           handle, &descA, 2, aLengths.data(), nullptr, HIP_R_32F, HIPTENSOR_OP_IDENTITY)
+           != HIPTENSOR_STATUS_SUCCESS
+       || hiptensorInitTensorDescriptor(
+              handle, &descB, 2, bLengths.data(), nullptr, HIP_R_32F, HIPTENSOR_OP_IDENTITY)
+              != HIPTENSOR_STATUS_SUCCESS
+       || hiptensorInitTensorDescriptor(
+              handle, &descC, 2, cLengths.data(), nullptr, HIP_R_32F, HIPTENSOR_OP_IDENTITY)
+              != HIPTENSOR_STATUS_SUCCESS
+       || hiptensorInitContractionDescriptor(handle,
+                                             &desc,
+                                             &descA,
+                                             aModes.data(),
+                                             16u,
+                                             &descB,
+                                             bModes.data(),
+                                             16u,
+                                             &descC,
+                                             cModes.data(),
+                                             16u,
+                                             &descC,
+                                             cModes.data(),
+                                             16u,
+                                             HIPTENSOR_COMPUTE_32F)
+              != HIPTENSOR_STATUS_SUCCESS
+       || hiptensorInitContractionFind(handle, &find, HIPTENSOR_ALGO_DEFAULT)
+              != HIPTENSOR_STATUS_SUCCESS
+       || hiptensorContractionGetWorkspaceSize(
+              handle, &desc, &find, HIPTENSOR_WORKSPACE_RECOMMENDED, &worksize)
+              != HIPTENSOR_STATUS_SUCCESS
+       || hiptensorInitContractionPlan(handle, &plan, &desc, &find, worksize)
+              != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return false;
+    }
+
+    std::vector<char> workspace(worksize);
+    if(hiptensorContractionStridedBatched(handle,
+                                          &plan,
+                                          &alpha,
+                                          A.data(),
+                                          B.data(),
+                                          &beta,
+                                          C.data(),
+                                          D.data(),
+                                          batchCount,
+                                          strideA,
+                                          strideB,
+                                          strideC,
+                                          strideD,
+                                          workspace.data(),
+                                          worksize,
+                                          0)
+       != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return false;
+    }
+
+    // Items writing to the same output are rejected
+    return nearlyEqual(D, ref)
+           && hiptensorContractionStridedBatched(handle,
+                                                 &plan,
+                                                 &alpha,
+                                                 A.data(),
+                                                 B.data(),
+                                                 &beta,
+                                                 C.data(),
+                                                 D.data(),
+                                                 batchCount,
+                                                 strideA,
+                                                 strideB,
+                                                 strideC,
+                                                 0,
+                                                 workspace.data(),
+                                                 worksize,
+                                                 0)
+                  == HIPTENSOR_STATUS_INVALID_VALUE;
+}
+
+// Plan for D[m, n] = alpha * A[m, k] * B[n, k] + beta * C[m, n],
+// or D[m, n] = alpha * A[m, k] * B[n, k] if scale is set
+bool initBilinearPlan(hiptensorHandle_t*          handle,
+                      int64_t                     M,
+                      int64_t                     N,
+                      int64_t                     K,
+                      hiptensorContractionPlan_t* plan,
+                      uint64_t*                   worksize,
+                      bool                        scale = false)
+{
+    std::vector<int64_t> aLengths = {M, K}, bLengths = {N, K}, cLengths = {M, N};
+    std::vector<int32_t> aModes = {'m', 'k'}, bModes = {'n', 'k'}, cModes = {'m', 'n'};
+
+    hiptensorTensorDescriptor_t      descA, descB, descC;
+    hiptensorContractionDescriptor_t desc;
+    hiptensorContractionFind_t       find;
+
+    return hiptensorInitTensorDescriptor(
+               handle, &descA, 2, aLengths.data(), nullptr, HIP_R_32F, HIPTENSOR_OP_IDENTITY)
+               == HIPTENSOR_STATUS_SUCCESS
+           && hiptensorInitTensorDescriptor(
+                  handle, &descB, 2, bLengths.data(), nullptr, HIP_R_32F, HIPTENSOR_OP_IDENTITY)
+                  == HIPTENSOR_STATUS_SUCCESS
+           && hiptensorInitTensorDescriptor(
+                  handle, &descC, 2, cLengths.data(), nullptr, HIP_R_32F, HIPTENSOR_OP_IDENTITY)
+                  == HIPTENSOR_STATUS_SUCCESS
+           && hiptensorInitContractionDescriptor(handle,
+                                                 &desc,
+                                                 &descA,
+                                                 aModes.data(),
+                                                 16u,
+                                                 &descB,
+                                                 bModes.data(),
+                                                 16u,
+                                                 scale ? nullptr : &descC,
+                                                 scale ? nullptr : cModes.data(),
+                                                 16u,
+                                                 &descC,
+                                                 cModes.data(),
+                                                 16u,
+                                                 HIPTENSOR_COMPUTE_32F)
+                  == HIPTENSOR_STATUS_SUCCESS
+           && hiptensorInitContractionFind(handle, &find, HIPTENSOR_ALGO_DEFAULT)
+                  == HIPTENSOR_STATUS_SUCCESS
+           && hiptensorContractionGetWorkspaceSize(
+                  handle, &desc, &find, HIPTENSOR_WORKSPACE_RECOMMENDED, worksize)
+                  == HIPTENSOR_STATUS_SUCCESS
+           && hiptensorInitContractionPlan(handle, plan, &desc, &find, *worksize)
+                  == HIPTENSOR_STATUS_SUCCESS;
+}
+
+// Operands and reference result of one bilinear problem
+struct BilinearProblem
+{
+    BilinearProblem(int64_t M, int64_t N, int64_t K, float alpha, float beta)
+        : A(M * K)
+        , B(N * K)
+        , C(M * N)
+        , D(M * N)
+        , ref(M * N)
+        , alpha(alpha)
+        , beta(beta)
+    {
+        for(std::size_t i = 0; i < A.size(); i++)
+        {
+            A[i] = float((i + M) % 7) * 0.5f;
+        }
+        for(std::size_t i = 0; i < B.size(); i++)
+        {
+            B[i] = float((i + N) % 5) - 2.0f;
+        }
+        for(std::size_t i = 0; i < C.size(); i++)
+        {
+            C[i] = float(i % 3);
+        }
+        for(int64_t n = 0; n < N; n++)
+        {
+            for(int64_t m = 0; m < M; m++)
+            {
+                float accum = 0.0f;
+                for(int64_t k = 0; k < K; k++)
+                {
+                    accum += A[m + k * M] * B[n + k * N];
+                }
+                ref[m + n * M] = alpha * accum + beta * C[m + n * M];
+            }
+        }
+    }
+
+    std::vector<float> A, B, C, D, ref;
+    float              alpha, beta;
+};
+
+// Two shapes, one of which is submitted twice with different operands
+bool hostGroupedContractionTest(hiptensorHandle_t* handle)
+{
+    hiptensorContractionPlan_t plans[2];
+    uint64_t                   worksizes[2] = {0, 0};
+    if(!initBilinearPlan(handle, 21, 17, 12, &plans[0], &worksizes[0])
+       || !initBilinearPlan(handle, 8, 30, 5, &plans[1], &worksizes[1]))
+    {
+        return false;
+    }
+
+    BilinearProblem problems[3] = {{21, 17, 12, 2.0f, 0.5f},
+                                   {8, 30, 5, 1.0f, 0.0f},
+                                   {21, 17, 12, -1.0f, 1.5f}};
+
+    hiptensorContractionGroupEntry_t entries[3];
+    for(int i = 0; i < 3; i++)
+    {
+        auto& p    = problems[i];
+        entries[i] = {
+            &plans[i % 2], &p.alpha, p.A.data(), p.B.data(), &p.beta, p.C.data(), p.D.data()};
+    }
+
+    auto              worksize = std::max(worksizes[0], worksizes[1]);
+    std::vector<char> workspace(worksize);
+    if(hiptensorContractionGrouped(handle, entries, 3, workspace.data(), worksize, 0)
+       != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return false;
+    }
+
+    bool result = true;
+    for(auto& p : problems)
+    {
+        result &= nearlyEqual(p.D, p.ref);
+    }
+
+    // Nothing is launched if an entry is invalid
+    problems[0].D.assign(problems[0].D.size(), 0.0f);
+    entries[2].mA = nullptr;
+    return result
+           && hiptensorContractionGrouped(handle, entries, 3, workspace.data(), worksize, 0)
+                  == HIPTENSOR_STATUS_INVALID_VALUE
+           && problems[0].D[0] == 0.0f;
+}
+
+// An entry reading the output of an earlier entry of another kernel sees that output
+bool hostGroupedDependencyTest(hiptensorHandle_t* handle)
+{
+    int64_t M = 21, N = 17, K = 12;
+
+    hiptensorContractionPlan_t bilinearPlan, scalePlan;
+    uint64_t                   worksizes[2] = {0, 0};
+    if(!initBilinearPlan(handle, M, N, K, &bilinearPlan, &worksizes[0])
+       || !initBilinearPlan(handle, M, N, K, &scalePlan, &worksizes[1], true))
+    {
+        return false;
+    }
+
+    // The last entry's C is the output of the scale entry
+    BilinearProblem problems[3]
+        = {{M, N, K, 2.0f, 0.5f}, {M, N, K, 1.5f, 0.0f}, {M, N, K, -1.0f, 2.0f}};
+    auto& last = problems[2];
+    for(std::size_t i = 0; i < last.ref.size(); i++)
+    {
+        last.ref[i] += last.beta * (problems[1].ref[i] - last.C[i]);
+    }
+
+    hiptensorContractionPlan_t const* plans[3] = {&bilinearPlan, &scalePlan, &bilinearPlan};
+    hiptensorContractionGroupEntry_t  entries[3];
+    for(int i = 0; i < 3; i++)
+    {
+        auto& p    = problems[i];
+        entries[i] = {plans[i], &p.alpha, p.A.data(), p.B.data(), &p.beta, p.C.data(), p.D.data()};
+    }
+    entries[1].mBeta = nullptr;
+    entries[1].mC    = nullptr;
+    entries[2].mC    = problems[1].D.data();
+
+    auto              worksize = std::max(worksizes[0], worksizes[1]);
+    std::vector<char> workspace(worksize);
+    if(hiptensorContractionGrouped(handle, entries, 3, workspace.data(), worksize, 0)
+       != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return false;
+    }
+
+    bool result = true;
+    for(auto& p : problems)
+    {
+        result &= nearlyEqual(p.D, p.ref);
+    }
+    return result;
+}
+
+// B[n, m] = alpha * A[m, n]
+bool hostPermutationTest(hiptensorHandle_t* handle)
+{
+    int64_t M = 19, N = 23;
+
+    std::vector<int64_t> aLengths = {M, N}, bLengths = {N, M};
+    std::vector<int32_t> aModes = {'m', 'n'}, bModes = {'n', 'm'};
+
+    std::vector<float> A(M * N), B(M * N), ref(M * N);
+    for(std::size_t i = 0; i < A.size(); i++)
+    {
+        A[i] = float(i);
+    }
+
+    float alpha = 3.0f;
+    for(int64_t n = 0; n < N; n++)
+    {
+        for(int64_t m = 0; m < M; m++)
+        {
+            ref[n + m * N] = alpha * A[m + n * M];
+        }
+    }
+
+    hiptensorTensorDescriptor_t descA, descB;
+    if(hiptensorInitTensorDescriptor(
+           handle, &descA, 2, aLengths.data(), nullptr, HIP_R_32F, HIPTENSOR_OP_IDENTITY)
+           != HIPTENSOR_STATUS_SUCCESS
+       || hiptensorInitTensorDescriptor(
+              handle, &descB, 2, bLengths.data(), nullptr, HIP_R_32F, HIPTENSOR_OP_IDENTITY)
+              != HIPTENSOR_STATUS_SUCCESS
+       || hiptensorPermutation(handle,
+                               &alpha,
+                               A.data(),
+                               &descA,
+                               aModes.data(),
+                               B.data(),
+                               &descB,
+                               bModes.data(),
+                               HIP_R_32F,
+                               0)
+              != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return false;
+    }
+
+    return nearlyEqual(B, ref);
+}
+
+// B[n, m] = alpha * A[m, n] between padded sub-views; the padding must stay untouched
+bool hostStridedPermutationTest(hiptensorHandle_t* handle)
+{
+    int64_t M = 13, N = 9, lda = M + 3, ldb = N + 2;
+
+    std::vector<int64_t> aLengths = {M, N}, bLengths = {N, M};
+    std::vector<int64_t> aStrides = {1, lda}, bStrides = {1, ldb};
+    std::vector<int32_t> aModes = {'m', 'n'}, bModes = {'n', 'm'};
+
+    std::vector<float> A(lda * N), B(ldb * M, -1.0f), ref(ldb * M, -1.0f);
+    for(std::size_t i = 0; i < A.size(); i++)
+    {
+        A[i] = float(i);
+    }
+
+    float alpha = 0.5f;
+    for(int64_t n = 0; n < N; n++)
+    {
+        for(int64_t m = 0; m < M; m++)
+        {
+            ref[n + m * ldb] = alpha * A[m + n * lda];
+        }
+    }
+
+    hiptensorTensorDescriptor_t descA, descB;
+    if(hiptensorInitTensorDescriptor(
+           handle, &descA, 2, aLengths.data(), aStrides.data(), HIP_R_32F, HIPTENSOR_OP_IDENTITY)
+           != HIPTENSOR_STATUS_SUCCESS
+       || hiptensorInitTensorDescriptor(
+              handle, &descB, 2, bLengths.data(), bStrides.data(), HIP_R_32F, HIPTENSOR_OP_IDENTITY)
+              != HIPTENSOR_STATUS_SUCCESS
+       || hiptensorPermutation(handle,
+                               &alpha,
+                               A.data(),
+                               &descA,
+                               aModes.data(),
+                               B.data(),
+                               &descB,
+                               bModes.data(),
+                               HIP_R_32F,
+                               0)
+              != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return false;
+    }
+
+    return nearlyEqual(B, ref);
+}
+
+// B[h, g, ..., a] = alpha * A[a, b, ..., h]: no modes fold, so two are looped over
+bool hostHighRankPermutationTest(hiptensorHandle_t* handle)
+{
+    int32_t rank = 8;
+
+    std::vector<int64_t> lengths = {2, 3, 2, 2, 3, 2, 2, 3};
+    std::vector<int32_t> aModes  = {'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h'};
+    std::vector<int64_t> bLengths(lengths.rbegin(), lengths.rend());
+    std::vector<int32_t> bModes(aModes.rbegin(), aModes.rend());
+
+    std::size_t elements = 1;
+    for(auto length : lengths)
+    {
+        elements *= length;
+    }
+
+    std::vector<float> A(elements), B(elements), ref(elements);
+    for(std::size_t i = 0; i < A.size(); i++)
+    {
+        A[i] = float(i);
+    }
+
+    float alpha = 2.0f;
+    for(std::size_t i = 0; i < A.size(); i++)
+    {
+        // Column major index of A's element in B
+        std::size_t index = 0, rest = i;
+        for(int32_t j = 0; j < rank; j++)
+        {
+            index = index * lengths[j] + rest % lengths[j];
+            rest /= lengths[j];
+        }
+        ref[index] = alpha * A[i];
+    }
+
+    hiptensorTensorDescriptor_t descA, descB;
+    if(hiptensorInitTensorDescriptor(
+           handle, &descA, rank, lengths.data(), nullptr, HIP_R_32F, HIPTENSOR_OP_IDENTITY)
+           != HIPTENSOR_STATUS_SUCCESS
+       || hiptensorInitTensorDescriptor(
+              handle, &descB, rank, bLengths.data(), nullptr, HIP_R_32F, HIPTENSOR_OP_IDENTITY)
+              != HIPTENSOR_STATUS_SUCCESS
+       || hiptensorPermutation(handle,
+                               &alpha,
+                               A.data(),
+                               &descA,
+                               aModes.data(),
+                               B.data(),
+                               &descB,
+                               bModes.data(),
+                               HIP_R_32F,
+                               0)
+              != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return false;
+    }
+
+    return nearlyEqual(B, ref);
+}
+
+// B[k, n, m] = alpha * A[m, n, k], planned once and executed with new operands
+bool hostPermutationPlanTest(hiptensorHandle_t* handle)
+{
+    int64_t M = 7, N = 5, K = 3;
+
+    std::vector<int64_t> aLengths = {M, N, K}, bLengths = {K, N, M};
+    std::vector<int32_t> aModes = {'m', 'n', 'k'}, bModes = {'k', 'n', 'm'};
+
+    hiptensorTensorDescriptor_t descA, descB;
+    hiptensorPermutationPlan_t  plan;
+    if(hiptensorInitTensorDescriptor(
+           handle, &descA, 3, aLengths.data(), nullptr, HIP_R_32F, HIPTENSOR_OP_IDENTITY)
+           != HIPTENSOR_STATUS_SUCCESS
+       || hiptensorInitTensorDescriptor(
+              handle, &descB, 3, bLengths.data(), nullptr, HIP_R_32F, HIPTENSOR_OP_IDENTITY)
+              != HIPTENSOR_STATUS_SUCCESS
+       || hiptensorInitPermutationPlan(handle,
+                                       &plan,
+                                       &descA,
+                                       aModes.data(),
+                                       &descB,
+                                       bModes.data(),
+                                       HIP_R_32F,
+                                       HIPTENSOR_ALGO_DEFAULT_PATIENT)
+              != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return false;
+    }
+
+    bool result = true;
+    for(int run = 0; run < 2; run++)
+    {
+        std::vector<float> A(M * N * K), B(M * N * K), ref(M * N * K);
+        for(std::size_t i = 0; i < A.size(); i++)
+        {
+            A[i] = float(i % 11) - float(run);
+        }
+
+        float alpha = 2.0f + float(run);
+        for(int64_t m = 0; m < M; m++)
+        {
+            for(int64_t n = 0; n < N; n++)
+            {
+                for(int64_t k = 0; k < K; k++)
+                {
+                    ref[k + n * K + m * K * N] = alpha * A[m + n * M + k * M * N];
+                }
+            }
+        }
+
+        result = result
+                 && hiptensorPermutationExecute(handle, &plan, &alpha, A.data(), B.data(), 0)
+                        == HIPTENSOR_STATUS_SUCCESS
+                 && nearlyEqual(B, ref);
+    }
+
+    float alpha = 1.0f;
+    return result
+           && hiptensorPermutationExecute(handle, &plan, &alpha, nullptr, nullptr, 0)
+                  == HIPTENSOR_STATUS_INVALID_VALUE
+           && hiptensorInitPermutationPlan(handle,
+                                           &plan,
+                                           &descA,
+                                           aModes.data(),
+                                           &descB,
+                                           bModes.data(),
+                                           HIP_R_32F,
+                                           HIPTENSOR_ALGO_ACTOR_CRITIC)
+                  == HIPTENSOR_STATUS_INVALID_VALUE;
+}
+
+// D[m] = alpha * sum_k A[m, k] + beta * C[m]
+// With beta == 0, neither C nor the previous content of D may be read
+bool hostReductionTest(hiptensorHandle_t* handle, bool zeroBeta)
+{
+    int64_t M = 31, K = 17;
+
+    std::vector<int64_t> aLengths = {M, K}, cLengths = {M};
+    std::vector<int32_t> aModes = {'m', 'k'}, cModes = {'m'};
+
+    std::vector<float> A(M * K), C(M), D(M, zeroBeta ? NAN : 0.0f), ref(M);
+    for(std::size_t i = 0; i < A.size(); i++)
+    {
+        A[i] = float(i % 9) * 0.25f;
+    }
+    for(std::size_t i = 0; i < C.size(); i++)
+    {
+        C[i] = zeroBeta ? NAN : float(i % 4);
+    }
+
+    float alpha = 1.5f, beta = zeroBeta ? 0.0f : 2.0f;
+    for(int64_t m = 0; m < M; m++)
+    {
+        float accum = 0.0f;
+        for(int64_t k = 0; k < K; k++)
+        {
+            accum += A[m + k * M];
+        }
+        ref[m] = alpha * accum + (zeroBeta ? 0.0f : beta * C[m]);
+    }
+
+    hiptensorTensorDescriptor_t descA, descC;
+    if(hiptensorInitTensorDescriptor(
+           handle, &descA, 2, aLengths.data(), nullptr, HIP_R_32F, HIPTENSOR_OP_IDENTITY)
+           != HIPTENSOR_STATUS_SUCCESS
+       || hiptensorInitTensorDescriptor(
+              handle, &descC, 1, cLengths.data(), nullptr, HIP_R_32F, HIPTENSOR_OP_IDENTITY)
+              != HIPTENSOR_STATUS_SUCCESS
+       || hiptensorReduction(handle,
+                             &alpha,
+                             A.data(),
+                             &descA,
+                             aModes.data(),
+                             &beta,
+                             C.data(),
+                             &descC,
+                             cModes.data(),
+                             D.data(),
+                             &descC,
+                             cModes.data(),
+                             HIPTENSOR_OP_ADD,
+                             HIPTENSOR_COMPUTE_32F,
+                             nullptr,
+                             0,
+                             0)
+              != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return false;
+    }
+
+    return nearlyEqual(D, ref);
+}
+
+bool hostTwoPassReductionTest(hiptensorHandle_t* handle)
+{
+    // Few outputs and a long reduced extent take the two-pass path
+    int64_t M = 3, K = int64_t(1) << 18;
+
+    std::vector<int64_t> aLengths = {M, K}, cLengths = {M};
+    std::vector<int32_t> aModes = {'m', 'k'}, cModes = {'m'};
+
+    std::vector<float> A(M * K), C(M), D(M), ref(M);
+    for(std::size_t i = 0; i < A.size(); i++)
+    {
+        A[i] = float(i % 9) * 0.25f;
+    }
+    for(std::size_t i = 0; i < C.size(); i++)
+    {
+        C[i] = float(i % 4);
+    }
+
+    // Partial sums are exact in float, so both passes match the sequential reference
+    float alpha = 1.5f, beta = 2.0f;
+    for(int64_t m = 0; m < M; m++)
+    {
+        float accum = 0.0f;
+        for(int64_t k = 0; k < K; k++)
+        {
+            accum += A[m + k * M];
+        }
+        ref[m] = alpha * accum + beta * C[m];
+    }
+
+    hiptensorTensorDescriptor_t descA, descC;
+    uint64_t                    workspaceSize = 0;
+    if(hiptensorInitTensorDescriptor(
+           handle, &descA, 2, aLengths.data(), nullptr, HIP_R_32F, HIPTENSOR_OP_IDENTITY)
+           != HIPTENSOR_STATUS_SUCCESS
+       || hiptensorInitTensorDescriptor(
+              handle, &descC, 1, cLengths.data(), nullptr, HIP_R_32F, HIPTENSOR_OP_IDENTITY)
+              != HIPTENSOR_STATUS_SUCCESS
+       || hiptensorReductionGetWorkspaceSize(handle,
+                                             A.data(),
+                                             &descA,
+                                             aModes.data(),
+                                             C.data(),
+                                             &descC,
+                                             cModes.data(),
+                                             D.data(),
+                                             &descC,
+                                             cModes.data(),
+                                             HIPTENSOR_OP_ADD,
+                                             HIPTENSOR_COMPUTE_32F,
+                                             &workspaceSize)
+              != HIPTENSOR_STATUS_SUCCESS
+       || workspaceSize == 0)
+    {
+        return false;
+    }
+
+    std::vector<float> workspace(workspaceSize / sizeof(float));
+    if(hiptensorReduction(handle,
+                          &alpha,
+                          A.data(),
+                          &descA,
+                          aModes.data(),
+                          &beta,
+                          C.data(),
+                          &descC,
+                          cModes.data(),
+                          D.data(),
+                          &descC,
+                          cModes.data(),
+                          HIPTENSOR_OP_ADD,
+                          HIPTENSOR_COMPUTE_32F,
+                          workspace.data(),
+                          workspaceSize,
+                          0)
+       != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return false;
+    }
+
+    return nearlyEqual(D, ref);
+}
+
+// D[m] = alpha * sum_k A[m, k] + beta * C[m] through a plan executed twice
+bool hostReductionPlanTest(hiptensorHandle_t* handle, bool twoPass)
+{
+    // Few outputs and a long reduced extent take the two-pass path
+    int64_t M = twoPass ? 3 : 31, K = twoPass ? int64_t(1) << 18 : 17;
+
+    std::vector<int64_t> aLengths = {M, K}, cLengths = {M};
+    std::vector<int32_t> aModes = {'m', 'k'}, cModes = {'m'};
+
+    hiptensorTensorDescriptor_t descA, descC;
+    hiptensorReductionPlan_t    plan;
+    if(hiptensorInitTensorDescriptor(
+           handle, &descA, 2, aLengths.data(), nullptr, HIP_R_32F, HIPTENSOR_OP_IDENTITY)
+           != HIPTENSOR_STATUS_SUCCESS
+       || hiptensorInitTensorDescriptor(
+              handle, &descC, 1, cLengths.data(), nullptr, HIP_R_32F, HIPTENSOR_OP_IDENTITY)
+              != HIPTENSOR_STATUS_SUCCESS
+       || hiptensorInitReductionPlan(handle,
+                                     &plan,
+                                     &descA,
+                                     aModes.data(),
+                                     &descC,
+                                     cModes.data(),
+                                     &descC,
+                                     cModes.data(),
+                                     HIPTENSOR_OP_ADD,
+                                     HIPTENSOR_COMPUTE_32F,
+                                     HIPTENSOR_ALGO_DEFAULT_PATIENT,
+                                     twoPass ? UINT64_MAX : 0)
+              != HIPTENSOR_STATUS_SUCCESS
+       || (plan.mWorkspaceSize > 0) != twoPass)
+    {
+        return false;
+    }
+
+    std::vector<float> workspace(plan.mWorkspaceSize / sizeof(float));
+
+    bool result = true;
+    for(int run = 0; run < 2; run++)
+    {
+        // Partial sums are exact in float, so both passes match the sequential reference
+        std::vector<float> A(M * K), C(M), D(M), ref(M);
+        for(std::size_t i = 0; i < A.size(); i++)
+        {
+            A[i] = float((i + run) % 9) * 0.25f;
+        }
+        for(std::size_t i = 0; i < C.size(); i++)
+        {
+            C[i] = float(i % 4) - float(run);
+        }
+
+        float alpha = 1.5f + float(run), beta = 2.0f - float(run);
+        for(int64_t m = 0; m < M; m++)
+        {
+            float accum = 0.0f;
+            for(int64_t k = 0; k < K; k++)
+            {
+                accum += A[m + k * M];
+            }
+            ref[m] = alpha * accum + beta * C[m];
+        }
+
+        result = result
+                 && hiptensorReductionExecute(handle,
+                                              &plan,
+                                              &alpha,
+                                              A.data(),
+                                              &beta,
+                                              C.data(),
+                                              D.data(),
+                                              workspace.data(),
+                                              plan.mWorkspaceSize,
+                                              0)
+                        == HIPTENSOR_STATUS_SUCCESS
+                 && nearlyEqual(D, ref);
+    }
+
+    std::vector<float> A(M * K), D(M);
+    float              alpha = 1.0f, beta = 0.0f;
+    return result
+           && hiptensorReductionExecute(
+                  handle, &plan, &alpha, A.data(), &beta, nullptr, D.data(), nullptr, 0, 0)
+                  == (twoPass ? HIPTENSOR_STATUS_INSUFFICIENT_WORKSPACE
+                              : HIPTENSOR_STATUS_SUCCESS);
+}
+
+int main(int argc, char* argv[])
+{
+    bool totalPass = true;
+    bool testPass  = false;
+
+    hiptensorHandle_t* handle = nullptr;
+    if(hiptensorCreate(&handle) != HIPTENSOR_STATUS_SUCCESS)
+    {
+        printBool(false);
+        return -1;
+    }
+
+    testPass = backendSelectionTest(handle);
+    totalPass &= testPass;
+    std::cout << "Host backend selection: ";
+    printBool(testPass);
+
+    testPass = hostContractionTest(handle);
+    totalPass &= testPass;
+    std::cout << "Host backend contraction: ";
+    printBool(testPass);
+
+    testPass = hostStridedBatchedContractionTest(handle, false);
+    totalPass &= testPass;
+    std::cout << "Host backend strided batched contraction: ";
+    printBool(testPass);
+
+    testPass = hostStridedBatchedContractionTest(handle, true);
+    totalPass &= testPass;
+    std::cout << "Host backend strided batched contraction, shared B: ";
+    printBool(testPass);
+
+    testPass = hostGroupedContractionTest(handle);
+    totalPass &= testPass;
+    std::cout << "Host backend grouped contraction: ";
+    printBool(testPass);
+
+    testPass = hostGroupedDependencyTest(handle);
+    totalPass &= testPass;
+    std::cout << "Host backend grouped contraction, dependent entries: ";
+    printBool(testPass);
+
+    testPass = hostPermutationTest(handle);
+    totalPass &= testPass;
+    std::cout << "Host backend permutation: ";
+    printBool(testPass);
+
+    testPass = hostStridedPermutationTest(handle);
+    totalPass &= testPass;
+    std::cout << "Host backend strided permutation: ";
+    printBool(testPass);
+
+    testPass = hostHighRankPermutationTest(handle);
+    totalPass &= testPass;
+    std::cout << "Host backend rank 8 permutation: ";
+    printBool(testPass);
+
+    testPass = hostPermutationPlanTest(handle);
+    totalPass &= testPass;
+    std::cout << "Host backend permutation plan: ";
+    printBool(testPass);
+
+    testPass = hostReductionTest(handle, false);
+    totalPass &= testPass;
+    std::cout << "Host backend reduction: ";
+    printBool(testPass);
+
+    testPass = hostReductionTest(handle, true);
+    totalPass &= testPass;
+    std::cout << "Host backend reduction with beta = 0: ";
+    printBool(testPass);
+
+    testPass = hostTwoPassReductionTest(handle);
+    totalPass &= testPass;
+    std::cout << "Host backend two-pass reduction: ";
+    printBool(testPass);
+
+    testPass = hostReductionPlanTest(handle, false);
+    totalPass &= testPass;
+    std::cout << "Host backend reduction plan: ";
+    printBool(testPass);
+
+    testPass = hostReductionPlanTest(handle, true);
+    totalPass &= testPass;
+    std::cout << "Host backend two-pass reduction plan: ";
+    printBool(testPass);
+
+    hiptensorDestroy(handle);
+
+    if(!totalPass)
+        return -1;
+    return 0;
+}
@@ -0,0 +1,170 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+
+#include "logger.hpp"
+
+// Measures the per-call cost of API tracing with logging off, on, and queued.
+// Timings are reported only: they depend on the machine and its load.
+// The checks are on what reaches the sink.
+
+void printBool(bool in)
+{
+    std::cout << (in ? "PASSED" : "FAILED") << std::endl;
+}
+
+template <typename Func>
+double nsPerCall(Func&& func, int iterations)
+{
+    auto start = std::chrono::steady_clock::now();
+    for(int i = 0; i < iterations; i++)
+    {
+        func(i);
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+}
+
+// Counts the benchmark traces that reach the callback
+static std::atomic<int> sDelivered{0};
+
+void countDelivered(int32_t logContext, const char* funcName, const char* msg)
+{
+    if(std::strcmp(funcName, "hiptensorBenchmark") == 0)
+    {
+        sDelivered++;
+    }
+}
+
+void trace(int i)
+{
+    auto& logger = hiptensor::Logger::instance();
+    logger->logAPITrace("hiptensorBenchmark",
+                        "handle=0x%0*llX, index=%d, value=%f",
+                        2 * (int)sizeof(void*),
+                        (unsigned long long)&logger,
+                        i,
+                        (double)i * 0.5);
+}
+
+bool disabledTraceBenchmark()
+{
+    using hiptensor::Logger;
+    auto& logger = Logger::instance();
+
+    auto stream = std::tmpfile();
+    if(stream == nullptr)
+    {
+        return false;
+    }
+    logger->writeToStream(stream);
+    logger->setCallback(countDelivered);
+
+    // Logging off: no formatting, no locking, nothing written
+    sDelivered = 0;
+    logger->setLogMask(0);
+    auto offNs  = nsPerCall(trace, 1000000);
+    bool result = sDelivered == 0;
+
+    // Logging on: every call is formatted and written
+    sDelivered = 0;
+    logger->setLogLevel(Logger::LogLevel_t::LOG_LEVEL_API_TRACE);
+    auto onNs = nsPerCall(trace, 10000);
+    result &= sDelivered == 10000;
+
+    logger->setLogMask(0);
+    logger->setCallback(nullptr);
+    logger->writeToStream(stdout);
+    std::fclose(stream);
+
+    std::cout << "API trace disabled: " << offNs << " ns/call, enabled: " << onNs << " ns/call"
+              << std::endl;
+
+    return result;
+}
+
+bool asyncTraceBenchmark()
+{
+    using hiptensor::Logger;
+    auto& logger = Logger::instance();
+
+    auto stream = std::tmpfile();
+    if(stream == nullptr)
+    {
+        return false;
+    }
+    logger->writeToStream(stream);
+    logger->setCallback(countDelivered);
+    logger->setLogLevel(Logger::LogLevel_t::LOG_LEVEL_API_TRACE);
+
+    sDelivered  = 0;
+    auto syncNs = nsPerCall(trace, 10000);
+    bool result = sDelivered == 10000;
+
+    // Queued: every call is either written by the worker or counted as dropped
+    sDelivered   = 0;
+    auto dropped = logger->droppedCount();
+    result &= logger->setMode(Logger::Mode_t::ASYNC_DROP) == Logger::Status_t::SUCCESS;
+    auto asyncNs = nsPerCall(trace, 10000);
+    logger->flush();
+    result &= sDelivered + (logger->droppedCount() - dropped) == 10000;
+
+    logger->setMode(Logger::Mode_t::SYNC);
+    logger->setLogMask(0);
+    logger->setCallback(nullptr);
+    logger->writeToStream(stdout);
+    std::fclose(stream);
+
+    std::cout << "API trace sync: " << syncNs << " ns/call, async: " << asyncNs << " ns/call"
+              << std::endl;
+
+    return result;
+}
+
+int main(int argc, char* argv[])
+{
+    bool totalPass = true;
+    bool testPass  = false;
+
+    testPass = disabledTraceBenchmark();
+    totalPass &= testPass;
+    std::cout << "Logger disabled trace benchmark: ";
+    printBool(testPass);
+
+    testPass = asyncTraceBenchmark();
+    totalPass &= testPass;
+    std::cout << "Logger async trace benchmark: ";
+    printBool(testPass);
+
+    if(!totalPass)
+        return -1;
+    return 0;
+}
@@ -23,7 +23,10 @@
  * THE SOFTWARE.
  *
  *******************************************************************************/
+#include <atomic>
 #include <iostream>
+#include <thread>
+#include <vector>
 
 // hiptensor includes
 #include "logger.hpp"
@@ -225,6 +228,91 @@ bool hiptensorLoggerSetMaskTest()
     return true;
 }
 
+bool hiptensorLoggerSetModeTest()
+{
+    static std::atomic<int> traceCount{0};
+    static std::atomic<int> hintCount{0};
+
+    auto callBackFunc = [](int32_t logContext, const char* funcName, const char* msg) {
+        if(logContext == static_cast<int32_t>(hiptensor::Logger::LogLevel_t::LOG_LEVEL_API_TRACE)
+           && !strcmp(funcName, "AsyncTestFunction"))
+        {
+            traceCount++;
+        }
+        else if(logContext
+                == static_cast<int32_t>(hiptensor::Logger::LogLevel_t::LOG_LEVEL_PERF_HINT))
+        {
+            hintCount++;
+        }
+    };
+
+    using hiptensor::Logger;
+    auto& logger = Logger::instance();
+
+    // Log from several threads at once and count what reaches the callback
+    auto logFromThreads = [&logger](int threadCount, int messageCount) {
+        std::vector<std::thread> threads;
+        for(int t = 0; t < threadCount; t++)
+        {
+            threads.emplace_back([&logger, t, messageCount]() {
+                for(int i = 0; i < messageCount; i++)
+                {
+                    logger->logAPITrace("AsyncTestFunction", "thread=%d, message=%d", t, i);
+                }
+            });
+        }
+        for(auto& thread : threads)
+        {
+            thread.join();
+        }
+    };
+
+    if(hiptensorLoggerSetMode(hiptensorLogMode_t(3)) == HIPTENSOR_STATUS_SUCCESS
+       || hiptensorLoggerSetCallback(callBackFunc) != HIPTENSOR_STATUS_SUCCESS
+       || hiptensorLoggerSetMask(HIPTENSOR_LOG_LEVEL_API_TRACE) != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return false;
+    }
+
+    // Blocking mode: nothing may be lost
+    traceCount = 0;
+    if(hiptensorLoggerSetMode(HIPTENSOR_LOG_MODE_ASYNC_BLOCK) != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return false;
+    }
+    logFromThreads(4, 5000);
+    hiptensorLoggerFlush();
+    bool pass = (traceCount == 4 * 5000);
+
+    // Dropping mode: every message is either written or counted as dropped
+    traceCount       = 0;
+    auto droppedOrig = logger->droppedCount();
+    if(hiptensorLoggerSetMode(HIPTENSOR_LOG_MODE_ASYNC_DROP) != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return false;
+    }
+    hintCount = 0;
+    logFromThreads(4, 5000);
+    hiptensorLoggerFlush();
+    pass &= (traceCount + (logger->droppedCount() - droppedOrig) == 4 * 5000);
+
+    // The drop report is a performance hint, which is masked out here
+    pass &= (hintCount == 0);
+
+    // Back to synchronous output
+    traceCount = 0;
+    if(hiptensorLoggerSetMode(HIPTENSOR_LOG_MODE_SYNC) != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return false;
+    }
+    logger->logAPITrace("AsyncTestFunction", "sync");
+    pass &= (traceCount == 1);
+
+    hiptensorLoggerSetCallback(nullptr);
+    hiptensorLoggerSetLevel(HIPTENSOR_LOG_LEVEL_API_TRACE);
+    return pass;
+}
+
 bool hiptensorLoggerForceDisableTest()
 {
     if(hiptensorLoggerForceDisable() != HIPTENSOR_STATUS_SUCCESS)
@@ -276,6 +364,11 @@ int main(int argc, char* argv[])
     std::cout << "hiptensorLoggerSetMask: ";
     printBool(testPass);
 
+    testPass = hiptensorLoggerSetModeTest();
+    totalPass &= testPass;
+    std::cout << "hiptensorLoggerSetMode: ";
+    printBool(testPass);
+
     // This test must be performed last as hiptensorLoggerForceDisable() cannot be undone
     testPass = hiptensorLoggerForceDisableTest();
     totalPass &= testPass;
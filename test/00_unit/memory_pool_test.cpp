@@ -0,0 +1,277 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+#include <iostream>
+
+// hiptensor includes
+#include "memory_pool.hpp"
+#include <hiptensor/hiptensor.hpp>
+#include <hiptensor/hiptensor_types.hpp>
+
+void printBool(bool in)
+{
+    std::cout << (in ? "PASSED" : "FAILED") << std::endl;
+}
+
+// Counts the requests that reach the upstream allocator
+struct CountingAllocator : public hiptensor::HostAllocator
+{
+    void* allocate(std::size_t bytes) override
+    {
+        auto* ptr = hiptensor::HostAllocator::allocate(bytes);
+        if(ptr != nullptr)
+        {
+            mAllocs++;
+            mLive++;
+        }
+        return ptr;
+    }
+
+    void deallocate(void* ptr, std::size_t bytes) override
+    {
+        if(ptr != nullptr)
+        {
+            mLive--;
+        }
+        hiptensor::HostAllocator::deallocate(ptr, bytes);
+    }
+
+    int mAllocs = 0;
+    int mLive   = 0;
+};
+
+bool blockSizeTest()
+{
+    using hiptensor::CachingPool;
+    bool result = CachingPool::blockSize(1) == CachingPool::MinBlockSize
+                  && CachingPool::blockSize(256) == 256u && CachingPool::blockSize(257) == 320u
+                  && CachingPool::blockSize(512) == 512u && CachingPool::blockSize(513) == 640u
+                  && CachingPool::blockSize(4096) == 4096u
+                  && CachingPool::blockSize(5000) == 5120u;
+
+    // Rounding never adds a quarter or more of the request
+    for(std::size_t bytes = CachingPool::MinBlockSize; bytes < (1u << 20); bytes += bytes / 3 + 1)
+    {
+        auto size = CachingPool::blockSize(bytes);
+        result &= size >= bytes && (size - bytes) * 4u < bytes;
+    }
+    return result;
+}
+
+bool reuseTest()
+{
+    CountingAllocator upstream;
+    bool              result = true;
+    {
+        hiptensor::CachingPool pool(upstream);
+
+        auto* a = pool.allocate(1000);
+        pool.deallocate(a, 1000);
+        result &= pool.cachedBytes() == 1024u;
+
+        // Same size class is served from the cache
+        auto* b = pool.allocate(960);
+        result &= a == b && upstream.mAllocs == 1 && pool.hits() == 1u && pool.misses() == 1u;
+
+        // Different size class goes upstream
+        auto* c = pool.allocate(3000);
+        result &= c != b && upstream.mAllocs == 2;
+
+        pool.deallocate(b, 960);
+        pool.deallocate(c, 3000);
+        result &= pool.cachedBytes() == 1024u + 3072u && upstream.mLive == 2;
+
+        pool.trim();
+        result &= pool.cachedBytes() == 0u && upstream.mLive == 0;
+
+        // Zero-sized requests do not allocate
+        result &= pool.allocate(0) == nullptr && upstream.mAllocs == 2;
+
+        // Cached blocks are released on destruction
+        pool.deallocate(pool.allocate(64), 64);
+    }
+    return result && upstream.mLive == 0;
+}
+
+bool cacheLimitTest()
+{
+    CountingAllocator      upstream;
+    hiptensor::CachingPool pool(upstream, 1024u);
+
+    auto* a = pool.allocate(1024);
+    auto* b = pool.allocate(1024);
+    pool.deallocate(a, 1024);
+    pool.deallocate(b, 1024);
+
+    // Only one block fits under the limit
+    return pool.cachedBytes() == 1024u && upstream.mLive == 1;
+}
+
+bool largeRequestTest()
+{
+    CountingAllocator      upstream;
+    hiptensor::CachingPool pool(upstream, 1024u);
+
+    // Above the cache limit: exact size, straight through
+    auto* a = pool.allocate(1500);
+    pool.deallocate(a, 1500);
+    return a != nullptr && pool.misses() == 0u && pool.cachedBytes() == 0u
+           && upstream.mLive == 0;
+}
+
+// Fails every request above a fixed size
+struct LimitedAllocator : public CountingAllocator
+{
+    void* allocate(std::size_t bytes) override
+    {
+        mLastRequest = bytes;
+        return bytes > mLimit ? nullptr : CountingAllocator::allocate(bytes);
+    }
+
+    std::size_t mLimit       = 1000u;
+    std::size_t mLastRequest = 0u;
+};
+
+bool exactRetryTest()
+{
+    LimitedAllocator       upstream;
+    hiptensor::CachingPool pool(upstream);
+
+    // The 1024 byte class doesn't fit, the request itself does
+    auto* a      = pool.allocate(1000);
+    bool  result = a != nullptr && upstream.mLastRequest == 1000u && upstream.mLive == 1;
+
+    // Exact blocks are not cached: they would be too small for their class
+    pool.deallocate(a, 1000);
+    result &= pool.cachedBytes() == 0u && upstream.mLive == 0;
+
+    result &= pool.allocate(1001) == nullptr;
+    return result;
+}
+
+bool scopedBufferTest()
+{
+    CountingAllocator upstream;
+    bool              result = true;
+    {
+        hiptensor::ScopedBuffer buffer(upstream, 128);
+        hiptensor::ScopedBuffer empty(upstream, 0);
+        result &= buffer.valid() && buffer.get() != nullptr && empty.valid()
+                  && empty.get() == nullptr && upstream.mLive == 1;
+    }
+    return result && upstream.mLive == 0;
+}
+
+struct CallbackState
+{
+    hiptensor::HostAllocator host;
+    std::size_t              allocated = 0;
+    std::size_t              freed     = 0;
+};
+
+void* testAlloc(size_t size, void* userData)
+{
+    auto* state = static_cast<CallbackState*>(userData);
+    state->allocated += size;
+    return state->host.allocate(size);
+}
+
+void testFree(void* ptr, size_t size, void* userData)
+{
+    auto* state = static_cast<CallbackState*>(userData);
+    state->freed += size;
+    state->host.deallocate(ptr, size);
+}
+
+bool callbackAllocatorTest()
+{
+    CallbackState state;
+    {
+        hiptensor::CallbackAllocator allocator(testAlloc, testFree, &state);
+        hiptensor::ScopedBuffer      buffer(allocator, 96);
+    }
+
+    hiptensor::CallbackAllocator unset;
+    return state.allocated == 96u && state.freed == 96u && unset.allocate(16) == nullptr;
+}
+
+bool apiTest()
+{
+    CallbackState state;
+    return hiptensorSetAllocator(nullptr, testAlloc, testFree, &state)
+               == HIPTENSOR_STATUS_NOT_INITIALIZED
+           && hiptensorSetAllocator(nullptr, nullptr, nullptr, nullptr)
+                  == HIPTENSOR_STATUS_NOT_INITIALIZED;
+}
+
+int main(int argc, char* argv[])
+{
+    bool totalPass = true;
+    bool testPass  = false;
+
+    testPass = blockSizeTest();
+    totalPass &= testPass;
+    std::cout << "Memory pool size classes: ";
+    printBool(testPass);
+
+    testPass = reuseTest();
+    totalPass &= testPass;
+    std::cout << "Memory pool reuse and trim: ";
+    printBool(testPass);
+
+    testPass = cacheLimitTest();
+    totalPass &= testPass;
+    std::cout << "Memory pool cache limit: ";
+    printBool(testPass);
+
+    testPass = largeRequestTest();
+    totalPass &= testPass;
+    std::cout << "Memory pool large requests: ";
+    printBool(testPass);
+
+    testPass = exactRetryTest();
+    totalPass &= testPass;
+    std::cout << "Memory pool exact size retry: ";
+    printBool(testPass);
+
+    testPass = scopedBufferTest();
+    totalPass &= testPass;
+    std::cout << "Memory pool scoped buffer: ";
+    printBool(testPass);
+
+    testPass = callbackAllocatorTest();
+    totalPass &= testPass;
+    std::cout << "Memory pool callback allocator: ";
+    printBool(testPass);
+
+    testPass = apiTest();
+    totalPass &= testPass;
+    std::cout << "Memory pool API null handle: ";
+    printBool(testPass);
+
+    if(!totalPass)
+        return -1;
+    return 0;
+}
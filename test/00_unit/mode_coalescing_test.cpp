@@ -0,0 +1,239 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <iostream>
+
+// hiptensor includes
+#include "mode_coalescing.hpp"
+#include <hiptensor/hiptensor.hpp>
+#include <hiptensor/hiptensor_types.hpp>
+
+void printBool(bool in)
+{
+    std::cout << (in ? "PASSED" : "FAILED") << std::endl;
+}
+
+hiptensor::TensorOperand makeOperand(std::vector<std::size_t> const& lengths,
+                                     std::vector<std::size_t> const& strides,
+                                     std::vector<int32_t> const&     modes)
+{
+    return {{HIP_R_32F, lengths, strides, HIPTENSOR_OP_IDENTITY}, modes};
+}
+
+bool isOperand(hiptensor::TensorOperand const&  operand,
+               std::vector<std::size_t> const& lengths,
+               std::vector<std::size_t> const& strides,
+               std::vector<int32_t> const&     modes)
+{
+    return operand.mDesc.mLengths == lengths && operand.mDesc.mStrides == strides
+           && operand.mModes == modes;
+}
+
+// abcd -> cdab folds into ac -> ca
+bool permutationTest()
+{
+    std::vector<hiptensor::TensorOperand> operands
+        = {makeOperand({2, 3, 4, 5}, {1, 2, 6, 24}, {'a', 'b', 'c', 'd'}),
+           makeOperand({4, 5, 2, 3}, {1, 4, 20, 40}, {'c', 'd', 'a', 'b'})};
+
+    return hiptensor::coalesceModes(operands, 2u) == 2u
+           && isOperand(operands[0], {6, 20}, {1, 6}, {'a', 'c'})
+           && isOperand(operands[1], {20, 6}, {1, 20}, {'c', 'a'});
+}
+
+// Kept and reduced modes fold among themselves, not with each other
+bool reductionTest()
+{
+    std::vector<hiptensor::TensorOperand> operands
+        = {makeOperand({4, 8, 16, 2}, {1, 4, 32, 512}, {'a', 'b', 'c', 'd'}),
+           makeOperand({4, 8}, {1, 4}, {'a', 'b'})};
+
+    return hiptensor::coalesceModes(operands) == 2u
+           && isOperand(operands[0], {32, 32}, {1, 32}, {'a', 'c'})
+           && isOperand(operands[1], {32}, {1}, {'a'});
+}
+
+// M, N and K modes fold among themselves, even where another role is contiguous
+bool contractionTest()
+{
+    std::vector<hiptensor::TensorOperand> operands
+        = {makeOperand({2, 3, 4, 5}, {1, 2, 6, 24}, {'m', 'n', 'k', 'l'}),
+           makeOperand({4, 5, 6, 7}, {1, 4, 20, 120}, {'k', 'l', 'u', 'v'}),
+           makeOperand({2, 3, 6, 7}, {1, 2, 6, 36}, {'m', 'n', 'u', 'v'})};
+
+    return hiptensor::coalesceModes(operands) == 3u
+           && isOperand(operands[0], {6, 20}, {1, 6}, {'m', 'k'})
+           && isOperand(operands[1], {20, 42}, {1, 20}, {'k', 'u'})
+           && isOperand(operands[2], {6, 42}, {1, 6}, {'m', 'u'});
+}
+
+// Modes fold only if they are adjacent, in order and contiguous in every operand
+bool layoutTest()
+{
+    // Padded
+    std::vector<hiptensor::TensorOperand> padded
+        = {makeOperand({4, 8}, {1, 5}, {'a', 'b'}), makeOperand({4, 8}, {1, 4}, {'a', 'b'})};
+
+    // Swapped
+    std::vector<hiptensor::TensorOperand> swapped
+        = {makeOperand({4, 8}, {1, 4}, {'a', 'b'}), makeOperand({8, 4}, {1, 8}, {'b', 'a'})};
+
+    // Not adjacent
+    std::vector<hiptensor::TensorOperand> apart
+        = {makeOperand({4, 8, 2}, {1, 4, 32}, {'a', 'b', 'c'}),
+           makeOperand({4, 2, 8}, {1, 4, 8}, {'a', 'c', 'b'})};
+
+    return hiptensor::coalesceModes(padded) == 0u && hiptensor::coalesceModes(swapped) == 0u
+           && hiptensor::coalesceModes(apart) == 0u
+           && isOperand(apart[0], {4, 8, 2}, {1, 4, 32}, {'a', 'b', 'c'});
+}
+
+// Single element modes fold whatever their stride, empty strides are packed
+bool stridesTest()
+{
+    std::vector<hiptensor::TensorOperand> unit
+        = {makeOperand({1, 8, 3}, {7, 1, 8}, {'a', 'b', 'c'})};
+
+    std::vector<hiptensor::TensorOperand> packed = {makeOperand({4, 8}, {}, {'a', 'b'})};
+
+    return hiptensor::coalesceModes(unit) == 2u && isOperand(unit[0], {24}, {1}, {'a'})
+           && hiptensor::coalesceModes(packed) == 1u && isOperand(packed[0], {32}, {1}, {'a'});
+}
+
+// Row-major operands fold with the second mode varying fastest, but only if every
+// operand agrees on the direction
+bool rowMajorTest()
+{
+    std::vector<hiptensor::TensorOperand> operands
+        = {makeOperand({2, 3, 4, 5}, {60, 20, 5, 1}, {'a', 'b', 'c', 'd'}),
+           makeOperand({4, 5, 2, 3}, {30, 6, 3, 1}, {'c', 'd', 'a', 'b'})};
+
+    std::vector<hiptensor::TensorOperand> mixed
+        = {makeOperand({4, 8}, {1, 4}, {'a', 'b'}), makeOperand({4, 8}, {8, 1}, {'a', 'b'})};
+
+    return hiptensor::coalesceModes(operands, 2u) == 2u
+           && isOperand(operands[0], {6, 20}, {20, 1}, {'a', 'c'})
+           && isOperand(operands[1], {20, 6}, {6, 1}, {'c', 'a'})
+           && hiptensor::coalesceModes(mixed) == 0u;
+}
+
+bool minRankTest()
+{
+    std::vector<hiptensor::TensorOperand> operands
+        = {makeOperand({2, 3, 4}, {1, 2, 6}, {'a', 'b', 'c'}),
+           makeOperand({2, 3, 4}, {1, 2, 6}, {'a', 'b', 'c'})};
+
+    return hiptensor::coalesceModes(operands, 3u) == 0u
+           && hiptensor::coalesceModes(operands, 2u) == 1u
+           && isOperand(operands[1], {6, 4}, {1, 6}, {'a', 'c'});
+}
+
+// Inconsistent operands are left for the validation of the entry points
+bool invalidTest()
+{
+    std::vector<hiptensor::TensorOperand> rank
+        = {makeOperand({4, 8}, {1, 4}, {'a', 'b', 'c'})};
+
+    std::vector<hiptensor::TensorOperand> extents
+        = {makeOperand({4, 8}, {1, 4}, {'a', 'b'}), makeOperand({4, 2}, {1, 4}, {'a', 'b'})};
+
+    return hiptensor::coalesceModes(rank) == 0u && hiptensor::coalesceModes(extents) == 0u
+           && isOperand(extents[1], {4, 2}, {1, 4}, {'a', 'b'});
+}
+
+// The outer mode b of ab -> ba is looped over, with strides in bytes per operand
+bool splitTest()
+{
+    std::vector<hiptensor::TensorOperand> operands
+        = {makeOperand({2, 3}, {1, 4}, {'a', 'b'}), makeOperand({3, 2}, {1, 3}, {'b', 'a'})};
+
+    auto outer = hiptensor::outermostMode(operands[0], [](int32_t) { return true; });
+    auto none  = hiptensor::outermostMode(operands[0], [](int32_t) { return false; });
+
+    hiptensor::ModeSplit split;
+    hiptensor::splitMode(operands, split, 'b');
+
+    float data[16];
+    return outer == 1 && none == -1 && isOperand(operands[0], {2}, {1}, {'a'})
+           && isOperand(operands[1], {2}, {3}, {'a'}) && split.count() == 3u
+           && split.offset(0, 2) == 32u && split.offset(1, 2) == 8u
+           && split.at(data, 1, 1) == data + 1 && split.at((float*)nullptr, 0, 1) == nullptr;
+}
+
+int main(int argc, char* argv[])
+{
+    bool totalPass = true;
+    bool testPass  = false;
+
+    testPass = permutationTest();
+    totalPass &= testPass;
+    std::cout << "Mode coalescing permutation: ";
+    printBool(testPass);
+
+    testPass = reductionTest();
+    totalPass &= testPass;
+    std::cout << "Mode coalescing reduction: ";
+    printBool(testPass);
+
+    testPass = contractionTest();
+    totalPass &= testPass;
+    std::cout << "Mode coalescing contraction: ";
+    printBool(testPass);
+
+    testPass = layoutTest();
+    totalPass &= testPass;
+    std::cout << "Mode coalescing layouts: ";
+    printBool(testPass);
+
+    testPass = stridesTest();
+    totalPass &= testPass;
+    std::cout << "Mode coalescing strides: ";
+    printBool(testPass);
+
+    testPass = rowMajorTest();
+    totalPass &= testPass;
+    std::cout << "Mode coalescing row-major: ";
+    printBool(testPass);
+
+    testPass = minRankTest();
+    totalPass &= testPass;
+    std::cout << "Mode coalescing minimum rank: ";
+    printBool(testPass);
+
+    testPass = invalidTest();
+    totalPass &= testPass;
+    std::cout << "Mode coalescing invalid operands: ";
+    printBool(testPass);
+
+    testPass = splitTest();
+    totalPass &= testPass;
+    std::cout << "Mode splitting: ";
+    printBool(testPass);
+
+    if(!totalPass)
+        return -1;
+    return 0;
+}
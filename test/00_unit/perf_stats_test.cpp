@@ -0,0 +1,131 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <cstring>
+#include <iostream>
+#include <string>
+
+// hiptensor includes
+#include "perf_stats.hpp"
+#include <hiptensor/hiptensor.hpp>
+
+void printBool(bool in)
+{
+    std::cout << (in ? "PASSED" : "FAILED") << std::endl;
+}
+
+bool aggregationTest()
+{
+    auto& perfStats = hiptensor::PerfStats::instance();
+    perfStats->reset();
+
+    // 1..100 ms, one call each, 1 GFlop and 1 MB per call
+    for(int i = 1; i <= 100; i++)
+    {
+        perfStats->record({"hiptensorContraction", 42u, "TestKernel", "m=8,n=8,k=8", 1.E9, 1.E6},
+                          static_cast<float>(i));
+    }
+
+    auto json = perfStats->toJson();
+    auto has  = [&json](const char* field) { return json.find(field) != std::string::npos; };
+    return has("\"api\":\"hiptensorContraction\"") && has("\"kernelId\":42")
+           && has("\"problem\":\"m=8,n=8,k=8\"") && has("\"calls\":100")
+           && has("\"totalMs\":5050") && has("\"minMs\":1,") && has("\"maxMs\":100,")
+           && has("\"p50Ms\":51,") && has("\"p99Ms\":99,");
+}
+
+bool signatureTest()
+{
+    auto& perfStats = hiptensor::PerfStats::instance();
+    perfStats->reset();
+
+    // Same kernel, different problems are kept apart
+    auto problemA = hiptensor::PerfStats::lengthsString({2, 3, 4});
+    auto problemB = hiptensor::PerfStats::lengthsString({4, 3, 2});
+    perfStats->record({"hiptensorPermutation", 7u, "TestKernel", problemA, 48.0, 192.0}, 1.0f);
+    perfStats->record({"hiptensorPermutation", 7u, "TestKernel", problemB, 48.0, 192.0}, 2.0f);
+    perfStats->record({"hiptensorPermutation", 7u, "TestKernel", problemA, 48.0, 192.0}, 3.0f);
+
+    auto json = perfStats->toJson();
+    return problemA == "2x3x4"
+           && json.find("\"problem\":\"2x3x4\",\"calls\":2") != std::string::npos
+           && json.find("\"problem\":\"4x3x2\",\"calls\":1") != std::string::npos;
+}
+
+bool hiptensorGetPerfStatsTest()
+{
+    hiptensor::PerfStats::instance()->record(
+        {"hiptensorReduction", 1u, "TestKernel", "A=4,D=1", 8.0, 32.0}, 0.5f);
+
+    // Size query, then a too-small and an exact buffer
+    uint64_t size = 0;
+    if(hiptensorGetPerfStats(nullptr, nullptr) != HIPTENSOR_STATUS_INVALID_VALUE
+       || hiptensorGetPerfStats(nullptr, &size) != HIPTENSOR_STATUS_SUCCESS || size < 2)
+    {
+        return false;
+    }
+
+    std::string buffer(size, '\0');
+    uint64_t    smallSize = size - 1;
+    if(hiptensorGetPerfStats(&buffer[0], &smallSize) != HIPTENSOR_STATUS_INSUFFICIENT_WORKSPACE
+       || smallSize != size || hiptensorGetPerfStats(&buffer[0], &size) != HIPTENSOR_STATUS_SUCCESS
+       || strstr(buffer.c_str(), "\"api\":\"hiptensorReduction\"") == nullptr)
+    {
+        return false;
+    }
+
+    // Reset leaves an empty document
+    char empty[64];
+    size = sizeof(empty);
+    return hiptensorResetPerfStats() == HIPTENSOR_STATUS_SUCCESS
+           && hiptensorGetPerfStats(empty, &size) == HIPTENSOR_STATUS_SUCCESS
+           && strcmp(empty, "{\"kernels\":[]}") == 0;
+}
+
+int main(int argc, char* argv[])
+{
+    bool totalPass = true;
+    bool testPass  = false;
+
+    testPass = aggregationTest();
+    totalPass &= testPass;
+    std::cout << "PerfStats aggregation: ";
+    printBool(testPass);
+
+    testPass = signatureTest();
+    totalPass &= testPass;
+    std::cout << "PerfStats problem signatures: ";
+    printBool(testPass);
+
+    testPass = hiptensorGetPerfStatsTest();
+    totalPass &= testPass;
+    std::cout << "hiptensorGetPerfStats: ";
+    printBool(testPass);
+
+    if(!totalPass)
+        return -1;
+    return 0;
+}
@@ -0,0 +1,187 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+#include <iostream>
+
+// hiptensor includes
+#include "plan_cache.hpp"
+#include <hiptensor/hiptensor.hpp>
+#include <hiptensor/hiptensor_types.hpp>
+
+void printBool(bool in)
+{
+    std::cout << (in ? "PASSED" : "FAILED") << std::endl;
+}
+
+hiptensorContractionDescriptor_t makeDescriptor(std::size_t extent)
+{
+    hiptensorTensorDescriptor_t descA
+        = {HIP_R_32F, {extent, 8}, {1, extent}, HIPTENSOR_OP_IDENTITY};
+    hiptensorTensorDescriptor_t descB = {HIP_R_32F, {8, 4}, {1, 8}, HIPTENSOR_OP_IDENTITY};
+    hiptensorTensorDescriptor_t descD
+        = {HIP_R_32F, {extent, 4}, {1, extent}, HIPTENSOR_OP_IDENTITY};
+
+    return {1,
+            HIPTENSOR_COMPUTE_32F,
+            {descA, descB, descD, descD},
+            {16, 16, 16, 16},
+            {{'m', 'k'}, {'k', 'n'}, {'m', 'n'}, {'m', 'n'}}};
+}
+
+bool descriptorHashTest()
+{
+    auto desc      = makeDescriptor(16);
+    auto same      = makeDescriptor(16);
+    auto different = makeDescriptor(32);
+
+    auto otherModes           = makeDescriptor(16);
+    otherModes.mTensorMode[0] = {'k', 'm'};
+
+    hiptensor::Hash hash;
+    return hash(desc) == hash(same) && hash(desc) != hash(different)
+           && hash(desc) != hash(otherModes)
+           && hash(desc, (int32_t)HIPTENSOR_ALGO_DEFAULT, uint64_t(0))
+                  != hash(desc, (int32_t)HIPTENSOR_ALGO_ACTOR_CRITIC, uint64_t(0))
+           && hash(desc, (int32_t)HIPTENSOR_ALGO_DEFAULT, uint64_t(0))
+                  != hash(desc, (int32_t)HIPTENSOR_ALGO_DEFAULT, uint64_t(1024));
+}
+
+hiptensor::PlanCache::Signature makeSignature(std::size_t extent)
+{
+    return {makeDescriptor(extent), (int32_t)HIPTENSOR_ALGO_DEFAULT, 0u, 0};
+}
+
+bool lruTest()
+{
+    hiptensor::PlanCache cache(2u);
+
+    int   a, b, c;
+    void* solution = nullptr;
+
+    auto sigA = makeSignature(16);
+    auto sigB = makeSignature(32);
+    auto sigC = makeSignature(64);
+
+    cache.insert(1u, sigA, &a);
+    cache.insert(2u, sigB, &b);
+
+    // Touch 1 so that 2 becomes least recently used
+    bool result = cache.lookup(1u, sigA, &solution) && solution == &a;
+
+    cache.insert(3u, sigC, &c);
+    result &= !cache.lookup(2u, sigB, &solution);
+    result &= cache.lookup(1u, sigA, &solution) && solution == &a;
+    result &= cache.lookup(3u, sigC, &solution) && solution == &c;
+
+    auto stats = cache.stats();
+    result &= stats.mHits == 3u && stats.mMisses == 1u && stats.mEvictions == 1u
+              && stats.mSize == 2u && stats.mCapacity == 2u;
+
+    // Shrinking evicts from the back
+    cache.resize(1u);
+    result &= cache.size() == 1u && cache.lookup(3u, sigC, &solution);
+
+    // Disabled cache stores nothing
+    cache.resize(0u);
+    cache.insert(4u, sigA, &a);
+    result &= cache.size() == 0u && !cache.lookup(4u, sigA, &solution);
+
+    cache.resetStats();
+    stats = cache.stats();
+    result &= stats.mHits == 0u && stats.mMisses == 0u && stats.mEvictions == 0u;
+
+    return result;
+}
+
+bool collisionTest()
+{
+    hiptensor::PlanCache cache(2u);
+
+    int   a, b;
+    void* solution = nullptr;
+
+    // Different problems forced under the same key
+    auto sigA = makeSignature(16);
+    auto sigB = makeSignature(32);
+
+    cache.insert(1u, sigA, &a);
+    bool result = !cache.lookup(1u, sigB, &solution) && solution == nullptr;
+
+    // Strides alone, or the workspace size, make a different problem
+    auto otherStrides                          = sigA;
+    otherStrides.mDesc.mTensorDesc[0].mStrides = {8, 1};
+    auto otherWorkspace                        = sigA;
+    otherWorkspace.mWorkspaceSize              = 1024u;
+    result &= !cache.lookup(1u, otherStrides, &solution);
+    result &= !cache.lookup(1u, otherWorkspace, &solution);
+
+    // The colliding problem replaces the entry
+    cache.insert(1u, sigB, &b);
+    result &= cache.size() == 1u && cache.lookup(1u, sigB, &solution) && solution == &b;
+    result &= !cache.lookup(1u, sigA, &solution);
+
+    auto stats = cache.stats();
+    result &= stats.mHits == 1u && stats.mMisses == 4u;
+
+    return result;
+}
+
+bool apiNullHandleTest()
+{
+    hiptensorPlanCacheStats_t stats;
+    return hiptensorHandleResizePlanCache(nullptr, 16u) == HIPTENSOR_STATUS_NOT_INITIALIZED
+           && hiptensorHandleGetPlanCacheStats(nullptr, &stats)
+                  == HIPTENSOR_STATUS_NOT_INITIALIZED;
+}
+
+int main(int argc, char* argv[])
+{
+    bool totalPass = true;
+    bool testPass  = false;
+
+    testPass = descriptorHashTest();
+    totalPass &= testPass;
+    std::cout << "Plan cache descriptor hash: ";
+    printBool(testPass);
+
+    testPass = lruTest();
+    totalPass &= testPass;
+    std::cout << "Plan cache LRU: ";
+    printBool(testPass);
+
+    testPass = collisionTest();
+    totalPass &= testPass;
+    std::cout << "Plan cache hash collision: ";
+    printBool(testPass);
+
+    testPass = apiNullHandleTest();
+    totalPass &= testPass;
+    std::cout << "Plan cache API null handle: ";
+    printBool(testPass);
+
+    if(!totalPass)
+        return -1;
+    return 0;
+}
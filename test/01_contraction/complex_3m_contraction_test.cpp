@@ -0,0 +1,82 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <algorithm>
+
+#include <hiptensor/hiptensor.hpp>
+#include <hiptensor/hiptensor_types.hpp>
+
+#include "contraction/contraction_solution.hpp"
+#include "contraction_test.hpp"
+#include "contraction_test_helpers.hpp"
+
+// Runs complex scale and bilinear contractions through the 3M (Gauss)
+// device solutions only, and checks them against the CPU reference.
+class Complex3MContractionTest : public hiptensor::ContractionTest
+{
+protected:
+    static bool is3M(void* candidate)
+    {
+        auto name = ((hiptensor::ContractionSolution*)candidate)->kernelName();
+        return name.size() > 3 && name.compare(name.size() - 3, 3, "_3M") == 0;
+    }
+
+    // Leave only the 3M solutions to kernel selection
+    void restrictTo3M()
+    {
+        auto& candidates = find.mCandidates;
+        candidates.erase(
+            std::remove_if(candidates.begin(), candidates.end(), [](auto* c) { return !is3M(c); }),
+            candidates.end());
+    }
+};
+
+TEST_P(Complex3MContractionTest, RunKernel)
+{
+    static bool ranWarmup = false;
+    if(!ranWarmup)
+    {
+        this->Warmup();
+        ranWarmup = true;
+    }
+
+    if(mRunFlag)
+    {
+        restrictTo3M();
+        ASSERT_FALSE(find.mCandidates.empty());
+    }
+
+    this->RunKernel();
+
+    if(mRunFlag)
+    {
+        EXPECT_TRUE(is3M(plan.mSolution));
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(ContractionTests,
+                         Complex3MContractionTest,
+                         load_combined_config_params());
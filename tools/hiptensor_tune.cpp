@@ -0,0 +1,689 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2023-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *******************************************************************************/
+
+// hiptensor-tune: offline tuning of the contraction selection model.
+//
+// Times every candidate kernel on the contraction problems of test YAML configs, and
+// writes the winners as a selection model file, to be loaded with
+// HIPTENSOR_SELECTION_MODEL=<file>. The problems of an existing output file are not
+// timed again, so an interrupted run resumes where it stopped, and the rules of other
+// runs can be merged in, keeping the fastest timing of each problem.
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// hiptensor includes
+#include <hiptensor/hiptensor.hpp>
+#include <hiptensor/hiptensor_types.hpp>
+
+#include "01_contraction/contraction_test_params.hpp"
+#include "contraction/contraction_dispatch.hpp"
+#include "contraction/contraction_selection.hpp"
+#include "contraction/contraction_selection_model.hpp"
+#include "contraction/contraction_solution.hpp"
+#include "contraction/contraction_solution_registry.hpp"
+#include "data_types.hpp"
+#include "handle.hpp"
+#include "performance.hpp"
+#include "yaml_parser.hpp"
+
+using hiptensor::ContractionSelectionModel;
+
+struct Options
+{
+    std::vector<std::string> mConfigFiles;
+    std::vector<std::string> mMergeFiles;
+    std::string              mOutputFile;
+
+    int32_t mWarmups = 5;
+    int32_t mRepeats = 50;
+    bool    mRetune  = false;
+};
+
+// Winner of a problem, and the kernel closest to it
+struct Entry
+{
+    ContractionSelectionModel::Rule mRule;
+
+    float       mTimeMs         = std::numeric_limits<float>::infinity();
+    std::size_t mRunnerUpUid    = 0u;
+    float       mRunnerUpTimeMs = std::numeric_limits<float>::infinity();
+
+    bool hasRunnerUp() const
+    {
+        return mRunnerUpTimeMs < std::numeric_limits<float>::infinity();
+    }
+
+    // How much slower the runner-up is, in percent
+    float spread() const
+    {
+        return hasRunnerUp() ? (mRunnerUpTimeMs - mTimeMs) / mTimeMs * 100.0f : 0.0f;
+    }
+};
+
+// Entries by problem, i.e. by their rule without the uid
+using Table = std::map<std::string, Entry>;
+
+std::string problemKey(ContractionSelectionModel::Rule const& rule)
+{
+    auto line = ContractionSelectionModel::toString(rule);
+    return line.substr(0, line.rfind(" uid="));
+}
+
+// Rule matching only the given problem
+ContractionSelectionModel::Rule exactRule(ContractionSelectionModel::Features const& features)
+{
+    ContractionSelectionModel::Rule rule;
+    rule.mContractionOpId = features.mContractionOpId;
+    rule.mTypeA           = features.mTypeA;
+    rule.mTypeB           = features.mTypeB;
+    rule.mTypeD           = features.mTypeD;
+    rule.mTypeE           = features.mTypeE;
+    rule.mTypeCompute     = features.mTypeCompute;
+    rule.mDeviceArch      = features.mDeviceArch;
+    rule.mRankM           = features.mRankM;
+    rule.mRankN           = features.mRankN;
+    rule.mRankK           = features.mRankK;
+    rule.mM               = ContractionSelectionModel::Range{features.mM, features.mM};
+    rule.mN               = ContractionSelectionModel::Range{features.mN, features.mN};
+    rule.mK               = ContractionSelectionModel::Range{features.mK, features.mK};
+    rule.mContiguousKA    = features.mContiguousKA;
+    rule.mContiguousKB    = features.mContiguousKB;
+    rule.mUnitExtent      = features.mUnitExtent;
+    return rule;
+}
+
+// Keeps the faster timing of a problem
+void mergeEntry(Table& table, Entry const& entry)
+{
+    auto key = problemKey(entry.mRule);
+    auto it  = table.find(key);
+    if(it == table.end() || entry.mTimeMs < it->second.mTimeMs)
+    {
+        table[key] = entry;
+    }
+}
+
+// Timings follow the rules as comments: time_ms=<t> runner_up=<uid> runner_up_ms=<t>
+// spread=<percent>%. Rules without timings lose against any timed rule.
+void parseTimings(std::string const& comment, Entry& entry)
+{
+    std::istringstream tokens(comment);
+    std::string        token;
+    while(tokens >> token)
+    {
+        auto equals = token.find('=');
+        if(equals == std::string::npos)
+        {
+            continue;
+        }
+
+        auto key   = token.substr(0, equals);
+        auto value = token.substr(equals + 1);
+        if(key == "time_ms")
+        {
+            entry.mTimeMs = std::strtof(value.c_str(), nullptr);
+        }
+        else if(key == "runner_up")
+        {
+            entry.mRunnerUpUid = std::strtoull(value.c_str(), nullptr, 10);
+        }
+        else if(key == "runner_up_ms")
+        {
+            entry.mRunnerUpTimeMs = std::strtof(value.c_str(), nullptr);
+        }
+    }
+}
+
+// Merges the rules of a model file into the table
+bool readTable(std::string const& fileName, Table& table)
+{
+    std::ifstream file(fileName);
+    if(!file.is_open())
+    {
+        std::cerr << "Cannot open " << fileName << std::endl;
+        return false;
+    }
+
+    std::string line;
+    bool        hasHeader = false;
+    for(int lineNumber = 1; std::getline(file, line); lineNumber++)
+    {
+        auto comment = line.find('#');
+        auto rule    = line.substr(0, comment);
+        if(rule.find_first_not_of(" \t\r") == std::string::npos)
+        {
+            continue;
+        }
+
+        if(!hasHeader)
+        {
+            std::istringstream header(rule);
+            std::string        tag;
+            uint32_t           version = 0u;
+            hasHeader = (header >> tag >> version) && tag == "hiptensor_selection_model"
+                        && version == ContractionSelectionModel::Version;
+            if(!hasHeader)
+            {
+                std::cerr << fileName << ": not a selection model of version "
+                          << ContractionSelectionModel::Version << std::endl;
+                return false;
+            }
+            continue;
+        }
+
+        Entry entry;
+        if(!ContractionSelectionModel::fromString(rule, entry.mRule))
+        {
+            std::cerr << fileName << ":" << lineNumber << ": malformed rule" << std::endl;
+            return false;
+        }
+        if(comment != std::string::npos)
+        {
+            parseTimings(line.substr(comment + 1), entry);
+        }
+        mergeEntry(table, entry);
+    }
+
+    return true;
+}
+
+// Written to a temporary file first, so that an interrupted run leaves the previous
+// table in place
+bool writeTable(std::string const& fileName, Table const& table)
+{
+    auto tempName = fileName + ".tmp";
+    {
+        std::ofstream file(tempName);
+        file << "# Kernel selection model written by hiptensor-tune, in the format of\n"
+             << "# library/src/contraction/contraction_selection_model.txt.\n"
+             << "# Each rule matches a single problem, and is followed by the time of its\n"
+             << "# kernel and of the next fastest one.\n\n"
+             << "hiptensor_selection_model " << ContractionSelectionModel::Version << "\n\n";
+
+        char timings[128];
+        for(auto const& [key, entry] : table)
+        {
+            file << ContractionSelectionModel::toString(entry.mRule);
+            if(entry.mTimeMs < std::numeric_limits<float>::infinity())
+            {
+                snprintf(timings, sizeof(timings), " # time_ms=%.6f", entry.mTimeMs);
+                file << timings;
+            }
+            if(entry.hasRunnerUp())
+            {
+                snprintf(timings,
+                         sizeof(timings),
+                         " runner_up=%zu runner_up_ms=%.6f spread=%.2f%%",
+                         entry.mRunnerUpUid,
+                         entry.mRunnerUpTimeMs,
+                         entry.spread());
+                file << timings;
+            }
+            file << "\n";
+        }
+
+        if(!file.good())
+        {
+            std::cerr << "Cannot write " << tempName << std::endl;
+            return false;
+        }
+    }
+
+    if(std::rename(tempName.c_str(), fileName.c_str()) != 0)
+    {
+        std::cerr << "Cannot write " << fileName << std::endl;
+        return false;
+    }
+    return true;
+}
+
+// One problem of a test config: types of A, B, C, D and compute, and the lengths,
+// strides and modes of A, B and C / D
+struct Problem
+{
+    std::vector<hipDataType>              mTypes;
+    std::vector<std::vector<std::size_t>> mLengths;
+    std::vector<std::vector<std::size_t>> mStrides;
+    std::vector<std::vector<int32_t>>     mModes;
+
+    bool valid() const
+    {
+        if(mTypes.size() != 5 || mLengths.size() != 3 || mModes.size() != 3)
+        {
+            return false;
+        }
+        for(int i = 0; i < 3; i++)
+        {
+            if(mModes[i].size() != mLengths[i].size())
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+hiptensorStatus_t initDescriptor(hiptensorHandle_t const*          handle,
+                                 Problem const&                    problem,
+                                 hiptensorContractionDescriptor_t& desc)
+{
+    // Base addresses are not known: assume the alignment of device allocations
+    constexpr uint32_t Alignment = 128u;
+
+    // A, B, C and D, with C and D sharing their lengths, strides and modes
+    hiptensorTensorDescriptor_t tensors[4];
+    for(int i = 0; i < 4; i++)
+    {
+        auto operand = std::size_t(std::min(i, 2));
+        if(i == 2 && problem.mTypes[2] == hiptensor::NONE_TYPE)
+        {
+            continue;
+        }
+
+        auto const& lengths = problem.mLengths[operand];
+        auto        lens    = std::vector<int64_t>(lengths.cbegin(), lengths.cend());
+
+        // Strides left out, or all 0, are packed
+        std::vector<int64_t> strides;
+        if(operand < problem.mStrides.size())
+        {
+            auto const& given = problem.mStrides[operand];
+            if(given.size() == lengths.size()
+               && std::any_of(given.cbegin(), given.cend(), [](auto s) { return s != 0u; }))
+            {
+                strides.assign(given.cbegin(), given.cend());
+            }
+        }
+
+        auto status = hiptensorInitTensorDescriptor(handle,
+                                                    &tensors[i],
+                                                    lens.size(),
+                                                    lens.data(),
+                                                    strides.empty() ? nullptr : strides.data(),
+                                                    problem.mTypes[i],
+                                                    HIPTENSOR_OP_IDENTITY);
+        if(status != HIPTENSOR_STATUS_SUCCESS)
+        {
+            return status;
+        }
+    }
+
+    auto hasC = problem.mTypes[2] != hiptensor::NONE_TYPE;
+    return hiptensorInitContractionDescriptor(handle,
+                                              &desc,
+                                              &tensors[0],
+                                              problem.mModes[0].data(),
+                                              Alignment,
+                                              &tensors[1],
+                                              problem.mModes[1].data(),
+                                              Alignment,
+                                              hasC ? &tensors[2] : nullptr,
+                                              hasC ? problem.mModes[2].data() : nullptr,
+                                              Alignment,
+                                              &tensors[3],
+                                              problem.mModes[2].data(),
+                                              Alignment,
+                                              hiptensor::convertToComputeType(problem.mTypes[4]));
+}
+
+// Times the candidates on the problem as dispatched. Returns the winner and runner-up.
+hiptensorStatus_t tuneProblem(hiptensorHandle_t const*                handle,
+                              hiptensorContractionDescriptor_t const& desc,
+                              hiptensorContractionDescriptor_t const& dispatch,
+                              Options const&                          options,
+                              Entry&                                  entry)
+{
+    hiptensorContractionFind_t find;
+
+    auto status = hiptensorInitContractionFind(handle, &find, HIPTENSOR_ALGO_DEFAULT);
+    if(status != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return status;
+    }
+
+    // Large enough for every candidate
+    uint64_t workspaceSize = 0u;
+    status                 = hiptensorContractionGetWorkspaceSize(
+        handle, &desc, &find, HIPTENSOR_WORKSPACE_MAX, &workspaceSize);
+    if(status != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return status;
+    }
+
+    // The candidates hiptensorInitContractionPlan would time
+    std::vector<hiptensor::ContractionSolution*> solutions;
+    for(auto* candidate : find.mCandidates)
+    {
+        solutions.push_back((hiptensor::ContractionSolution*)candidate);
+    }
+
+    auto solutionQ = hiptensor::ContractionSolutionRegistry::Query{solutions}
+                         .query((hiptensor::ContractionOpId_t)dispatch.mContractionOpId)
+                         .query(dispatch.mTensorDesc[0].mType,
+                                dispatch.mTensorDesc[1].mType,
+                                dispatch.mTensorDesc[2].mType,
+                                dispatch.mTensorDesc[3].mType,
+                                dispatch.mComputeType);
+
+    std::vector<hiptensor::ContractionSolution*> candidates;
+    for(auto const& [uid, solution] : solutionQ.solutions())
+    {
+        candidates.push_back(solution);
+    }
+
+    auto* realHandle = hiptensor::Handle::toHandle((int64_t*)handle->fields);
+
+    hiptensor::ContractionSolution*     winner = nullptr;
+    std::vector<hiptensor::PerfMetrics> timings;
+    status = hiptensor::bruteForceModel(&winner,
+                                        candidates,
+                                        dispatch.mTensorDesc[0].mType,
+                                        dispatch.mTensorDesc[0].mLengths,
+                                        dispatch.mTensorDesc[0].mStrides,
+                                        dispatch.mTensorMode[0],
+                                        dispatch.mTensorDesc[1].mType,
+                                        dispatch.mTensorDesc[1].mLengths,
+                                        dispatch.mTensorDesc[1].mStrides,
+                                        dispatch.mTensorMode[1],
+                                        dispatch.mTensorDesc[2].mType,
+                                        dispatch.mTensorDesc[2].mLengths,
+                                        dispatch.mTensorDesc[2].mStrides,
+                                        dispatch.mTensorMode[2],
+                                        dispatch.mTensorDesc[3].mType,
+                                        dispatch.mTensorDesc[3].mLengths,
+                                        dispatch.mTensorDesc[3].mStrides,
+                                        dispatch.mTensorMode[2],
+                                        dispatch.mComputeType,
+                                        workspaceSize,
+                                        realHandle->getAllocator(),
+                                        &timings,
+                                        options.mWarmups,
+                                        options.mRepeats);
+    if(status != HIPTENSOR_STATUS_SUCCESS)
+    {
+        return status;
+    }
+
+    entry.mRule.mUid = winner->uid();
+    for(auto const& timing : timings)
+    {
+        if(timing.mKernelUid == winner->uid())
+        {
+            entry.mTimeMs = timing.mAvgTimeMs;
+        }
+        else if(timing.mAvgTimeMs < entry.mRunnerUpTimeMs)
+        {
+            entry.mRunnerUpUid    = timing.mKernelUid;
+            entry.mRunnerUpTimeMs = timing.mAvgTimeMs;
+        }
+    }
+
+    return HIPTENSOR_STATUS_SUCCESS;
+}
+
+void printUsage(char const* name)
+{
+    std::cout
+        << "Usage: " << name << " -o <model> [-y <config>]... [-m <model>]... [options]\n"
+        << "  -o <model>      Selection model to write. Its rules are kept, and their\n"
+        << "                  problems are not timed again.\n"
+        << "  -y <config>     Contraction test YAML config listing the problems to tune\n"
+        << "  -m <model>      Merges the rules of another run, keeping the faster ones\n"
+        << "  --warmup <n>    Untimed launches of each kernel before timing (default 5)\n"
+        << "  --repeat <n>    Timed launches of each kernel, averaged (default 50)\n"
+        << "  --retune        Times the problems of the output file again\n";
+}
+
+bool parseOptions(int argc, char* argv[], Options& options)
+{
+    for(int i = 1; i < argc; i++)
+    {
+        auto arg     = std::string(argv[i]);
+        auto hasNext = i + 1 < argc;
+        if(arg == "-o" && hasNext)
+        {
+            options.mOutputFile = argv[++i];
+        }
+        else if(arg == "-y" && hasNext)
+        {
+            options.mConfigFiles.push_back(argv[++i]);
+        }
+        else if(arg == "-m" && hasNext)
+        {
+            options.mMergeFiles.push_back(argv[++i]);
+        }
+        else if(arg == "--warmup" && hasNext)
+        {
+            options.mWarmups = std::atoi(argv[++i]);
+        }
+        else if(arg == "--repeat" && hasNext)
+        {
+            options.mRepeats = std::atoi(argv[++i]);
+        }
+        else if(arg == "--retune")
+        {
+            options.mRetune = true;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    return !options.mOutputFile.empty() && options.mWarmups >= 0 && options.mRepeats > 0;
+}
+
+int main(int argc, char* argv[])
+{
+    Options options;
+    if(!parseOptions(argc, argv, options))
+    {
+        printUsage(argv[0]);
+        return -1;
+    }
+
+    // Resume from the output of a previous run
+    Table table;
+    if(std::ifstream(options.mOutputFile).good() && !readTable(options.mOutputFile, table))
+    {
+        return -1;
+    }
+    auto resumed = table.size();
+
+    for(auto const& fileName : options.mMergeFiles)
+    {
+        if(!readTable(fileName, table))
+        {
+            return -1;
+        }
+    }
+    if(!writeTable(options.mOutputFile, table))
+    {
+        return -1;
+    }
+
+    hiptensorHandle_t* handle;
+    if(hiptensorCreate(&handle) != HIPTENSOR_STATUS_SUCCESS)
+    {
+        std::cerr << "Cannot create a hipTensor handle" << std::endl;
+        return -1;
+    }
+
+    auto* realHandle = hiptensor::Handle::toHandle((int64_t*)handle->fields);
+    if(!options.mConfigFiles.empty() && realHandle->getBackend() != HIPTENSOR_BACKEND_DEVICE)
+    {
+        std::cerr << "Kernels are only timed on the device backend" << std::endl;
+        hiptensorDestroy(handle);
+        return -1;
+    }
+    auto arch = (uint32_t)realHandle->getDevice().getGcnArch();
+
+    std::size_t tuned = 0u, skipped = 0u, failed = 0u;
+    for(auto const& fileName : options.mConfigFiles)
+    {
+        auto params
+            = hiptensor::YamlConfigLoader<hiptensor::ContractionTestParams>::loadFromFile(fileName);
+        if(!params)
+        {
+            std::cerr << "Cannot read " << fileName << std::endl;
+            failed++;
+            continue;
+        }
+
+        // Every combination, as for the tests
+        std::vector<Problem> problems;
+        for(auto const& types : params->dataTypes())
+        {
+            for(auto const& lengths : params->problemLengths())
+            {
+                for(auto const& strides : params->problemStrides())
+                {
+                    for(auto const& modes : params->problemModes())
+                    {
+                        problems.push_back({types, lengths, strides, modes});
+                    }
+                }
+            }
+        }
+
+        for(auto const& problem : problems)
+        {
+            hiptensorContractionDescriptor_t desc;
+            if(!problem.valid()
+               || initDescriptor(handle, problem, desc) != HIPTENSOR_STATUS_SUCCESS)
+            {
+                std::cerr << fileName << ": invalid problem" << std::endl;
+                failed++;
+                continue;
+            }
+
+            // Rules match the problem as dispatched
+            hiptensorContractionDescriptor_t dispatch;
+            hiptensor::ModeSplit             split;
+            if(hiptensor::makeDispatchProblem(desc, dispatch, split) != HIPTENSOR_STATUS_SUCCESS)
+            {
+                std::cerr << fileName << ": unsupported problem" << std::endl;
+                failed++;
+                continue;
+            }
+
+            auto const& descA = dispatch.mTensorDesc[0];
+            auto const& descB = dispatch.mTensorDesc[1];
+
+            auto features = ContractionSelectionModel::makeFeatures(dispatch.mContractionOpId,
+                                                                    descA.mType,
+                                                                    descB.mType,
+                                                                    dispatch.mTensorDesc[2].mType,
+                                                                    dispatch.mTensorDesc[3].mType,
+                                                                    dispatch.mComputeType,
+                                                                    descA.mLengths,
+                                                                    descA.mStrides,
+                                                                    dispatch.mTensorMode[0],
+                                                                    descB.mLengths,
+                                                                    descB.mStrides,
+                                                                    dispatch.mTensorMode[1],
+                                                                    dispatch.mTensorMode[2],
+                                                                    arch);
+
+            Entry entry;
+            entry.mRule = exactRule(features);
+
+            auto key = problemKey(entry.mRule);
+            if(!options.mRetune && table.count(key) != 0)
+            {
+                skipped++;
+                continue;
+            }
+
+            auto status = tuneProblem(handle, desc, dispatch, options, entry);
+            if(status != HIPTENSOR_STATUS_SUCCESS)
+            {
+                std::cerr << key << ": " << hiptensorGetErrorString(status) << std::endl;
+                failed++;
+                continue;
+            }
+
+            // Retuned problems take the new timing
+            table[key] = entry;
+            tuned++;
+            if(!writeTable(options.mOutputFile, table))
+            {
+                hiptensorDestroy(handle);
+                return -1;
+            }
+
+            char report[256];
+            snprintf(report, sizeof(report), ": %.6f ms", entry.mTimeMs);
+            std::cout << ContractionSelectionModel::toString(entry.mRule) << report;
+            if(entry.hasRunnerUp())
+            {
+                snprintf(report,
+                         sizeof(report),
+                         ", runner-up uid=%zu %.6f ms (+%.2f%%)",
+                         entry.mRunnerUpUid,
+                         entry.mRunnerUpTimeMs,
+                         entry.spread());
+                std::cout << report;
+            }
+            std::cout << std::endl;
+        }
+    }
+
+    hiptensorDestroy(handle);
+
+    // Small spreads are problems where the choice of kernel matters little, or where
+    // timings are too noisy to tell the kernels apart
+    std::vector<float> spreads;
+    for(auto const& [key, entry] : table)
+    {
+        if(entry.hasRunnerUp())
+        {
+            spreads.push_back(entry.spread());
+        }
+    }
+    std::sort(spreads.begin(), spreads.end());
+
+    std::cout << "Tuned " << tuned << ", already in the table " << skipped << ", failed "
+              << failed << ". " << table.size() << " rules written to " << options.mOutputFile
+              << " (" << resumed << " resumed)" << std::endl;
+    if(!spreads.empty())
+    {
+        std::cout << "Spread between the best and second best kernels: min "
+                  << spreads.front() << "%, median " << spreads[spreads.size() / 2] << "%, max "
+                  << spreads.back() << "%" << std::endl;
+    }
+
+    return failed == 0u ? 0 : -1;
+}